@@ -0,0 +1,80 @@
+#pragma once
+
+// Counts heap allocations, by wrapping malloc, calloc and realloc.  This only counts on glibc, whose allocator can be reached under other names.
+//
+// The wrappers are definitions, not declarations, so include this in only one translation unit of a program -- each benchmark is a single source file.
+
+#include <cstddef>
+
+#ifdef __GLIBC__
+extern "C" {
+	void* __libc_malloc(std::size_t);
+	void* __libc_calloc(std::size_t, std::size_t);
+	void* __libc_realloc(void*, std::size_t);
+	void __libc_free(void*);
+}
+#endif
+
+namespace benchmark{
+
+	namespace detail{
+		inline
+		std::size_t& AllocationCounter()
+		{
+			static std::size_t num_allocations = 0;
+			return num_allocations;
+		}
+	}
+
+
+	/**
+	\brief Whether allocations are counted at all.  False when not on glibc, in which case NumAllocations is always 0.
+	*/
+	constexpr bool CountingAllocations()
+	{
+#ifdef __GLIBC__
+		return true;
+#else
+		return false;
+#endif
+	}
+
+
+	/**
+	\brief The number of heap allocations the program has made so far.
+	*/
+	inline
+	std::size_t NumAllocations()
+	{
+		return detail::AllocationCounter();
+	}
+
+} // namespace benchmark
+
+
+#ifdef __GLIBC__
+extern "C" {
+	void* malloc(std::size_t size)
+	{
+		++benchmark::detail::AllocationCounter();
+		return __libc_malloc(size);
+	}
+
+	void* calloc(std::size_t n, std::size_t size)
+	{
+		++benchmark::detail::AllocationCounter();
+		return __libc_calloc(n, size);
+	}
+
+	void* realloc(void* p, std::size_t size)
+	{
+		++benchmark::detail::AllocationCounter();
+		return __libc_realloc(p, size);
+	}
+
+	void free(void* p)
+	{
+		__libc_free(p);
+	}
+}
+#endif
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <bertini2/system.hpp>
+#include <bertini2/system/start_systems.hpp>
+
+#include <string>
+#include <vector>
+
+namespace benchmark{
+
+	using Node = std::shared_ptr<bertini::node::Node>;
+	using Variable = std::shared_ptr<bertini::node::Variable>;
+
+
+	/**
+	\brief Make a dense system of `num_vars` polynomials in `num_vars` variables, each of total degree `degree`, with random rational coefficients.
+
+	With probability one, the system has degree^num_vars isolated solutions, so the two parameters control the number of paths tracked from a total degree start system.
+	*/
+	inline
+	bertini::System RandomDenseSystem(unsigned num_vars, unsigned degree)
+	{
+		using bertini::MakeVariable;
+		using bertini::MakeRational;
+		using bertini::node::Rational;
+
+		std::vector<Variable> vars;
+		bertini::VariableGroup vg;
+		for (unsigned ii=0; ii<num_vars; ++ii)
+		{
+			auto x = MakeVariable("x" + std::to_string(ii));
+			vars.push_back(x);
+			vg.push_back(x);
+		}
+
+		bertini::System sys;
+		for (unsigned ii=0; ii<num_vars; ++ii)
+		{
+			Node f = MakeRational(Rational::Rand());
+			for (unsigned jj=0; jj<num_vars; ++jj)
+				f = f + MakeRational(Rational::Rand())*pow(vars[jj],degree) + MakeRational(Rational::Rand())*vars[jj];
+
+			// couple neighbouring variables, so the system doesn't decouple
+			for (unsigned jj=0; jj+1<num_vars; ++jj)
+				f = f + MakeRational(Rational::Rand())*vars[jj]*vars[jj+1];
+
+			sys.AddFunction(f);
+		}
+		sys.AddVariableGroup(vg);
+
+		return sys;
+	}
+
+
+	/**
+	\brief Make a sparse system of `num_vars` polynomials in `num_vars` variables, each of total degree `degree`, with random rational coefficients.
+
+	Function ii involves only variables ii, ii+1 and ii+2, cyclically, so each function has a fixed number of terms however many variables there are, and its written-out form is a product of sums, which the function tree evaluates as it is written.
+	*/
+	inline
+	bertini::System RandomSparseSystem(unsigned num_vars, unsigned degree)
+	{
+		using bertini::MakeVariable;
+		using bertini::MakeRational;
+		using bertini::node::Rational;
+
+		std::vector<Variable> vars;
+		bertini::VariableGroup vg;
+		for (unsigned ii=0; ii<num_vars; ++ii)
+		{
+			auto x = MakeVariable("x" + std::to_string(ii));
+			vars.push_back(x);
+			vg.push_back(x);
+		}
+
+		bertini::System sys;
+		for (unsigned ii=0; ii<num_vars; ++ii)
+		{
+			auto const& x = vars[ii];
+			auto const& y = vars[(ii+1)%num_vars];
+			auto const& z = vars[(ii+2)%num_vars];
+
+			Node f = MakeRational(Rational::Rand());
+			for (unsigned jj=0; jj<degree; ++jj)
+				f = f * (MakeRational(Rational::Rand())*x + MakeRational(Rational::Rand())*y + MakeRational(Rational::Rand())*z + MakeRational(Rational::Rand()));
+			f = f + MakeRational(Rational::Rand())*pow(x,degree);
+
+			sys.AddFunction(f);
+		}
+		sys.AddVariableGroup(vg);
+
+		return sys;
+	}
+
+
+	/**
+	\brief Form the homotopy from a total degree start system to a target system, the same way the zero dim algorithm does.
+
+	The structure of the homotopy depends only on the structure of the target, so homotopies for RandomDenseSystem's of the same size have the same straight-line programs, up to their numbers.
+	*/
+	inline
+	bertini::System TotalDegreeHomotopy(bertini::System target)
+	{
+		using bertini::MakeVariable;
+		using bertini::MakeRational;
+		using bertini::node::Rational;
+
+		target.Homogenize();
+		target.AutoPatch();
+
+		auto start = bertini::start_system::TotalDegree(target);
+
+		auto t = MakeVariable("t");
+		bertini::System homotopy = (1-t)*target + MakeRational(Rational::Rand())*t*start;
+		homotopy.AddPathVariable(t);
+		return homotopy;
+	}
+
+} // namespace benchmark
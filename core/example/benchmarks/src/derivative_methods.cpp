@@ -0,0 +1,114 @@
+// Compares the ways a system can compute its Jacobian and time derivative: with Jacobian nodes, with derivative trees evaluated as trees or compiled into a straight-line program, and by differentiating a straight-line program of the functions alone in forward mode.
+//
+// For each, reports the setup -- the first evaluation, which differentiates and compiles the system -- in time and heap allocations, and then the time per evaluation of functions, Jacobian and time derivative, in double and multiple precision.
+// The homotopies are total degree homotopies for dense random systems, homogenized and patched as in the zero dim algorithm.
+//
+// Allocations are counted by wrapping malloc, so this only counts on glibc.
+//
+// usage: derivative_methods [max_num_variables] [degree] [num_evaluations] [digits]
+
+#include "allocation_counting.hpp"
+#include "benchmark_systems.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+	using namespace bertini;
+
+	struct Method
+	{
+		std::string name;
+		JacobianEvalMethod jacobian_method;
+		EvalMethod eval_method;
+	};
+
+
+	/**
+	\brief Evaluate functions, Jacobian and time derivative at a sequence of points, returning the seconds per evaluation.
+	*/
+	template<typename ComplexT>
+	double SecondsPerEvaluation(System const& sys, std::vector<Vec<ComplexT>> const& points, ComplexT const& t, unsigned num_evaluations)
+	{
+		Vec<ComplexT> f(sys.NumTotalFunctions());
+		Mat<ComplexT> J(sys.NumTotalFunctions(), sys.NumVariables());
+		Vec<ComplexT> dt(sys.NumTotalFunctions());
+
+		auto start = std::chrono::steady_clock::now();
+		for (unsigned ii=0; ii<num_evaluations; ++ii)
+		{
+			sys.SetAndReset(points[ii % points.size()], t);
+			sys.EvalInPlace(f);
+			sys.JacobianInPlace(J);
+			sys.TimeDerivativeInPlace(dt);
+		}
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / num_evaluations;
+	}
+
+
+	template<typename ComplexT>
+	double Time(System const& sys, unsigned num_evaluations)
+	{
+		std::vector<Vec<ComplexT>> points(10);
+		for (auto& p : points)
+			p = RandomOfUnits<ComplexT>(sys.NumVariables());
+		ComplexT t = RandomUnit<ComplexT>();
+
+		SecondsPerEvaluation(sys, points, t, 1); // warm up
+		return SecondsPerEvaluation(sys, points, t, num_evaluations);
+	}
+
+}
+
+
+int main(int argc, char** argv)
+{
+	unsigned max_num_vars = argc > 1 ? std::atoi(argv[1]) : 16;
+	unsigned degree = argc > 2 ? std::atoi(argv[2]) : 3;
+	unsigned num_evaluations = argc > 3 ? std::atoi(argv[3]) : 200;
+	unsigned digits = argc > 4 ? std::atoi(argv[4]) : 30;
+
+	DefaultPrecision(digits);
+
+	const std::vector<Method> methods{
+		{"nodes", JacobianEvalMethod::JacobianNode, EvalMethod::FunctionTree},
+		{"derivs", JacobianEvalMethod::Derivatives, EvalMethod::FunctionTree},
+		{"derivs_slp", JacobianEvalMethod::Derivatives, EvalMethod::StraightLineProgram},
+		{"forward", JacobianEvalMethod::ForwardMode, EvalMethod::StraightLineProgram},
+	};
+
+	std::cout << "total degree homotopies of dense systems of degree " << degree << ", evaluated " << num_evaluations << " times each\n";
+	std::cout << "setup is the first evaluation, which differentiates and compiles the system\n\n";
+	std::cout << "vars\tmethod\tsetup (ms)\tsetup allocations\tdouble (us)\tmpfr" << digits << " (us)\n";
+
+	for (unsigned num_vars = 2; num_vars <= max_num_vars; num_vars *= 2)
+	{
+		auto homotopy = benchmark::TotalDegreeHomotopy(benchmark::RandomDenseSystem(num_vars, degree));
+		homotopy.precision(digits);
+
+		for (auto const& method : methods)
+		{
+			auto sys = homotopy;
+			sys.SetJacobianEvalMethod(method.jacobian_method);
+			sys.SetEvalMethod(method.eval_method);
+
+			Vec<dbl> x = RandomOfUnits<dbl>(sys.NumVariables());
+			dbl t = RandomUnit<dbl>();
+
+			auto allocations_before = benchmark::NumAllocations();
+			auto start = std::chrono::steady_clock::now();
+			sys.Jacobian(x, t);
+			auto setup_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			auto setup_allocations = benchmark::NumAllocations() - allocations_before;
+
+			auto dbl_seconds = Time<dbl>(sys, num_evaluations);
+			auto mpfr_seconds = Time<mpfr_complex>(sys, num_evaluations);
+
+			std::cout << sys.NumVariables() << '\t' << method.name << '\t' << setup_seconds*1e3 << '\t' << setup_allocations << '\t' << dbl_seconds*1e6 << '\t' << mpfr_seconds*1e6 << '\n';
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,116 @@
+// Measures what observing a tracker costs, in tracker steps per second with 0, 1 and 5 observers attached.
+//
+// Events are only made for observers who subscribe to them, so with no observers attached, tracking should run as fast as if there were no events at all.  The observers here just count events, so the differences are the cost of making and delivering them.
+//
+// usage: observer_overhead [num_variables] [degree] [num_repeats]
+
+#include "benchmark_systems.hpp"
+
+#include <bertini2/trackers/amp_tracker.hpp>
+#include <bertini2/trackers/observers.hpp>
+#include <bertini2/system/start_systems.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+	using namespace bertini;
+	using namespace bertini::tracking;
+
+	template<template<class> class EventT>
+	struct EventCounter : public Observer<AMPTracker>
+	{
+		void Observe(AnyEvent const& e) override
+		{
+			if (EventCast<EventT<AMPTracker>>(e))
+				++count;
+		}
+
+		detail::EventMask Subscriptions() const override
+		{
+			return detail::EventTypeBits<EventT<AMPTracker>>();
+		}
+
+		unsigned long count = 0;
+	};
+
+
+	// the number of steps taken per second, tracking every path from t=1 to near t=0, short of the endgame
+	double StepsPerSecond(AMPTracker const& tracker, std::vector<Vec<mpfr_complex>> const& start_points, unsigned num_repeats)
+	{
+		const mpfr_complex t_start(1), t_end(mpfr_float("0.1"));
+		Vec<mpfr_complex> result;
+		unsigned long num_steps = 0;
+
+		auto start = std::chrono::steady_clock::now();
+		for (unsigned rr = 0; rr < num_repeats; ++rr)
+			for (auto const& x : start_points)
+			{
+				tracker.TrackPath(result, t_start, t_end, x);
+				num_steps += tracker.NumTotalStepsTaken();
+			}
+		auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		return num_steps / seconds;
+	}
+
+}
+
+
+int main(int argc, char** argv)
+{
+	unsigned num_vars = argc > 1 ? std::atoi(argv[1]) : 3;
+	unsigned degree = argc > 2 ? std::atoi(argv[2]) : 3;
+	unsigned num_repeats = argc > 3 ? std::atoi(argv[3]) : 3;
+
+	DefaultPrecision(16);
+
+	auto target = benchmark::RandomDenseSystem(num_vars, degree);
+	target.Homogenize();
+	target.AutoPatch();
+
+	auto total_degree = start_system::TotalDegree(target);
+	total_degree.Homogenize();
+
+	auto t = MakeVariable("t");
+	System homotopy = (1-t)*target + MakeRational(node::Rational::Rand())*t*total_degree;
+	homotopy.AddPathVariable(t);
+
+	AMPTracker tracker(homotopy);
+	tracker.Setup(Predictor::RK4, 1e-5, 1e5, SteppingConfig(), NewtonConfig());
+	tracker.PrecisionSetup(AMPConfigFrom(homotopy));
+
+	std::vector<Vec<mpfr_complex>> start_points;
+	for (unsigned ii = 0; ii < total_degree.NumStartPoints(); ++ii)
+		start_points.push_back(total_degree.StartPoint<mpfr_complex>(ii));
+
+	EventCounter<SuccessfulStep> successes;
+	EventCounter<FailedStep> failures;
+	EventCounter<NewStep> new_steps;
+	EventCounter<PrecisionChanged> precision_changes;
+	EventCounter<TrackingEvent> everything;
+	std::vector<AnyObserver*> observers{&successes, &failures, &new_steps, &precision_changes, &everything};
+
+	std::cout << "tracking the " << start_points.size() << " paths of the total degree homotopy of a dense system with " << num_vars << " variables of degree " << degree << ", " << num_repeats << " times\n\n";
+	std::cout << "observers\tsteps per second\trelative to none\n";
+
+	double baseline = 0;
+	unsigned num_attached = 0;
+	for (unsigned num_observers : {0u, 1u, 5u})
+	{
+		for (; num_attached < num_observers; ++num_attached)
+			tracker.AddObserver(*observers[num_attached]);
+
+		auto rate = StepsPerSecond(tracker, start_points, num_repeats);
+		if (num_observers==0)
+			baseline = rate;
+
+		std::cout << num_observers << "\t\t" << rate << "\t\t" << rate/baseline << '\n';
+	}
+
+	return 0;
+}
@@ -0,0 +1,106 @@
+// Compares evaluating total degree homotopies through the function tree with Jacobian nodes, and expanded into monomials as a PolynomialSystem.
+//
+// The target systems are dense random systems, written out as sums of monomials, and sparse random systems, each function of which is a product of sums in three variables, which expand into many monomials.
+// Reports the setup -- the first evaluation, which differentiates or expands the system -- and the time per evaluation of functions, Jacobian and time derivative, in double and multiple precision.
+//
+// usage: polynomial_vs_tree [max_num_variables] [degree] [num_evaluations] [digits]
+
+#include "benchmark_systems.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+
+namespace {
+
+	using namespace bertini;
+
+	/**
+	\brief Evaluate functions, Jacobian and time derivative at a sequence of points, returning the seconds per evaluation.
+	*/
+	template<typename ComplexT>
+	double SecondsPerEvaluation(System const& sys, std::vector<Vec<ComplexT>> const& points, ComplexT const& t, unsigned num_evaluations)
+	{
+		Vec<ComplexT> f(sys.NumTotalFunctions());
+		Mat<ComplexT> J(sys.NumTotalFunctions(), sys.NumVariables());
+		Vec<ComplexT> dt(sys.NumTotalFunctions());
+
+		auto start = std::chrono::steady_clock::now();
+		for (unsigned ii=0; ii<num_evaluations; ++ii)
+		{
+			sys.SetAndReset(points[ii % points.size()], t);
+			sys.EvalInPlace(f);
+			sys.JacobianInPlace(J);
+			sys.TimeDerivativeInPlace(dt);
+		}
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / num_evaluations;
+	}
+
+
+	template<typename ComplexT>
+	double Time(System const& sys, unsigned num_evaluations)
+	{
+		std::vector<Vec<ComplexT>> points(10);
+		for (auto& p : points)
+			p = RandomOfUnits<ComplexT>(sys.NumVariables());
+		ComplexT t = RandomUnit<ComplexT>();
+
+		SecondsPerEvaluation(sys, points, t, 1); // warm up
+		return SecondsPerEvaluation(sys, points, t, num_evaluations);
+	}
+
+}
+
+
+int main(int argc, char** argv)
+{
+	unsigned max_num_vars = argc > 1 ? std::atoi(argv[1]) : 16;
+	unsigned degree = argc > 2 ? std::atoi(argv[2]) : 3;
+	unsigned num_evaluations = argc > 3 ? std::atoi(argv[3]) : 200;
+	unsigned digits = argc > 4 ? std::atoi(argv[4]) : 30;
+
+	DefaultPrecision(digits);
+
+	const std::vector<std::pair<std::string, std::function<System(unsigned, unsigned)>>> kinds{
+		{"dense", benchmark::RandomDenseSystem},
+		{"sparse", benchmark::RandomSparseSystem},
+	};
+
+	std::cout << "total degree homotopies of systems of degree " << degree << ", evaluated " << num_evaluations << " times each\n";
+	std::cout << "setup is the first evaluation, which differentiates or expands the system\n\n";
+	std::cout << "kind\tvars\tmonomials\ttree setup (ms)\tpoly setup (ms)\ttree double (us)\tpoly double (us)\ttree mpfr" << digits << " (us)\tpoly mpfr" << digits << " (us)\n";
+
+	for (auto const& kind : kinds)
+		for (unsigned num_vars = 2; num_vars <= max_num_vars; num_vars *= 2)
+		{
+			auto tree = benchmark::TotalDegreeHomotopy(kind.second(num_vars, degree));
+			tree.precision(digits);
+
+			auto poly = tree;
+			poly.SetEvalMethod(EvalMethod::Polynomial);
+
+			Vec<dbl> x = RandomOfUnits<dbl>(tree.NumVariables());
+			dbl t = RandomUnit<dbl>();
+
+			auto start = std::chrono::steady_clock::now();
+			tree.Jacobian(x, t);
+			auto tree_setup_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+			start = std::chrono::steady_clock::now();
+			poly.Jacobian(x, t);
+			auto poly_setup_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+			auto tree_dbl = Time<dbl>(tree, num_evaluations);
+			auto poly_dbl = Time<dbl>(poly, num_evaluations);
+			auto tree_mpfr = Time<mpfr_complex>(tree, num_evaluations);
+			auto poly_mpfr = Time<mpfr_complex>(poly, num_evaluations);
+
+			std::cout << kind.first << '\t' << tree.NumVariables() << '\t' << poly.GetPolynomialSystem().NumMonomials() << '\t'
+			          << tree_setup_seconds*1e3 << '\t' << poly_setup_seconds*1e3 << '\t'
+			          << tree_dbl*1e6 << '\t' << poly_dbl*1e6 << '\t'
+			          << tree_mpfr*1e6 << '\t' << poly_mpfr*1e6 << '\n';
+		}
+
+	return 0;
+}
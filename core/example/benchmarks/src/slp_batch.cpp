@@ -0,0 +1,70 @@
+// Compares evaluating a straight-line program at many points one at a time, with StraightLineProgram::Eval, against evaluating them all at once, with an SLPBatch.
+//
+// The programs are compiled from total degree homotopies for dense random systems.  Build with -march=native, so the batch's loops over points use the widest vectors the processor has.
+//
+// usage: slp_batch [num_variables] [degree] [max_num_points] [num_evaluations]
+
+#include "benchmark_systems.hpp"
+
+#include <bertini2/system/slp_batch.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+	using namespace bertini;
+
+	template<typename EvalT>
+	double MicrosecondsPerPoint(EvalT const& eval, unsigned num_points, unsigned num_evaluations)
+	{
+		eval(); // warm up
+
+		auto start = std::chrono::steady_clock::now();
+		for (unsigned ii=0; ii<num_evaluations; ++ii)
+			eval();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / num_evaluations / num_points * 1e6;
+	}
+
+}
+
+
+int main(int argc, char** argv)
+{
+	unsigned num_vars = argc > 1 ? std::atoi(argv[1]) : 8;
+	unsigned degree = argc > 2 ? std::atoi(argv[2]) : 3;
+	unsigned max_num_points = argc > 3 ? std::atoi(argv[3]) : 64;
+	unsigned num_evaluations = argc > 4 ? std::atoi(argv[4]) : 200;
+
+	auto homotopy = benchmark::TotalDegreeHomotopy(benchmark::RandomDenseSystem(num_vars, degree));
+	StraightLineProgram slp(homotopy);
+
+	std::cout << "evaluating the total degree homotopy of a dense system with " << num_vars << " variables of degree " << degree << " at batches of points, " << num_evaluations << " times each\n\n";
+	std::cout << "points\tone at a time (us/point)\tbatched (us/point)\tspeedup\n";
+
+	for (unsigned num_points = 1; num_points <= max_num_points; num_points *= 2)
+	{
+		Mat<dbl> points = RandomOfUnits<dbl>(slp.NumVariables(), num_points);
+		dbl t = RandomUnit<dbl>();
+
+		std::vector<Vec<dbl>> columns;
+		for (unsigned k=0; k<num_points; ++k)
+			columns.push_back(points.col(k));
+
+		auto one_at_a_time = MicrosecondsPerPoint([&]{
+				for (auto const& x : columns)
+					slp.Eval(x, t);
+			}, num_points, num_evaluations);
+
+		SLPBatch batch(slp, num_points);
+		auto batched = MicrosecondsPerPoint([&]{
+				batch.SetPoints(points, t);
+				batch.Eval();
+			}, num_points, num_evaluations);
+
+		std::cout << num_points << '\t' << one_at_a_time << "\t\t\t" << batched << "\t\t\t" << one_at_a_time/batched << '\n';
+	}
+
+	return 0;
+}
@@ -0,0 +1,45 @@
+// Generates C++ for the straight-line programs of total degree homotopies for dense random systems, for the slp_compiled benchmark.
+//
+// The build runs this, and compiles its output into slp_compiled, so the evaluators are compiled ahead of time.  Because the generated code depends only on the structure of a program, not its numbers, it serves the homotopies slp_compiled makes, even though their coefficients are different random numbers.
+//
+// usage: slp_codegen output_file [max_num_variables] [degree]
+
+#include "benchmark_systems.hpp"
+
+#include <bertini2/system/compiled_slp.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		std::cerr << "usage: slp_codegen output_file [max_num_variables] [degree]\n";
+		return 1;
+	}
+
+	std::string output_file = argv[1];
+	unsigned max_num_vars = argc > 2 ? std::atoi(argv[2]) : 16;
+	unsigned degree = argc > 3 ? std::atoi(argv[3]) : 3;
+
+	std::ofstream out(output_file);
+	if (!out)
+	{
+		std::cerr << "unable to open " << output_file << " for writing\n";
+		return 1;
+	}
+
+	for (unsigned num_vars = 2; num_vars <= max_num_vars; num_vars *= 2)
+	{
+		auto homotopy = benchmark::TotalDegreeHomotopy(benchmark::RandomDenseSystem(num_vars, degree));
+
+		auto name = "dense_" + std::to_string(num_vars) + "_vars_degree_" + std::to_string(degree);
+		bertini::SLPCodeGenerator().Generate(bertini::StraightLineProgram(homotopy), name, out);
+		out << "\n\n";
+	}
+
+	return 0;
+}
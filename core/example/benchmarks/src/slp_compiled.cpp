@@ -0,0 +1,85 @@
+// Compares evaluating straight-line programs by interpreting them, with StraightLineProgram::Eval, against running C++ generated for them ahead of time by the SLPCodeGenerator.
+//
+// The generated code is made by slp_codegen when building, and compiled into this program.  The programs are compiled from total degree homotopies for dense random systems, and evaluated in double and multiple precision.  Sizes for which no code was generated are skipped.
+//
+// usage: slp_compiled [max_num_variables] [degree] [num_evaluations] [digits]
+
+#include "benchmark_systems.hpp"
+
+#include <bertini2/system/compiled_slp.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+	using namespace bertini;
+
+	template<typename ComplexT>
+	double MicrosecondsPerEvaluation(StraightLineProgram const& slp, unsigned num_evaluations)
+	{
+		Vec<ComplexT> x = RandomOfUnits<ComplexT>(slp.NumVariables());
+		ComplexT t = RandomUnit<ComplexT>();
+
+		slp.Eval(x, t); // warm up
+
+		auto start = std::chrono::steady_clock::now();
+		for (unsigned ii=0; ii<num_evaluations; ++ii)
+		{
+			x(0) += ComplexT(1e-10); // so every evaluation is at a different point
+			slp.Eval(x, t);
+		}
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / num_evaluations * 1e6;
+	}
+
+
+	template<typename ComplexT>
+	void Compare(StraightLineProgram const& interpreted, StraightLineProgram const& compiled, unsigned num_evaluations, std::string const& label)
+	{
+		auto interpreted_us = MicrosecondsPerEvaluation<ComplexT>(interpreted, num_evaluations);
+		auto compiled_us = MicrosecondsPerEvaluation<ComplexT>(compiled, num_evaluations);
+
+		std::cout << interpreted.NumVariables() << '\t' << label << '\t' << interpreted.NumPackedInstructions() << "\t\t" << interpreted_us << "\t\t" << compiled_us << "\t\t" << interpreted_us/compiled_us << '\n';
+	}
+
+}
+
+
+int main(int argc, char** argv)
+{
+	unsigned max_num_vars = argc > 1 ? std::atoi(argv[1]) : 16;
+	unsigned degree = argc > 2 ? std::atoi(argv[2]) : 3;
+	unsigned num_evaluations = argc > 3 ? std::atoi(argv[3]) : 1000;
+	unsigned digits = argc > 4 ? std::atoi(argv[4]) : 30;
+
+	DefaultPrecision(digits);
+
+	std::cout << CompiledSLPRegistry::NumRegistered() << " compiled programs available\n";
+	std::cout << "evaluating total degree homotopies of dense systems of degree " << degree << ", " << num_evaluations << " times each\n\n";
+	std::cout << "vars\ttype\tinstructions\tinterpreted (us)\tcompiled (us)\tspeedup\n";
+
+	for (unsigned num_vars = 2; num_vars <= max_num_vars; num_vars *= 2)
+	{
+		auto homotopy = benchmark::TotalDegreeHomotopy(benchmark::RandomDenseSystem(num_vars, degree));
+		homotopy.precision(digits);
+
+		auto interpreted = StraightLineProgram(homotopy);
+		interpreted.precision(digits);
+
+		auto generated = CompiledSLPRegistry::Find(interpreted.Fingerprint());
+		if (!generated)
+		{
+			std::cout << num_vars << "\tno compiled program generated, skipping\n";
+			continue;
+		}
+
+		auto compiled = interpreted;
+		compiled.UseCompiled(*generated);
+
+		Compare<dbl>(interpreted, compiled, num_evaluations, "double");
+		Compare<mpfr_complex>(interpreted, compiled, num_evaluations, "mpfr" + std::to_string(digits));
+	}
+
+	return 0;
+}
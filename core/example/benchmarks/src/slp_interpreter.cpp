@@ -0,0 +1,89 @@
+// Compares the two interpreters for straight-line programs: the packed, threaded one used by StraightLineProgram::Eval, and the plain switch-in-a-loop one, StraightLineProgram::EvalUnpacked.
+//
+// The programs are compiled from total degree homotopies for dense random systems, and evaluated in double and multiple precision.
+//
+// usage: slp_interpreter [max_num_variables] [degree] [num_evaluations] [digits]
+
+#include "benchmark_systems.hpp"
+
+#include <bertini2/system/start_systems.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+	using namespace bertini;
+
+	System TotalDegreeHomotopy(System target)
+	{
+		target.Homogenize();
+		target.AutoPatch();
+
+		auto start = start_system::TotalDegree(target);
+
+		auto t = MakeVariable("t");
+		System homotopy = (1-t)*target + MakeRational(node::Rational::Rand())*t*start;
+		homotopy.AddPathVariable(t);
+		return homotopy;
+	}
+
+
+	template<typename ComplexT, typename EvalT>
+	double MicrosecondsPerEvaluation(EvalT const& eval, unsigned num_evaluations)
+	{
+		eval(); // warm up
+
+		auto start = std::chrono::steady_clock::now();
+		for (unsigned ii=0; ii<num_evaluations; ++ii)
+			eval();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / num_evaluations * 1e6;
+	}
+
+
+	template<typename ComplexT>
+	void Compare(StraightLineProgram const& slp, unsigned num_evaluations, std::string const& label)
+	{
+		// put values of the inputs into memory
+		slp.Eval(RandomOfUnits<ComplexT>(slp.NumVariables()), RandomUnit<ComplexT>());
+
+		auto unpacked = MicrosecondsPerEvaluation<ComplexT>([&](){ slp.EvalUnpacked<ComplexT>(); }, num_evaluations);
+		auto packed = MicrosecondsPerEvaluation<ComplexT>([&](){ slp.Eval<ComplexT>(); }, num_evaluations);
+
+		std::cout << slp.NumVariables() << '\t' << label << '\t' << slp.NumInstructions() << '\t' << slp.NumPackedInstructions() << "\t\t" << unpacked << '\t' << packed << '\t' << unpacked/packed << '\n';
+	}
+
+}
+
+
+int main(int argc, char** argv)
+{
+	unsigned max_num_vars = argc > 1 ? std::atoi(argv[1]) : 16;
+	unsigned degree = argc > 2 ? std::atoi(argv[2]) : 3;
+	unsigned num_evaluations = argc > 3 ? std::atoi(argv[3]) : 1000;
+	unsigned digits = argc > 4 ? std::atoi(argv[4]) : 30;
+
+	DefaultPrecision(digits);
+
+#ifdef BERTINI_SLP_COMPUTED_GOTO
+	std::cout << "packed interpreter dispatches by computed goto\n\n";
+#else
+	std::cout << "packed interpreter dispatches by switch\n\n";
+#endif
+
+	std::cout << "vars\tnumbers\tinstr\tpacked instr\tunpacked (us)\tpacked (us)\tspeedup\n";
+
+	for (unsigned num_vars = 2; num_vars <= max_num_vars; num_vars *= 2)
+	{
+		auto homotopy = TotalDegreeHomotopy(benchmark::RandomDenseSystem(num_vars, degree));
+		homotopy.precision(digits);
+
+		auto slp = StraightLineProgram(homotopy);
+
+		Compare<dbl>(slp, num_evaluations, "double");
+		Compare<mpfr_complex>(slp, num_evaluations, "mpfr" + std::to_string(digits));
+	}
+
+	return 0;
+}
@@ -0,0 +1,79 @@
+// Reports how much the SLPCompiler's optimization shrinks straight-line programs, and how much faster they evaluate.
+//
+// The programs are compiled from total degree homotopies for dense random systems, whose large Jacobians repeat many subexpressions.
+//
+// usage: slp_optimization [max_num_variables] [degree] [num_evaluations]
+
+#include "benchmark_systems.hpp"
+
+#include <bertini2/system/start_systems.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+	using namespace bertini;
+
+	System TotalDegreeHomotopy(System target)
+	{
+		target.Homogenize();
+		target.AutoPatch();
+
+		auto start = start_system::TotalDegree(target);
+
+		auto t = MakeVariable("t");
+		System homotopy = (1-t)*target + MakeRational(node::Rational::Rand())*t*start;
+		homotopy.AddPathVariable(t);
+		return homotopy;
+	}
+
+
+	double MicrosecondsPerEvaluation(StraightLineProgram const& slp, unsigned num_variables, unsigned num_evaluations)
+	{
+		Vec<dbl> x = RandomOfUnits<dbl>(num_variables);
+		dbl t = RandomUnit<dbl>();
+
+		auto start = std::chrono::steady_clock::now();
+		for (unsigned ii=0; ii<num_evaluations; ++ii)
+		{
+			x(0) += dbl(1e-10); // so every evaluation is at a different point
+			slp.Eval(x, t);
+		}
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / num_evaluations * 1e6;
+	}
+
+}
+
+
+int main(int argc, char** argv)
+{
+	unsigned max_num_vars = argc > 1 ? std::atoi(argv[1]) : 16;
+	unsigned degree = argc > 2 ? std::atoi(argv[2]) : 3;
+	unsigned num_evaluations = argc > 3 ? std::atoi(argv[3]) : 1000;
+
+	std::cout << "optimizing straight-line programs for total degree homotopies of dense systems of degree " << degree << "\n\n";
+	std::cout << "vars\tinstructions\t\tmemory\t\t\tnumbers\t\tevaluation (us)\n";
+
+	for (unsigned num_vars = 2; num_vars <= max_num_vars; num_vars *= 2)
+	{
+		auto homotopy = TotalDegreeHomotopy(benchmark::RandomDenseSystem(num_vars, degree));
+
+		auto plain = StraightLineProgram(homotopy, false);
+		auto optimized = StraightLineProgram(homotopy);
+
+		auto const& r = optimized.GetOptimizationReport();
+
+		auto plain_us = MicrosecondsPerEvaluation(plain, homotopy.NumVariables(), num_evaluations);
+		auto optimized_us = MicrosecondsPerEvaluation(optimized, homotopy.NumVariables(), num_evaluations);
+
+		std::cout << num_vars << '\t'
+		          << r.InstructionsBefore << " -> " << r.InstructionsAfter << "\t\t"
+		          << r.MemoryBefore << " -> " << r.MemoryAfter << "\t\t"
+		          << r.NumbersBefore << " -> " << r.NumbersAfter << "\t\t"
+		          << plain_us << " -> " << optimized_us << '\n';
+	}
+
+	return 0;
+}
@@ -0,0 +1,106 @@
+// Compares evaluating a homotopy through its function tree with evaluating it through a straight-line program.
+//
+// Each evaluation computes what a tracker needs at a point: the function values, the Jacobian, and the time derivative.
+// The homotopies are total degree homotopies for dense random systems, homogenized and patched as in the zero dim algorithm.
+//
+// usage: slp_vs_tree [max_num_variables] [degree] [num_evaluations] [digits]
+
+#include "benchmark_systems.hpp"
+
+#include <bertini2/system/start_systems.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+	using namespace bertini;
+
+	/**
+	\brief Form the homotopy from a total degree start system to a target system, the same way the zero dim algorithm does.
+	*/
+	System TotalDegreeHomotopy(System target)
+	{
+		target.Homogenize();
+		target.AutoPatch();
+
+		auto start = start_system::TotalDegree(target);
+
+		auto t = MakeVariable("t");
+		System homotopy = (1-t)*target + MakeRational(node::Rational::Rand())*t*start;
+		homotopy.AddPathVariable(t);
+		return homotopy;
+	}
+
+
+	/**
+	\brief Time evaluating functions, Jacobian and time derivative at a sequence of points, returning the seconds per evaluation.
+	*/
+	template<typename ComplexT>
+	double SecondsPerEvaluation(System const& sys, std::vector<Vec<ComplexT>> const& points, ComplexT const& t, unsigned num_evaluations)
+	{
+		Vec<ComplexT> f(sys.NumTotalFunctions());
+		Mat<ComplexT> J(sys.NumTotalFunctions(), sys.NumVariables());
+		Vec<ComplexT> dt(sys.NumTotalFunctions());
+
+		auto start = std::chrono::steady_clock::now();
+		for (unsigned ii=0; ii<num_evaluations; ++ii)
+		{
+			sys.SetAndReset(points[ii % points.size()], t);
+			sys.EvalInPlace(f);
+			sys.JacobianInPlace(J);
+			sys.TimeDerivativeInPlace(dt);
+		}
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / num_evaluations;
+	}
+
+
+	template<typename ComplexT>
+	void Compare(System & tree, System & slp, unsigned num_evaluations, std::string const& label)
+	{
+		std::vector<Vec<ComplexT>> points(10);
+		for (auto& p : points)
+			p = RandomOfUnits<ComplexT>(tree.NumVariables());
+		ComplexT t = RandomUnit<ComplexT>();
+
+		// warm up, and do the lazy setup, so it doesn't count towards the timings
+		SecondsPerEvaluation(tree, points, t, 1);
+		SecondsPerEvaluation(slp, points, t, 1);
+
+		auto tree_seconds = SecondsPerEvaluation(tree, points, t, num_evaluations);
+		auto slp_seconds = SecondsPerEvaluation(slp, points, t, num_evaluations);
+
+		std::cout << tree.NumVariables() << '\t' << label << '\t' << tree_seconds*1e6 << '\t' << slp_seconds*1e6 << '\t' << tree_seconds/slp_seconds << '\n';
+	}
+
+}
+
+
+int main(int argc, char** argv)
+{
+	unsigned max_num_vars = argc > 1 ? std::atoi(argv[1]) : 8;
+	unsigned degree = argc > 2 ? std::atoi(argv[2]) : 3;
+	unsigned num_evaluations = argc > 3 ? std::atoi(argv[3]) : 1000;
+	unsigned digits = argc > 4 ? std::atoi(argv[4]) : 30;
+
+	DefaultPrecision(digits);
+
+	std::cout << "evaluating total degree homotopies of dense systems of degree " << degree << ", " << num_evaluations << " times each\n";
+	std::cout << "each evaluation computes functions, Jacobian, and time derivative\n\n";
+	std::cout << "vars\tnumbers\ttree (us)\tslp (us)\tspeedup\n";
+
+	for (unsigned num_vars = 2; num_vars <= max_num_vars; num_vars *= 2)
+	{
+		auto tree = TotalDegreeHomotopy(benchmark::RandomDenseSystem(num_vars, degree));
+		tree.precision(digits);
+
+		auto slp = tree;
+		slp.SetEvalMethod(EvalMethod::StraightLineProgram);
+
+		Compare<dbl>(tree, slp, num_evaluations, "double");
+		Compare<mpfr_complex>(tree, slp, num_evaluations, "mpfr" + std::to_string(digits));
+	}
+
+	return 0;
+}
@@ -0,0 +1,125 @@
+// Counts the heap allocations made by a step of path tracking -- a prediction with error estimate, then a Newton correction, both with the adaptive precision criteria -- in double and multiple precision.
+//
+// The predictor and corrector keep their workspaces across steps, so after the first step, a step in double precision allocates nothing, and the benchmark fails if one does.  In multiple precision steps still allocate: the vectors and matrices are kept, but every scalar temporary made by the arithmetic itself is a new mpfr number.  So a step in multiple precision is instead held to the allocations of a bounded number of evaluations and linear solves, into storage made beforehand, and the benchmark fails if it makes more -- as it would if the workspaces were made afresh every step again.
+//
+// Allocations are counted by wrapping malloc, so this only counts on glibc.
+//
+// usage: step_allocations [num_variables] [degree] [num_steps] [digits]
+
+#include "allocation_counting.hpp"
+#include "benchmark_systems.hpp"
+
+#include <bertini2/trackers/explicit_predictors.hpp>
+#include <bertini2/trackers/newton_corrector.hpp>
+#include <bertini2/trackers/config.hpp>
+
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+	using namespace bertini;
+	using namespace bertini::tracking;
+
+	template<typename ComplexT>
+	double AllocationsPerStep(System const& homotopy, unsigned num_steps)
+	{
+		predict::ExplicitRKPredictor predictor(Predictor::HeunEuler, homotopy);
+		correct::NewtonCorrector corrector(homotopy);
+		auto AMP = AMPConfigFrom(homotopy);
+
+		Vec<ComplexT> current_space = RandomOfUnits<ComplexT>(homotopy.NumVariables());
+		Vec<ComplexT> predicted(homotopy.NumVariables()), corrected(homotopy.NumVariables());
+		ComplexT current_time(1), delta_t(-0.01), next_time(0.99);
+		NumErrorT tol(1e-5), error_estimate, size_proportion, norm_J, norm_J_inverse, condition_number_estimate, norm_delta_z;
+		unsigned num_steps_since_last_condition_number_computation = 1;
+
+		auto Step = [&]{
+			predictor.Predict(predicted, error_estimate, size_proportion, norm_J, norm_J_inverse, homotopy, current_space, current_time, delta_t, condition_number_estimate, num_steps_since_last_condition_number_computation, 1, tol, AMP);
+			corrector.Correct(corrected, norm_delta_z, norm_J, norm_J_inverse, condition_number_estimate, homotopy, predicted, next_time, tol, 1, 3, AMP);
+		};
+
+		Step(); // the first step may size the workspaces
+
+		const auto before = benchmark::NumAllocations();
+		for (unsigned ii=0; ii<num_steps; ++ii)
+			Step();
+		return double(benchmark::NumAllocations() - before) / num_steps;
+	}
+
+
+	// the allocations of evaluating the homotopy, its Jacobian and time derivative, and solving with the Jacobian, into storage made beforehand.  these are the allocations a step can't avoid, one per scalar temporary
+	template<typename ComplexT>
+	double AllocationsPerSolve(System const& homotopy, unsigned num_solves)
+	{
+		const auto num_vars = homotopy.NumVariables();
+		const auto num_funcs = homotopy.NumFunctions();
+
+		// alternate between two points, so no evaluation is skipped for being at the same point as the last
+		Vec<ComplexT> points[2] = {RandomOfUnits<ComplexT>(num_vars), RandomOfUnits<ComplexT>(num_vars)};
+		Vec<ComplexT> f(num_funcs), dt(num_funcs), delta(num_vars);
+		Mat<ComplexT> J(num_funcs, num_vars);
+		ComplexT time(0.5);
+		Eigen::PartialPivLU<Mat<ComplexT>> lu(num_vars);
+
+		auto Solve = [&](Vec<ComplexT> const& x){
+			homotopy.EvalInPlace(f, x, time);
+			homotopy.JacobianInPlace(J, x, time);
+			homotopy.TimeDerivativeInPlace(dt, x, time);
+			lu.compute(J);
+			delta = lu.solve(f);
+		};
+
+		Solve(points[1]);
+
+		const auto before = benchmark::NumAllocations();
+		for (unsigned ii=0; ii<num_solves; ++ii)
+			Solve(points[ii%2]);
+		return double(benchmark::NumAllocations() - before) / num_solves;
+	}
+
+
+	// how many evaluations and solves a step may make: two stages of Heun-Euler, and at most three Newton iterations, plus slack for the norm and condition number estimates
+	constexpr unsigned kSolvesPerStep = 8;
+
+}
+
+
+int main(int argc, char** argv)
+{
+	unsigned num_vars = argc > 1 ? std::atoi(argv[1]) : 6;
+	unsigned degree = argc > 2 ? std::atoi(argv[2]) : 3;
+	unsigned num_steps = argc > 3 ? std::atoi(argv[3]) : 100;
+	unsigned digits = argc > 4 ? std::atoi(argv[4]) : 30;
+
+	if (!benchmark::CountingAllocations())
+	{
+		std::cout << "allocations can only be counted with glibc\n";
+		return 1;
+	}
+
+	DefaultPrecision(digits);
+	auto homotopy = benchmark::TotalDegreeHomotopy(benchmark::RandomDenseSystem(num_vars, degree));
+	homotopy.precision(digits);
+
+	std::cout << "heap allocations per predictor and corrector step, on the total degree homotopy of a dense system with " << num_vars << " variables of degree " << degree << ", averaged over " << num_steps << " steps\n\n";
+	const auto double_allocations = AllocationsPerStep<dbl>(homotopy, num_steps);
+	const auto mp_allocations = AllocationsPerStep<mpfr_complex>(homotopy, num_steps);
+	const auto mp_bound = kSolvesPerStep * AllocationsPerSolve<mpfr_complex>(homotopy, num_steps);
+	std::cout << "double\t\t" << double_allocations << '\n';
+	std::cout << "mpfr" << digits << "\t\t" << mp_allocations << "\t(at most " << mp_bound << ")\n";
+
+	if (double_allocations > 0)
+	{
+		std::cout << "\nsteps in double precision allocated after the first\n";
+		return 1;
+	}
+
+	if (mp_allocations > mp_bound)
+	{
+		std::cout << "\nsteps in multiple precision allocated more than " << kSolvesPerStep << " evaluations and solves\n";
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,60 @@
+// Measures how the zero dim algorithm scales with the number of threads used for path tracking.
+//
+// usage: zero_dim_scaling [num_variables] [degree] [max_num_threads]
+
+#include "benchmark_systems.hpp"
+
+#include <bertini2/nag_algorithms/zero_dim_solve.hpp>
+#include <bertini2/endgames.hpp>
+#include <bertini2/system/start_systems.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+	using namespace bertini;
+
+	using TrackerT = tracking::DoublePrecisionTracker;
+	using EndgameT = endgame::EndgameSelector<TrackerT>::Cauchy;
+	using ZeroDimConf = algorithm::ZeroDimConfig<dbl>;
+
+	unsigned num_vars = argc > 1 ? std::atoi(argv[1]) : 4;
+	unsigned degree = argc > 2 ? std::atoi(argv[2]) : 3;
+	unsigned max_num_threads = argc > 3 ? std::atoi(argv[3]) : std::max(1u, std::thread::hardware_concurrency());
+
+	auto sys = benchmark::RandomDenseSystem(num_vars, degree);
+
+	auto zd = algorithm::ZeroDim<TrackerT, EndgameT, System, start_system::TotalDegree>(sys);
+	zd.DefaultSetup();
+
+	std::cout << "solving a dense system with " << num_vars << " variables of degree " << degree << "\n\n";
+	std::cout << "threads\tseconds\tspeedup\tefficiency\tsuccessful paths\n";
+
+	double serial_seconds = 0;
+	for (unsigned num_threads = 1; num_threads <= max_num_threads; num_threads *= 2)
+	{
+		auto zd_conf = zd.Get<ZeroDimConf>();
+		zd_conf.num_threads = num_threads;
+		zd.Set(zd_conf);
+
+		auto start = std::chrono::steady_clock::now();
+		zd.Solve();
+		auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		if (num_threads==1)
+			serial_seconds = seconds;
+
+		unsigned num_successes = 0;
+		for (auto const& smd : zd.FinalSolutionMetadata())
+			if (smd.endgame_success==SuccessCode::Success)
+				++num_successes;
+
+		auto speedup = serial_seconds / seconds;
+		std::cout << num_threads << '\t' << seconds << '\t' << speedup << '\t' << speedup/num_threads << "\t\t" << num_successes << '/' << zd.FinalSolutions().size() << '\n';
+	}
+
+	return 0;
+}
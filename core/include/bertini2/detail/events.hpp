@@ -35,9 +35,71 @@
 
 #ifndef BERTINI_DETAIL_EVENTS_HPP
 #define BERTINI_DETAIL_EVENTS_HPP
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
 #include <boost/type_index.hpp>
 namespace bertini {
 
+	namespace detail{
+
+		/**
+		\brief A set of event types, one bit per type.
+
+		Bits are handed out to event types as they are first used, and there are only 64 of them, so two types may share a bit.  A mask is therefore only ever used to rule events out -- if an event's bits miss an observer's mask, the observer certainly doesn't want it.  Whether an event really is of some type is decided by EventCast.
+		*/
+		using EventMask = std::uint64_t;
+
+		/**
+		\brief What an event type knows about itself, so that events can be filtered and cast without RTTI.
+
+		There is exactly one of these for each event type, so its address identifies the type.
+		*/
+		struct EventTypeInfo
+		{
+			EventTypeInfo const* parent; ///< The info of the parent type in the event hierarchy, or null for AnyEvent.
+			EventMask bit; ///< The bit of this type.
+			EventMask mask; ///< The bits of this type and all its ancestors.
+		};
+
+		/**
+		\brief Make the info for a new event type, giving it the next bit.
+		*/
+		inline
+		EventTypeInfo MakeEventTypeInfo(EventTypeInfo const* parent)
+		{
+			static std::atomic<unsigned> num_types{0};
+			const EventMask bit = EventMask(1) << (num_types++ % 64);
+			return {parent, bit, bit | (parent ? parent->mask : 0)};
+		}
+
+		/**
+		\brief The union of the bits of some event types, for subscribing to them and all types derived from them.
+		*/
+		template<typename... EventTs>
+		EventMask EventTypeBits()
+		{
+			EventMask bits = 0;
+			(void) std::initializer_list<int>{(bits |= EventTs::StaticTypeInfo().bit, 0)...};
+			return bits;
+		}
+
+	} // re: namespace detail
+
+	/**
+	\brief Gives an event type its EventTypeInfo.
+
+	Every event type must use this in its body, naming its parent in the event hierarchy, as it must use `BOOST_TYPE_INDEX_REGISTER_CLASS`.  A type which forgets it is indistinguishable from its parent.
+
+	\param event_parenttype The parent of the event type, complete with its template arguments.
+	*/
+	#define BERTINI_REGISTER_EVENT_TYPE(event_parenttype) \
+	public: \
+		static ::bertini::detail::EventTypeInfo const& StaticTypeInfo() \
+		{ static const ::bertini::detail::EventTypeInfo info = ::bertini::detail::MakeEventTypeInfo(&event_parenttype::StaticTypeInfo()); return info; } \
+		::bertini::detail::EventTypeInfo const& TypeInfo() const override \
+		{ return StaticTypeInfo(); }
+
 	/**
 	\brief Strawman Event type, enabling polymorphism.
 
@@ -47,17 +109,57 @@ namespace bertini {
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
 		virtual ~AnyEvent() = default;
+
+		/**
+		\brief The info of the root of the event hierarchy.
+		*/
+		static detail::EventTypeInfo const& StaticTypeInfo()
+		{
+			static const detail::EventTypeInfo info = detail::MakeEventTypeInfo(nullptr);
+			return info;
+		}
+
+		/**
+		\brief The info of the most derived type of this event, for filtering and casting without RTTI.
+		*/
+		virtual detail::EventTypeInfo const& TypeInfo() const
+		{
+			return StaticTypeInfo();
+		}
 	};
 
+
+	/**
+	\brief Cast an event to one of the event types, without RTTI.
+
+	This is the replacement for `dynamic_cast<const EventT*>(&e)` in observers, and walks the (short) chain of parents of the event's type, after ruling most events out with a single test of a bit.
+
+	\tparam EventT The type to cast to.
+	\param e The event to cast.
+	\return A pointer to the event as an `EventT`, or `nullptr` if it isn't one.
+	*/
+	template<typename EventT>
+	EventT const* EventCast(AnyEvent const& e)
+	{
+		auto const& wanted = EventT::StaticTypeInfo();
+		if (!(e.TypeInfo().mask & wanted.bit))
+			return nullptr;
+
+		for (auto info = &e.TypeInfo(); info; info = info->parent)
+			if (info == &wanted)
+				return static_cast<EventT const*>(&e);
+		return nullptr;
+	}
+
 	template<class ObsT, bool IsConst = true>
 	class Event;
 
 	/**
 	\brief For emission of events from observables.
 	
-	An observable object probably wants to emit events to notify observers that things are happening.  The observers filter the events, at this time by dynamic casting (slow, I know, but it works for now.  Premature optimization, etc.)  A better method than dynamic casting would be to filter based on a union of bits or something.  If you, the reader, want to help make this better, please contact a developer!
+	An observable object probably wants to emit events to notify observers that things are happening.  Each event type has a bit, and observers say which types they want with a mask of bits (AnyObserver::Subscriptions), so an event nobody wants is never even made.  The observers then filter the events they do get with EventCast.
 
-	Say I am an observable object, and I want to emit an event.  Events attach the type of object emitting them, and in fact (a refence to) the emitter itself.  So if my type is `T`, I would do something like `NotifyObservers(Event<T>(*this))`.  Then an Observer can filter based on a heirarchy of event types, etc.  
+	Say I am an observable object, and I want to emit an event.  Events attach the type of object emitting them, and in fact (a refence to) the emitter itself.  So if my type is `T`, I would do something like `NotifyObservers<Event<T>>(*this)`.  Then an Observer can filter based on a heirarchy of event types, etc.  
 
 	\tparam ObsT The Observed type.  When emitting an event, you pass in the type of object emitting the event, and the object itself.  Then the observer can `Get` the emitting object, and do (const) stuff to it.
 
@@ -65,7 +167,7 @@ namespace bertini {
 	*/
 	template<class ObsT>
 	class Event<ObsT, true> : public AnyEvent
-	{ BOOST_TYPE_INDEX_REGISTER_CLASS
+	{ BOOST_TYPE_INDEX_REGISTER_CLASS BERTINI_REGISTER_EVENT_TYPE(AnyEvent)
 	public:
 
 		/**
@@ -83,7 +185,7 @@ namespace bertini {
 
 		\return The observable who emitted the event.  This permits calls of arbitrary const functions, particularly getters.
 
-		\see AMPPathAccumulator for simple example of filtering using `dynamic_cast`s
+		\see AMPPathAccumulator for simple example of filtering using EventCast
 		*/
 		ObsT const& Get() const
 		{return current_observable_;}
@@ -99,9 +201,9 @@ namespace bertini {
 	/**
 	\brief For emission of events from observables.
 	
-	An observable object probably wants to emit events to notify observers that things are happening.  The observers filter the events, at this time by dynamic casting (slow, I know, but it works for now.  Premature optimization, etc.)  A better method than dynamic casting would be to filter based on a union of bits or something.  If you, the reader, want to help make this better, please contact a developer!
+	An observable object probably wants to emit events to notify observers that things are happening.  Each event type has a bit, and observers say which types they want with a mask of bits (AnyObserver::Subscriptions), so an event nobody wants is never even made.  The observers then filter the events they do get with EventCast.
 
-	Say I am an observable object, and I want to emit an event.  Events attach the type of object emitting them, and in fact (a refence to) the emitter itself.  So if my type is `T`, I would do something like `NotifyObservers(Event<T>(*this))`.  Then an Observer can filter based on a heirarchy of event types, etc.  
+	Say I am an observable object, and I want to emit an event.  Events attach the type of object emitting them, and in fact (a refence to) the emitter itself.  So if my type is `T`, I would do something like `NotifyObservers<Event<T>>(*this)`.  Then an Observer can filter based on a heirarchy of event types, etc.  
 
 	\tparam ObsT The Observed type.  When emitting an event, you pass in the type of object emitting the event, and the object itself.  Then the observer can `Get` the emitting object, and do (const) stuff to it.
 
@@ -109,7 +211,7 @@ namespace bertini {
 	*/
 	template<class ObsT>
 	class Event<ObsT,false> : public AnyEvent
-	{ BOOST_TYPE_INDEX_REGISTER_CLASS
+	{ BOOST_TYPE_INDEX_REGISTER_CLASS BERTINI_REGISTER_EVENT_TYPE(AnyEvent)
 	public:
 
 		/**
@@ -127,7 +229,7 @@ namespace bertini {
 
 		\return The observable who emitted the event.  This permits calls of arbitrary const functions, particularly getters.
 
-		\see AMPPathAccumulator for simple example of filtering using `dynamic_cast`s
+		\see AMPPathAccumulator for simple example of filtering using EventCast
 		*/
 		ObsT & Get()
 		{return current_observable_;}
@@ -154,6 +256,7 @@ namespace bertini {
 	#define ADD_BERTINI_EVENT_TYPE(event_name,event_parenttype) template<class ObservedT> \
 	class event_name : public event_parenttype<ObservedT> \
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS \
+		BERTINI_REGISTER_EVENT_TYPE(event_parenttype<ObservedT>) \
 	public: \
 		using HeldT = typename event_parenttype<ObservedT>::HeldT; \
 		event_name(HeldT obs) : event_parenttype<ObservedT>(obs){} \
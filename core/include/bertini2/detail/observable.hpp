@@ -32,6 +32,11 @@
 #ifndef BERTINI_DETAIL_OBSERVABLE_HPP
 #define BERTINI_DETAIL_OBSERVABLE_HPP
 
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
 #include "bertini2/detail/observer.hpp"
 #include "bertini2/detail/events.hpp"
 
@@ -41,6 +46,8 @@ namespace bertini{
 	\brief An abstract observable type, maintaining a list of observers, who can be notified in case of Events.
 	
 	Some known observable types are Tracker and Endgame.
+
+	The observable keeps the union of its observers' subscriptions, so that emitting an event which no observer wants -- in particular, any event while no observer is attached -- costs one test of a bit, and the event is never made.
 	*/
 	class Observable
 	{	
@@ -55,9 +62,11 @@ namespace bertini{
 		void AddObserver(AnyObserver& new_observer) const
 		{
 			if (find_if(begin(current_watchers_), end(current_watchers_), [&](const auto& held_obs)
-			                              { return &held_obs.get() == &new_observer; })==end(current_watchers_))
-				
-				current_watchers_.push_back(std::ref(new_observer));
+			                              { return &held_obs.observer.get() == &new_observer; })==end(current_watchers_))
+			{
+				current_watchers_.push_back({std::ref(new_observer), new_observer.Subscriptions()});
+				subscriptions_ |= current_watchers_.back().subscriptions;
+			}
 		}
 
 		/**
@@ -68,44 +77,92 @@ namespace bertini{
 
 			auto new_end = std::remove_if(current_watchers_.begin(), current_watchers_.end(),
 			                              [&](const auto& held_obs)
-			                              { return &held_obs.get() == &observer; });
+			                              { return &held_obs.observer.get() == &observer; });
 
 			current_watchers_.erase(new_end, current_watchers_.end());
 
+			subscriptions_ = 0;
+			for (const auto& held_obs : current_watchers_)
+				subscriptions_ |= held_obs.subscriptions;
+
 
 			// current_watchers_.erase(std::remove(current_watchers_.begin(), current_watchers_.end(), std::ref(observer)), current_watchers_.end());
 		}
 
+		/**
+		\brief Remove all observers from this observable.
+
+		Copies of an observable are watched by the same observers as the original.  Use this to get a copy that is watched by no-one, for instance before handing it to another thread.
+		*/
+		void RemoveAllObservers() const
+		{
+			current_watchers_.clear();
+			subscriptions_ = 0;
+		}
+
 	protected:
 
 		/**
-		\brief Sends an Event (more particularly, AnyEvent) to all watching observers of this object.
+		\brief Whether any watching observer wants events of a type.
 
-		This function could potentially be improved by filtering on the observer's desired event types, if known at compile time.  This could potentially be a performance bottleneck (hopefully not!) since filtering can use `dynamic_cast`ing.  One hopes this cost is overwhelmed by things like linear algebra and system evaluation.
+		\tparam EventT The type of event.
+		*/
+		template<typename EventT>
+		bool AnyObserverWants() const
+		{
+			return subscriptions_ & EventT::StaticTypeInfo().mask;
+		}
 
-		\param e The event to emit.  Its type should be derived from AnyEvent.
+		/**
+		\brief Makes and sends an event to the watching observers who want it, if there are any.
+
+		This is the way to emit events, as in `NotifyObservers<NewStep<EmitterType>>(*this)`.  If no observer wants the event, it isn't made, so its constructor arguments should be cheap to pass -- references to things which exist anyway.
+
+		\tparam EventT The type of event to emit.  Its type should be derived from AnyEvent.
+		\param args The arguments for the event's constructor, starting with the emitting object.
 		*/
-		void NotifyObservers(AnyEvent const& e) const
+		template<typename EventT, typename... ArgTs>
+		void NotifyObservers(ArgTs&&... args) const
 		{
+			if (!AnyObserverWants<EventT>())
+				return;
 
-			for (auto& obs : current_watchers_)
-				obs.get().Observe(e);
+			EventT e(std::forward<ArgTs>(args)...);
+			NotifyObservers(e);
+		}
 
+		/**
+		\brief Sends an Event (more particularly, AnyEvent) to the watching observers of this object who want it.
+
+		\param e The event to emit.  Its type should be derived from AnyEvent.
+		*/
+		void NotifyObservers(AnyEvent const& e) const
+		{
+			const auto mask = e.TypeInfo().mask;
+			// by index, since an observer may remove itself while observing
+			for (std::size_t ii = 0; ii < current_watchers_.size(); ++ii)
+				if (current_watchers_[ii].subscriptions & mask)
+					current_watchers_[ii].observer.get().Observe(e);
 		}
 
 		void NotifyObservers(AnyEvent & e) const
 		{
-
-			for (auto& obs : current_watchers_)
-				obs.get().Observe(e);
+			NotifyObservers(static_cast<AnyEvent const&>(e));
 		}
 
 
 	private:
 
-		using ObserverContainer = std::vector<std::reference_wrapper<AnyObserver>>;
+		struct Watcher
+		{
+			std::reference_wrapper<AnyObserver> observer;
+			detail::EventMask subscriptions; ///< The observer's subscriptions, as of when it was added.
+		};
+
+		using ObserverContainer = std::vector<Watcher>;
 
 		mutable ObserverContainer current_watchers_;
+		mutable detail::EventMask subscriptions_ = 0; ///< The union of the subscriptions of the watchers.
 	};
 
 } // namespace bertini
@@ -63,6 +63,20 @@ namespace bertini{
 		\param e The event which was emitted by the observed object.
 		*/
 		virtual void Observe(AnyEvent const& e) = 0;
+
+		/**
+		\brief The event types this observer wants to observe, as a mask of bits of event types.
+
+		Observables only make and send events whose types, or the types they derive from, are in the mask, so an observer which narrows this costs the observable nothing for the other events.  By default, an observer wants every event.
+
+		The mask is read when the observer is added to an observable, so must not change while the observer is attached.
+
+		\see detail::EventTypeBits
+		*/
+		virtual detail::EventMask Subscriptions() const
+		{
+			return detail::EventTypeBits<AnyEvent>();
+		}
 	};
 
 
@@ -113,6 +127,16 @@ namespace bertini{
 		    for_each(observers_, f);
 		}
 
+		/**
+		\brief The union of the subscriptions of the types you glued together.
+		*/
+		detail::EventMask Subscriptions() const override
+		{
+			detail::EventMask mask = 0;
+			boost::fusion::for_each(observers_, [&mask](auto const& obs) { mask |= obs.Subscriptions(); });
+			return mask;
+		}
+
 		std::tuple<ObserverTypes<ObservedT>...> observers_;
 		virtual ~MultiObserver() = default;
 	};
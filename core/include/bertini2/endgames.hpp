@@ -36,6 +36,7 @@
 
 #include "bertini2/endgames/powerseries.hpp"
 #include "bertini2/endgames/cauchy.hpp"
+#include "bertini2/endgames/parallel.hpp"
 
 #include "bertini2/endgames/observers.hpp"
 
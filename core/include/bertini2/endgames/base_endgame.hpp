@@ -36,6 +36,7 @@
 */
 
 #include <iostream>
+#include <random>
 #include <typeinfo>
 
 
@@ -57,6 +58,30 @@
 
 namespace bertini{ namespace endgame {
 
+
+/**
+\brief A random vector for estimating the cycle number of one path, seeded by the index of the path.
+
+Made from a generator of its own, at the default precision, so it can be made on any thread, and is the same whichever thread makes it.
+
+\see EndgameBase::SetNextRandVec
+*/
+template<typename CT>
+Vec<CT> PathRandomVector(std::size_t path_index, unsigned size)
+{
+	std::mt19937 generator(path_index);
+	std::uniform_real_distribution<double> distribution(-1,1);
+
+	Vec<CT> v(size);
+	for (unsigned ii = 0; ii < size; ++ii)
+	{
+		const double re = distribution(generator);
+		const double im = distribution(generator);
+		v(ii) = CT(re, im);
+	}
+	return v;
+}
+
 			
 /**
 \class Endgame
@@ -122,6 +147,29 @@ protected:
 	mutable unsigned int cycle_number_ = 0; 
 	mutable NumErrorT approximate_error_;
 
+	/**
+	\brief Random vector used in estimating the cycle number of the path being run.
+	*/
+	mutable Vec<BCT> rand_vector_;
+
+	/**
+	\brief The random vector for the next path run, if given by SetNextRandVec.
+	*/
+	Vec<BCT> next_rand_vector_;
+
+
+	/**
+	\brief Take the random vector for a path being started: the one given by SetNextRandVec, if any, and otherwise a fresh one.
+	*/
+	void StartPathRandVec(int size)
+	{
+		if (next_rand_vector_.size()==size)
+			rand_vector_.swap(next_rand_vector_);
+		else
+			rand_vector_ = Vec<BCT>::Random(size);
+		next_rand_vector_.resize(0);
+	}
+
 
 
 
@@ -154,6 +202,18 @@ public:
 		return this->AsFlavor().RunImpl(start_time, start_point, target_time);
 	}
 
+	/**
+	\brief Give the random vector for estimating the cycle number of the next path run, rather than have the endgame draw one from the shared random number generator when it starts the path.
+
+	Endgames running concurrently must be given their vectors this way, so that no thread draws from the shared generator, and each path gets its vector however the paths are spread over the threads.
+
+	\see PathRandomVector
+	*/
+	void SetNextRandVec(Vec<BCT> v)
+	{
+		next_rand_vector_ = std::move(v);
+	}
+
 	/**
 	\brief Run the endgame, shooting for default time of t=0.
 
@@ -178,7 +238,7 @@ public:
 				// BOOST_LOG_TRIVIAL(severity_level::trace) << "refining failed, code " << int(refine_success);
 				return refine_success;
 			}
-			NotifyObservers(SampleRefined<EmitterType>(AsFlavor()));
+			NotifyObservers<SampleRefined<EmitterType>>(AsFlavor());
 		}
 
 		if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec) // known at compile time
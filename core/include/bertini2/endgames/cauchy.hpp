@@ -212,7 +212,66 @@ protected:
 	
 public:
 
-	
+	/**
+	\brief Everything the endgame computes for the path it was last run on.
+
+	The configuration, tracker and observers of the endgame are not part of this, so moving the state of a finished path out of the endgame, with TakePathState, leaves the endgame ready for the next path.  Running the endgame on many paths concurrently then needs one endgame per thread, rather than one per path.
+
+	\see RunEndgames
+	*/
+	struct PathState
+	{
+		TupleOfTimes pseg_times; ///< The times used for the power series approximation.
+		TupleOfSamps pseg_samples; ///< The samples at pseg_times.
+		TupleOfTimes cauchy_times; ///< The times of the last loops around the target time.
+		TupleOfSamps cauchy_samples; ///< The samples at cauchy_times.
+
+		Vec<BCT> final_approximation; ///< The most recent approximation of the endpoint.
+		Vec<BCT> previous_approximation; ///< The approximation before that.
+		unsigned cycle_number = 0; ///< The cycle number of the path.
+		NumErrorT approximate_error = 0; ///< The difference between the last two approximations.
+	};
+
+
+	/**
+	\brief Move the state of the path the endgame was last run on out of the endgame.
+
+	The endgame's samples and approximations are left empty, and its cycle number 0, as before being run.
+	*/
+	PathState TakePathState()
+	{
+		PathState state;
+		state.pseg_times = std::move(pseg_times_);
+		state.pseg_samples = std::move(pseg_samples_);
+		state.cauchy_times = std::move(cauchy_times_);
+		state.cauchy_samples = std::move(cauchy_samples_);
+		state.final_approximation = std::move(this->final_approximation_);
+		state.previous_approximation = std::move(this->previous_approximation_);
+		state.cycle_number = this->cycle_number_;
+		state.approximate_error = this->approximate_error_;
+
+		ClearTimesAndSamples<BCT>();
+		this->final_approximation_ = Vec<BCT>();
+		this->previous_approximation_ = Vec<BCT>();
+		this->cycle_number_ = 0;
+		return state;
+	}
+
+
+	/**
+	\brief Move the state of a path into the endgame, as though it had just been run on that path, for instance to look at it through the getters.
+	*/
+	void SetPathState(PathState state)
+	{
+		pseg_times_ = std::move(state.pseg_times);
+		pseg_samples_ = std::move(state.pseg_samples);
+		cauchy_times_ = std::move(state.cauchy_times);
+		cauchy_samples_ = std::move(state.cauchy_samples);
+		this->final_approximation_ = std::move(state.final_approximation);
+		this->previous_approximation_ = std::move(state.previous_approximation);
+		this->cycle_number_ = state.cycle_number;
+		this->approximate_error_ = state.approximate_error;
+	}
 
 
 	/**
@@ -415,7 +474,7 @@ public:
 				return tracking_success;
 			}
 
-			NotifyObservers(CircleAdvanced<EmitterType>(*this, next_sample, next_time));
+			this->template NotifyObservers<CircleAdvanced<EmitterType>>(*this, next_sample, next_time);
 			
 
 			this->EnsureAtPrecision(next_time,Precision(next_sample)); assert(Precision(next_time)==Precision(next_sample));
@@ -485,7 +544,10 @@ public:
 		const Vec<CT> & sample1 = pseg_samples[1];
 		const Vec<CT> & sample2 = pseg_samples[2];
 
-		Vec<CT> rand_vector = Vec<CT>::Random(sample0.size()); //should be a row vector for ease in multiplying.
+		// one per path, taken when the path is started.  only drawn here when estimating outside of a run
+		if (this->rand_vector_.size()!=sample0.size())
+			this->rand_vector_ = Vec<CT>::Random(sample0.size());
+		const Vec<CT>& rand_vector = this->rand_vector_;
 
 
 		// //DO NOT USE Eigen .dot() it will do conjugate transpose which is not what we want.
@@ -750,7 +812,7 @@ public:
 				{
 					if (CheckClosedLoop<CT>())
 					{//error is small enough, exit the loop with success. 
-						NotifyObservers(ClosedLoop<EmitterType>(*this));
+						this->template NotifyObservers<ClosedLoop<EmitterType>>(*this);
 						initial_cauchy_loop_success = SuccessCode::Success;
 						loop_hasnt_closed = false;
 						break;
@@ -892,7 +954,7 @@ public:
 
 		}//end while
 
-		NotifyObservers(InEGOperatingZone<EmitterType>(*this));
+		this->template NotifyObservers<InEGOperatingZone<EmitterType>>(*this);
 
 		return SuccessCode::Success;
 	}
@@ -991,7 +1053,7 @@ public:
 				return SuccessCode::Success;
 			}
 		} 
-		NotifyObservers(CycleNumTooHigh<EmitterType>(*this));
+		this->template NotifyObservers<CycleNumTooHigh<EmitterType>>(*this);
 		return SuccessCode::CycleNumTooHigh;
 	}//end ComputeCauchySamples
 
@@ -1025,14 +1087,14 @@ public:
 		auto time_advance_success = this->GetTracker().TrackPath(next_sample,current_time, next_time, current_sample);
 		if (time_advance_success != SuccessCode::Success)
 		{
-			NotifyObservers(EndgameFailure<EmitterType>(*this));
+			this->template NotifyObservers<EndgameFailure<EmitterType>>(*this);
 			return time_advance_success;
 		}
 
 		this->EnsureAtPrecision(next_time,Precision(next_sample));
 		RotateOntoPS(next_time, next_sample);
 
-		NotifyObservers(TimeAdvanced<EmitterType>(*this));
+		this->template NotifyObservers<TimeAdvanced<EmitterType>>(*this);
 		return SuccessCode::Success;
 	}
 
@@ -1083,6 +1145,7 @@ public:
 
 		ClearTimesAndSamples<CT>(); //clear times and samples before we begin.
 		this->CycleNumber(0);
+		this->StartPathRandVec(start_point.size()); // for estimating C over K
 		prev_approx = start_point;
 		
 		auto init_success = GetIntoEGZone(start_time, start_point, target_time);
@@ -1108,11 +1171,11 @@ public:
 				return extrapolation_success;
 
 			approx_error = static_cast<NumErrorT>((latest_approx - prev_approx).template lpNorm<Eigen::Infinity>());
-			NotifyObservers(ApproximatedRoot<EmitterType>(*this));
+			this->template NotifyObservers<ApproximatedRoot<EmitterType>>(*this);
 
 			if (approx_error < this->FinalTolerance())
 			{
-				NotifyObservers(Converged<EmitterType>(*this));
+				this->template NotifyObservers<Converged<EmitterType>>(*this);
 				return SuccessCode::Success;
 			}
 
@@ -1123,7 +1186,7 @@ public:
 				if (norm_of_dehom_prev   > this->SecuritySettings().max_norm &&  
 					norm_of_dehom_latest > this->SecuritySettings().max_norm  )
 				{
-					NotifyObservers(SecurityMaxNormReached<EmitterType>(*this));
+					this->template NotifyObservers<SecurityMaxNormReached<EmitterType>>(*this);
 					return SuccessCode::SecurityMaxNormReached;
 				}
 			}
@@ -90,7 +90,7 @@ namespace bertini {
 	*/
 	template<class ObservedT>
 	class CircleAdvanced : public EndgameEvent<ObservedT>
-	{ BOOST_TYPE_INDEX_REGISTER_CLASS
+	{ BOOST_TYPE_INDEX_REGISTER_CLASS BERTINI_REGISTER_EVENT_TYPE(EndgameEvent<ObservedT>)
 	public:
 
 		using CT = typename ObservedT::BaseComplexType;
@@ -150,7 +150,7 @@ namespace bertini {
 
 	template<class ObservedT>
 	class PrecisionChanged : public EndgameEvent<ObservedT>
-	{ BOOST_TYPE_INDEX_REGISTER_CLASS
+	{ BOOST_TYPE_INDEX_REGISTER_CLASS BERTINI_REGISTER_EVENT_TYPE(EndgameEvent<ObservedT>)
 	public:
 		/**
 		\brief The constructor for a PrecisionChanged Event.
@@ -58,45 +58,45 @@ virtual ~GoryDetailLogger() = default;
 
 virtual void Observe(AnyEvent const& e) override
 {
-	if(auto p = dynamic_cast<const TimeAdvanced<EmitterT>*>(&e))
+	if(auto p = EventCast<TimeAdvanced<EmitterT>>(e))
 	{
 		BOOST_LOG_TRIVIAL(severity_level::debug) << "time advanced " << p->Get().LatestTime();
 	}
 	
-	else if (auto p = dynamic_cast<const SampleRefined<EmitterT>*>(&e))
+	else if (auto p = EventCast<SampleRefined<EmitterT>>(e))
 	{
 		BOOST_LOG_TRIVIAL(severity_level::debug) << "refined a sample, huzzah";
 	}
 
-	else if (auto p = dynamic_cast<const CircleAdvanced<EmitterT>*>(&e))
+	else if (auto p = EventCast<CircleAdvanced<EmitterT>>(e))
 	{
 		BOOST_LOG_TRIVIAL(severity_level::debug) << "advanced around the circle, to " << p->NewSample()<< " at time " << p->NewTime();
 	}
 
-	else if (auto p = dynamic_cast<const ClosedLoop<EmitterT>*>(&e))
+	else if (auto p = EventCast<ClosedLoop<EmitterT>>(e))
 	{
 		BOOST_LOG_TRIVIAL(severity_level::debug) << "closed a loop, cycle number " << p->Get().CycleNumber();
 	}
-	else if (auto p = dynamic_cast<const ApproximatedRoot<EmitterT>*>(&e))
+	else if (auto p = EventCast<ApproximatedRoot<EmitterT>>(e))
 	{
 		BOOST_LOG_TRIVIAL(severity_level::debug) << "approximated the target root.  approximation " << p->Get().template FinalApproximation<BCT>() << " with error " << p->Get().ApproximateError();
 	}
 
-	else if (auto p = dynamic_cast<const PrecisionChanged<AMPEndgame>*>(&e))
+	else if (auto p = EventCast<PrecisionChanged<AMPEndgame>>(e))
 	{
 		BOOST_LOG_TRIVIAL(severity_level::debug) << "precision changed from  " << p->Previous() << " to " << p->Next();
 	}
 
-	else if (auto p = dynamic_cast<const InEGOperatingZone<EmitterT>*>(&e))
+	else if (auto p = EventCast<InEGOperatingZone<EmitterT>>(e))
 	{
 		BOOST_LOG_TRIVIAL(severity_level::debug) << "made it to the endgame operating zone at time " << p->Get().LatestTime();
 	}
 
-	else if(auto p = dynamic_cast<const Converged<EmitterT>*>(&e))
+	else if(auto p = EventCast<Converged<EmitterT>>(e))
 	{
 		BOOST_LOG_TRIVIAL(severity_level::debug) << "converged at time " << p->Get().LatestTime() << " with result " << p->Get().template FinalApproximation<BCT>() << " and residual " << p->Get().ApproximateError();
 	}
-	else if (auto p = dynamic_cast<const Initializing<EmitterT>*>(&e))
+	else if (auto p = EventCast<Initializing<EmitterT>>(e))
 	{
 		BOOST_LOG_TRIVIAL(severity_level::debug) << "starting running " << boost::typeindex::type_id<EmitterT>().pretty_name();
 	}
@@ -0,0 +1,134 @@
+//This file is part of Bertini 2.
+//
+//bertini2/endgames/parallel.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/endgames/parallel.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/endgames/parallel.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+/**
+\file bertini2/endgames/parallel.hpp
+
+\brief Provides running an endgame on many paths at once, spread over threads.
+*/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "bertini2/endgames/base_endgame.hpp"
+#include "bertini2/parallel/thread_pool.hpp"
+
+namespace bertini{ namespace endgame{
+
+	/**
+	\brief The outcome of running an endgame on one path.
+
+	\tparam EndgameT The type of endgame run.  Must provide a movable PathState, as CauchyEndgame does.
+	*/
+	template<typename EndgameT>
+	struct EndgamePathResult
+	{
+		SuccessCode success = SuccessCode::NeverStarted; ///< What Run returned for the path.
+		typename EndgameT::PathState state; ///< The state of the endgame when it finished the path.
+	};
+
+
+
+	/**
+	\brief Run an endgame on many paths, spread over threads.
+
+	Each thread owns a clone of the endgame's system, a copy of its tracker tracking on that clone, and a copy of the endgame using that tracker.  These are made once, and each reused for all the paths that thread runs, the state of each path being moved out of the thread's endgame by TakePathState when it finishes.
+
+	Since every path is run from scratch, and its result stored by its index, the results are the same regardless of the number of threads, and of which thread ran which path.  To make sure of this, the copied trackers re-initialize their step size for every path, and each path's endgame estimates its cycle number with a random vector seeded by the index of the path, made by PathRandomVector.  Nothing run on the threads draws from the shared random number generators.  The copies have no observers, so observers attached to the endgame or its tracker do not see the paths run here.
+
+	\param endgame The endgame to run, already associated to a tracker, itself associated to the homotopy.  Its configuration is copied to every thread.
+	\param start_time The time at which to start the endgame on every path.
+	\param start_points The points at start_time from which to run the endgame, one per path.
+	\param target_time The time at which to approximate the endpoints.
+	\param num_threads The number of threads to run with.  0 means as many as the hardware supports.
+
+	\return For each start point, in order, the success code and the state of the endgame for that path.
+	*/
+	template<typename EndgameT>
+	std::vector<EndgamePathResult<EndgameT>> RunEndgames(EndgameT const& endgame, typename EndgameT::BaseComplexType const& start_time, std::vector<Vec<typename EndgameT::BaseComplexType>> const& start_points, typename EndgameT::BaseComplexType const& target_time, unsigned num_threads = 1)
+	{
+		using TrackerT = typename EndgameT::TrackerType;
+		using ComplexT = typename EndgameT::BaseComplexType;
+
+		struct Worker
+		{
+			System system;
+			TrackerT tracker;
+			EndgameT endgame;
+
+			Worker(EndgameT const& eg) :
+				system(Clone(eg.GetSystem())), tracker(eg.GetTracker()), endgame(eg)
+			{
+				system.precision(eg.GetSystem().precision());
+
+				tracker.RemoveAllObservers();
+				tracker.SeparatePredictorCorrector();
+				tracker.ReinitializeInitialStepSize(true);
+				tracker.SetSystem(system);
+
+				endgame.RemoveAllObservers();
+				endgame.SetTracker(tracker);
+			}
+
+			// the tracker and endgame refer to the other members, so no copying
+			Worker(Worker const&) = delete;
+			Worker& operator=(Worker const&) = delete;
+		};
+
+		const auto num_workers = parallel::NumThreads(num_threads);
+
+		std::vector<std::unique_ptr<Worker>> workers;
+		workers.reserve(num_workers);
+		for (unsigned ii{0}; ii < num_workers; ++ii)
+			workers.push_back(std::make_unique<Worker>(endgame));
+
+		std::vector<EndgamePathResult<EndgameT>> results(start_points.size());
+
+		parallel::ForEachIndex(start_points.size(), num_workers,
+			[&](unsigned worker_index, std::size_t ii)
+			{
+				auto& worker = *workers[worker_index];
+				auto const& start_point = start_points[ii];
+
+				DefaultPrecision(Precision(start_point));
+				worker.system.precision(Precision(start_point));
+
+				// seeded by the index of the path, rather than drawn from the shared generator, which the threads would race on
+				worker.endgame.SetNextRandVec(PathRandomVector<ComplexT>(ii, start_point.size()));
+
+				// made fresh, so they are in the precision of the start point
+				ComplexT t_start = start_time, t_target = target_time;
+				worker.endgame.EnsureAtPrecision(t_start, Precision(start_point));
+				worker.endgame.EnsureAtPrecision(t_target, Precision(start_point));
+
+				results[ii].success = worker.endgame.Run(t_start, start_point, t_target);
+				results[ii].state = worker.endgame.TakePathState();
+			});
+
+		return results;
+	}
+
+}} // namespaces
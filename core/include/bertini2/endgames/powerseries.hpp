@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "bertini2/endgames/base_endgame.hpp"
 
 
@@ -213,9 +215,11 @@ protected:
 	mutable TupleOfSamps derivatives_;
 
 	/**
-	\brief Random vector used in computing an upper bound on the cycle number. 
+	\brief The times at which the derivatives were computed, in the same order as the derivatives.
+
+	With the precisions of the derivatives, these key the derivatives to the samples, so that ComputeAllDerivatives only computes those it doesn't already have.
 	*/
-	mutable Vec<BCT> rand_vector_;
+	mutable TupleOfTimes derivative_times_;
 
 	template<typename CT>
 	void AssertSizesTimeSpace() const
@@ -247,13 +251,24 @@ public:
 	{
 		std::get<TimeCont<CT> >(times_).clear(); 
 		std::get<SampCont<CT> >(samples_).clear();
+		ClearDerivatives<CT>();
 	}
 
 	/**
-	\brief Function to set the times used for the Power Series endgame.
+	\brief Forget the derivatives computed so far, so that ComputeAllDerivatives computes them all again.
+	*/
+	template<typename CT>
+	void ClearDerivatives()
+	{
+		std::get<SampCont<CT> >(derivatives_).clear();
+		std::get<TimeCont<CT> >(derivative_times_).clear();
+	}
+
+	/**
+	\brief Function to set the times used for the Power Series endgame.  Forgets the derivatives computed so far.
 	*/	
 	template<typename CT>
-	void SetTimes(TimeCont<CT> const& times_to_set) { std::get<TimeCont<CT> >(times_) = times_to_set;}
+	void SetTimes(TimeCont<CT> const& times_to_set) { std::get<TimeCont<CT> >(times_) = times_to_set; ClearDerivatives<CT>();}
 
 	/**
 	\brief Function to get the times used for the Power Series endgame.
@@ -268,10 +283,10 @@ public:
 	}
 
 	/**
-	\brief Function to set the space values used for the Power Series endgame.
+	\brief Function to set the space values used for the Power Series endgame.  Forgets the derivatives computed so far.
 	*/	
 	template<typename CT>
-	void SetSamples(SampCont<CT> const& samples_to_set) { std::get<SampCont<CT> >(samples_) = samples_to_set;}
+	void SetSamples(SampCont<CT> const& samples_to_set) { std::get<SampCont<CT> >(samples_) = samples_to_set; ClearDerivatives<CT>();}
 
 	/**
 	\brief Function to get the space values used for the Power Series endgame.
@@ -283,7 +298,7 @@ public:
 	\brief Function to set the times used for the Power Series endgame.
 	*/	
 	template<typename CT>
-	void SetRandVec(int size) {rand_vector_ = Vec<CT>::Random(size);}
+	void SetRandVec(int size) {this->rand_vector_ = Vec<CT>::Random(size);}
 
 
 
@@ -330,8 +345,8 @@ public:
 
 
 // should this only be if the system is homogenized?
-		CT rand_sum1 = ((sample1 - sample0).transpose()*rand_vector_).sum();
-		CT rand_sum2 = ((sample2 - sample1).transpose()*rand_vector_).sum();
+		CT rand_sum1 = ((sample1 - sample0).transpose()*this->rand_vector_).sum();
+		CT rand_sum2 = ((sample2 - sample1).transpose()*this->rand_vector_).sum();
 
 		if ( abs(rand_sum1)==0 || abs(rand_sum2)==0) // avoid division by 0
 		{
@@ -438,6 +453,8 @@ public:
 
 		##Details:
 				\tparam CT The complex number type.
+				Derivatives are kept from call to call, keyed on the time and precision of their sample.  Advancing the endgame rotates only one new sample in, so only its derivative is computed, along with those of any samples whose precision was raised since.
+				Samples refined again in place keep their derivatives, as refining moves them by less than the refinement tolerance.  Setting the times or samples forgets the derivatives.
 	*/
 	template<typename CT>
 	void ComputeAllDerivatives()
@@ -445,8 +462,10 @@ public:
 		auto& samples = std::get<SampCont<CT> >(samples_);
 		auto& times   = std::get<TimeCont<CT> >(times_);
 		auto& derivatives = std::get<SampCont<CT> >(derivatives_);
+		auto& derivative_times = std::get<TimeCont<CT> >(derivative_times_);
 
 		assert((samples.size() == times.size()) && "must have same number of times and samples");
+		assert((derivatives.size() == derivative_times.size()) && "must have same number of derivatives and times at which they were computed");
 
 		if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec) // known at compile time
 		{
@@ -454,11 +473,27 @@ public:
 			this->GetSystem().precision(max_precision);
 		}
 
-		//Compute dx_dt for each sample.
-		derivatives.clear(); derivatives.resize(samples.size());
+		auto previous_derivatives = std::move(derivatives);
+		auto previous_times = std::move(derivative_times);
+		derivatives.clear(); derivative_times.clear();
+
+		//Compute dx_dt for each sample, unless it was computed before, at the same time and precision.
 		for(unsigned ii = 0; ii < samples.size(); ++ii)
-		{	
-			derivatives[ii] = -this->GetSystem().Jacobian(samples[ii],times[ii]).lu().solve(this->GetSystem().TimeDerivative(samples[ii],times[ii]));
+		{
+			auto found = std::find(previous_times.begin(), previous_times.end(), times[ii]);
+			if (found != previous_times.end())
+			{
+				auto& previous = previous_derivatives[found - previous_times.begin()];
+				if (Precision(previous) == Precision(samples[ii]))
+				{
+					derivatives.push_back(std::move(previous));
+					derivative_times.push_back(times[ii]);
+					continue;
+				}
+			}
+
+			derivatives.push_back(-this->GetSystem().Jacobian(samples[ii],times[ii]).lu().solve(this->GetSystem().TimeDerivative(samples[ii],times[ii])));
+			derivative_times.push_back(times[ii]);
 		}
 	}
 
@@ -578,7 +613,7 @@ public:
 
   		if (abs(next_time - target_time) < this->EndgameSettings().min_track_time) // generalized for target_time not equal to 0.
   		{
-  			NotifyObservers(MinTrackTimeReached<EmitterType>(*this));
+  			this->template NotifyObservers<MinTrackTimeReached<EmitterType>>(*this);
   			return SuccessCode::MinTrackTimeReached;
   		}
 
@@ -586,7 +621,7 @@ public:
 			if (tracking_success != SuccessCode::Success)
 				return tracking_success;
 
-		NotifyObservers(InEGOperatingZone<EmitterType>(*this));
+		this->template NotifyObservers<InEGOperatingZone<EmitterType>>(*this);
 
 		this->EnsureAtPrecision(next_time,Precision(next_sample));
 	
@@ -602,13 +637,13 @@ public:
 										this->EndgameSettings().max_num_newton_iterations);
 		if (refine_success != SuccessCode::Success)
 		{
-			NotifyObservers(RefiningFailed<EmitterType>(*this));
+			this->template NotifyObservers<RefiningFailed<EmitterType>>(*this);
 			return refine_success;
 		}
 		
 		this->EnsureAtPrecision(times.back(),Precision(samples.back()));
 
-		NotifyObservers(SampleRefined<EmitterType>(*this));
+		this->template NotifyObservers<SampleRefined<EmitterType>>(*this);
 
 		// we keep one more samplepoint than needed around, for estimating the cycle number
 		if (times.size() > this->EndgameSettings().num_sample_points+1)
@@ -661,15 +696,15 @@ public:
 		Vec<CT>& latest_approx = this->final_approximation_;
 		Vec<CT>& prev_approx = this->previous_approximation_;
 
-		// this is for estimating a ... norm?
-		SetRandVec<CT>(start_point.size());	 	
+		// for estimating the cycle number
+		this->StartPathRandVec(start_point.size());	 	
 		
 		
 		auto initial_sample_success = this->ComputeInitialSamples(start_time, target_time, start_point, times, samples);
 
 		if (initial_sample_success!=SuccessCode::Success)
 		{
-			NotifyObservers(EndgameFailure<EmitterType>(*this));
+			this->template NotifyObservers<EndgameFailure<EmitterType>>(*this);
 			return initial_sample_success;
 		}
 
@@ -698,7 +733,7 @@ public:
 	  		auto advance_code = AdvanceTime<CT>(target_time);
 	  		if (advance_code!=SuccessCode::Success)
 	 		{
-	 			NotifyObservers(EndgameFailure<EmitterType>(*this));
+	 			this->template NotifyObservers<EndgameFailure<EmitterType>>(*this);
 	 			return advance_code;
 	 		}
 
@@ -709,12 +744,12 @@ public:
 	 		extrapolation_code = ComputeApproximationOfXAtT0(latest_approx, target_time);
 	 		if (extrapolation_code!=SuccessCode::Success)
 	 		{
-	 			NotifyObservers(EndgameFailure<EmitterType>(*this));
+	 			this->template NotifyObservers<EndgameFailure<EmitterType>>(*this);
 	 			return extrapolation_code;
 	 		}
 
 	 		approx_error = static_cast<NumErrorT>((latest_approx - prev_approx).template lpNorm<Eigen::Infinity>());
-	 		NotifyObservers(ApproximatedRoot<EmitterType>(*this));
+	 		this->template NotifyObservers<ApproximatedRoot<EmitterType>>(*this);
 
 
 	 		if(this->SecuritySettings().level <= 0)
@@ -722,7 +757,7 @@ public:
 	 			norm_of_dehom_of_latest_approx = this->GetSystem().DehomogenizePoint(latest_approx).template lpNorm<Eigen::Infinity>();
 		 		if(norm_of_dehom_of_latest_approx > this->SecuritySettings().max_norm && norm_of_dehom_of_prev_approx > this->SecuritySettings().max_norm)
 		 		{
-		 			NotifyObservers(SecurityMaxNormReached<EmitterType>(*this));
+		 			this->template NotifyObservers<SecurityMaxNormReached<EmitterType>>(*this);
 	 				return SuccessCode::SecurityMaxNormReached;
 		 		}
 	 			norm_of_dehom_of_prev_approx = norm_of_dehom_of_latest_approx;
@@ -735,7 +770,7 @@ public:
 	 		prev_approx = latest_approx;
 		} //end while	
 
-		NotifyObservers(Converged<EmitterType>(*this));
+		this->template NotifyObservers<Converged<EmitterType>>(*this);
 		return SuccessCode::Success;
 
 	} //end PSEG
@@ -0,0 +1,214 @@
+//This file is part of Bertini 2.
+//
+//eval_context.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//eval_context.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with eval_context.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+//
+// silviana amethyst
+// University of Wisconsin - Eau Claire
+
+
+/**
+\file eval_context.hpp
+
+\brief Defines EvalContext, scratch space for evaluating systems, so that one system can be evaluated by several threads at once.
+*/
+
+#pragma once
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "bertini2/num_traits.hpp"
+#include "bertini2/eigen_extensions.hpp"
+
+
+namespace bertini {
+
+	/**
+	\brief Memory for a straight-line program, in one number type.
+
+	\see StraightLineProgram
+	*/
+	template<typename T>
+	struct ProgramMemory
+	{
+		std::vector<T> values; ///< Inputs, numbers, intermediate results, and outputs, all in one block.
+		bool is_evaluated = false; ///< Whether the outputs in `values` are the results for the inputs in `values`.
+		std::vector<T> tangents; ///< For programs differentiated in forward mode, the derivatives of every location with respect to the variables and time, location by location.
+		bool tangents_evaluated = false; ///< Whether `tangents` are the derivatives at the inputs in `values`.
+		void const* owner = nullptr; ///< The program this memory was made for.
+	};
+
+
+
+	/**
+	\brief Scratch space for evaluating systems.
+
+	Ordinarily, every node of a function tree stores its own most recent value, and the System owning the tree stores the most recent variable values.  This makes evaluation cheap, but means a tree can only be evaluated by one thread at a time.
+
+	Evaluating through an EvalContext instead goes through the straight-line program compiled from the system, or its polynomial system if it evaluates with one, whose mutable state is a few flat blocks of memory.  The context holds those blocks, and the variable values.  While a context is active on a thread, the system, program and polynomial system read and write the context instead of themselves, one check per evaluation, leaving them untouched.  Hence one system can be shared by several threads, each evaluating with its own context.  The nodes of the function tree are not evaluated through contexts at all.
+
+	You don't usually activate a context yourself.  Instead, pass it to the System functions taking one, such as System::EvalInPlace(EvalContext&, ...), which activate it for the duration of the call.
+
+	A context must not be used by two threads at once.  Changing the precision of the system, or adding to it, is not safe while other threads are evaluating.
+
+	\see System::NewEvalContext
+	*/
+	class EvalContext
+	{
+	public:
+
+		EvalContext() = default;
+
+		EvalContext(EvalContext const&) = delete;
+		EvalContext& operator=(EvalContext const&) = delete;
+
+		EvalContext(EvalContext &&) = default;
+		EvalContext& operator=(EvalContext &&) = default;
+
+
+		/**
+		\brief Activates a context on the current thread for the lifetime of this object, and restores the previously active one afterwards.
+		*/
+		class Scope
+		{
+		public:
+			explicit
+			Scope(EvalContext & ctx) : previous_(Active())
+			{
+				ActivePointer() = &ctx;
+			}
+
+			~Scope()
+			{
+				ActivePointer() = previous_;
+			}
+
+			Scope(Scope const&) = delete;
+			Scope& operator=(Scope const&) = delete;
+
+		private:
+			EvalContext* previous_;
+		};
+
+
+		/**
+		\brief Get the context active on the current thread, or nullptr if there is none.
+		*/
+		static
+		EvalContext* Active()
+		{
+			return ActivePointer();
+		}
+
+
+		/**
+		\brief Get the values of the variables, as most recently set through this context.
+		*/
+		template<typename T>
+		Vec<T>& VariableValues()
+		{
+			return std::get<Vec<T> >(variable_values_);
+		}
+
+
+		/**
+		\brief Get the value of the path variable, as most recently set through this context.
+		*/
+		template<typename T>
+		T& PathVariableValue()
+		{
+			return std::get<T>(path_variable_value_);
+		}
+
+
+		/**
+		\brief Get the memory for evaluating a straight-line program or polynomial system through this context.
+		*/
+		template<typename T>
+		ProgramMemory<T>& Memory()
+		{
+			return std::get<ProgramMemory<T> >(program_memory_);
+		}
+
+
+		/**
+		\brief Swap in the multiple precision memory for the working precision, if it has changed since the last evaluation.
+
+		The memory holds the numbers of the program, so without this they would keep the precision they were first rounded to.  The memory at the old precision, tangents and all, is parked, and taken back out when evaluating at that precision again.  The first time at a precision, the memory is seeded afresh when next used.
+
+		\param new_precision The precision of the upcoming evaluation.
+		*/
+		void SyncPrecision(unsigned new_precision)
+		{
+			if (new_precision == precision_)
+				return;
+
+			auto& current = std::get<ProgramMemory<mpfr_complex> >(program_memory_);
+			parked_memory_[precision_] = std::move(current);
+
+			auto parked = parked_memory_.find(new_precision);
+			if (parked != parked_memory_.end())
+			{
+				current = std::move(parked->second);
+				parked_memory_.erase(parked);
+			}
+			else
+				current = ProgramMemory<mpfr_complex>();
+
+			current.is_evaluated = false;
+			current.tangents_evaluated = false;
+			precision_ = new_precision;
+		}
+
+
+		/**
+		\brief Forget everything.  The next evaluation through this context is fresh.
+		*/
+		void Clear()
+		{
+			program_memory_ = decltype(program_memory_)();
+			parked_memory_.clear();
+		}
+
+	private:
+
+		static
+		EvalContext*& ActivePointer()
+		{
+			static thread_local EvalContext* active = nullptr;
+			return active;
+		}
+
+
+		std::tuple< Vec<dbl>, Vec<mpfr_complex> > variable_values_; ///< The current values of the system's variables.
+
+		std::tuple< dbl, mpfr_complex > path_variable_value_; ///< The current value of the system's path variable, if it has one.
+
+		std::tuple< ProgramMemory<dbl>, ProgramMemory<mpfr_complex> > program_memory_; ///< Memory for the system's straight-line program or polynomial system.
+
+		std::map<unsigned, ProgramMemory<mpfr_complex> > parked_memory_; ///< The multiple precision memory at the other precisions evaluated at.
+
+		unsigned precision_ = 0; ///< The precision of the most recent evaluation.
+	};
+
+} // re: namespace bertini
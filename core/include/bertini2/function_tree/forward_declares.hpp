@@ -44,6 +44,11 @@ namespace bertini {
 		class Function;
 		class Jacobian;
 		class Differential;
+
+		namespace special_number{
+			class Pi;
+			class E;
+		}
 	}
 
 
@@ -54,9 +59,11 @@ namespace bertini {
 		class NaryOperator;
 		
 		class SumOperator;
+		class NegateOperator;
 		class MultOperator;
 		class IntegerPowerOperator;
 		class PowerOperator;
+		class SqrtOperator;
 		class ExpOperator;
 		class LogOperator;
 	}
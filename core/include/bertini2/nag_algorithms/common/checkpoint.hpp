@@ -0,0 +1,230 @@
+//This file is part of Bertini 2.
+//
+//bertini2/nag_algorithms/common/checkpoint.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/nag_algorithms/common/checkpoint.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/nag_algorithms/common/checkpoint.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+/**
+\file bertini2/nag_algorithms/common/checkpoint.hpp
+
+\brief Provides append-only checkpoint files, of records serialized with Boost.Serialization, for resuming algorithms which were interrupted.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+namespace bertini {
+
+	namespace algorithm {
+
+		/**
+		\brief The bytes a checkpoint file starts with.
+		*/
+		inline
+		std::string const& CheckpointMagic()
+		{
+			static const std::string magic("B2CKPT\0\0", 8);
+			return magic;
+		}
+
+		/**
+		\brief One record of a checkpoint file: what kind it is, as decided by the algorithm writing it, and its serialized contents.
+		*/
+		struct CheckpointRecord
+		{
+			char kind;
+			std::string payload;
+		};
+
+
+		/**
+		\brief Serialize some objects into the payload of a checkpoint record.
+
+		Payloads are binary archives, so that numbers which are not finite survive the round trip, and are meant to be read back on the same kind of machine.
+		*/
+		template<typename ...Ts>
+		std::string ToCheckpointPayload(Ts const& ...ts)
+		{
+			std::ostringstream ss(std::ios::binary);
+			{
+				boost::archive::binary_oarchive oa(ss, boost::archive::no_header);
+				using expand = int[];
+				(void) expand{0, (oa << ts, 0)...};
+			}
+			return ss.str();
+		}
+
+		/**
+		\brief Deserialize some objects from the payload of a checkpoint record, in the order they were serialized.
+		*/
+		template<typename ...Ts>
+		void FromCheckpointPayload(std::string const& payload, Ts & ...ts)
+		{
+			std::istringstream ss(payload, std::ios::binary);
+			boost::archive::binary_iarchive ia(ss, boost::archive::no_header);
+			using expand = int[];
+			(void) expand{0, (ia >> ts, 0)...};
+		}
+
+
+		/**
+		\brief Appends records to a checkpoint file, from any number of threads.
+
+		A checkpoint file is never rewritten in place, only appended to, so a run which dies leaves a file holding everything recorded up to at most the latest flush.  Records are serialized by the calling thread before appending, so the lock is held only while copying bytes into the file's buffer, and the file is flushed at most every `flush_interval`, and when the writer is destroyed.
+
+		The file is the bytes `B2CKPT` and two zeros, and the version as a 32-bit unsigned integer, followed by records, each of which is its kind as one byte, the size of its payload as a 64-bit unsigned integer, and the payload.
+		*/
+		class CheckpointWriter
+		{
+		public:
+
+			/**
+			\param filename The checkpoint file to write.  Overwritten if it exists.
+			\param flush_interval How often to flush records to disk.
+			\throws std::runtime_error if the file can't be opened.
+			*/
+			CheckpointWriter(std::string const& filename, std::chrono::milliseconds flush_interval = std::chrono::seconds(10)) :
+				file_(filename, std::ios::binary | std::ios::trunc),
+				flush_interval_(flush_interval),
+				last_flush_(std::chrono::steady_clock::now())
+			{
+				if (!file_)
+					throw std::runtime_error("unable to open checkpoint file " + filename + " for writing");
+
+				const std::uint32_t version = Version;
+				file_.write(CheckpointMagic().data(), CheckpointMagic().size());
+				file_.write(reinterpret_cast<const char*>(&version), sizeof(version));
+				file_.flush();
+			}
+
+			~CheckpointWriter()
+			{
+				Flush();
+			}
+
+			CheckpointWriter(CheckpointWriter const&) = delete;
+			CheckpointWriter& operator=(CheckpointWriter const&) = delete;
+
+			/**
+			\brief Append a record.
+
+			\param kind What kind of record it is, for the algorithm reading it back.
+			\param payload The contents of the record, as from ToCheckpointPayload.
+			*/
+			void Append(char kind, std::string const& payload)
+			{
+				const std::uint64_t size = payload.size();
+
+				std::lock_guard<std::mutex> lock(mutex_);
+				file_.put(kind);
+				file_.write(reinterpret_cast<const char*>(&size), sizeof(size));
+				file_.write(payload.data(), payload.size());
+				++num_records_;
+
+				const auto now = std::chrono::steady_clock::now();
+				if (now - last_flush_ >= flush_interval_)
+				{
+					file_.flush();
+					last_flush_ = now;
+				}
+			}
+
+			/**
+			\brief Write all records appended so far to disk, now.
+			*/
+			void Flush()
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				file_.flush();
+				last_flush_ = std::chrono::steady_clock::now();
+			}
+
+			/**
+			\brief The number of records appended so far.
+			*/
+			std::size_t NumRecords() const
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				return num_records_;
+			}
+
+			static constexpr std::uint32_t Version = 1;
+
+		private:
+			std::ofstream file_;
+			std::chrono::milliseconds flush_interval_;
+			std::chrono::steady_clock::time_point last_flush_;
+			mutable std::mutex mutex_;
+			std::size_t num_records_ = 0;
+		};
+
+
+		/**
+		\brief Read the records of a checkpoint file, in the order they were appended.
+
+		A record cut short, because the run writing the file died while appending it, is ignored, as is anything after it.
+
+		\throws std::runtime_error if the file can't be read, or isn't a checkpoint file of this version.
+		*/
+		inline
+		std::vector<CheckpointRecord> ReadCheckpoint(std::string const& filename)
+		{
+			std::ifstream file(filename, std::ios::binary);
+			if (!file)
+				throw std::runtime_error("unable to open checkpoint file " + filename + " for reading");
+
+			std::string magic(CheckpointMagic().size(), ' ');
+			std::uint32_t version;
+			file.read(&magic[0], magic.size());
+			file.read(reinterpret_cast<char*>(&version), sizeof(version));
+
+			if (!file || magic!=CheckpointMagic())
+				throw std::runtime_error(filename + " is not a bertini2 checkpoint file");
+			if (version!=CheckpointWriter::Version)
+				throw std::runtime_error("checkpoint file " + filename + " is of version " + std::to_string(version) + ", but only version " + std::to_string(CheckpointWriter::Version) + " can be read");
+
+			std::vector<CheckpointRecord> records;
+			CheckpointRecord r;
+			std::uint64_t size;
+			while (file.get(r.kind) && file.read(reinterpret_cast<char*>(&size), sizeof(size)))
+			{
+				r.payload.resize(size);
+				if (!file.read(&r.payload[0], size))
+					break;
+				records.push_back(r);
+			}
+			return records;
+		}
+
+	} // namespace algorithm
+
+} // namespace bertini
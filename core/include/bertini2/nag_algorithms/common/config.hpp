@@ -29,6 +29,9 @@
 #include "bertini2/system/start_systems.hpp"
 #include "bertini2/nag_algorithms/common/policies.hpp"
 
+#include <boost/serialization/access.hpp>
+#include <boost/serialization/string.hpp>
+
 namespace bertini{
 	namespace algorithm{
 
@@ -66,6 +69,18 @@ struct TolerancesConfig
 	T final_tolerance = T(1)/T(100000000000); //E.5.1
 
 	T path_truncation_threshold = T(100000); //E.4.13
+
+private:
+	friend class boost::serialization::access;
+
+	template <typename Archive>
+	void serialize(Archive& ar, const unsigned version)
+	{
+		ar & newton_before_endgame;
+		ar & newton_during_endgame;
+		ar & final_tolerance;
+		ar & path_truncation_threshold;
+	}
 };
 		
 	
@@ -74,6 +89,8 @@ struct MidPathConfig
 	using T = NumErrorT;
 
 	T same_point_tolerance = T(1)/T(100000);
+
+	unsigned num_threads = 1; ///< The number of threads to look for crossed paths with.  0 means as many as the hardware supports.  Results do not depend on this number.
 };
 
 
@@ -83,6 +100,15 @@ struct AutoRetrackConfig
 	using T = NumErrorT;
 
 	T midpath_decrease_tolerance_factor = T(1)/T(2);
+
+private:
+	friend class boost::serialization::access;
+
+	template <typename Archive>
+	void serialize(Archive& ar, const unsigned version)
+	{
+		ar & midpath_decrease_tolerance_factor;
+	}
 };
 
 
@@ -125,6 +151,17 @@ struct PostProcessingConfig{
 	T endpoint_finite_threshold = T(1)/T(100000);  ///< The threshold on norm of endpoints being considered infinite.  There is another setting in Tolerances, `path_truncation_threshold`, which tells the path tracker to die if exceeded.  Another related setting is in Security, `max_norm` -- the endgame dies if the norm of the computed approximation exceeds this twice.
 
 	T same_point_tolerance {T(1)/T(10000000000)}; ///< The tolerance for whether two points are the same.  This should be *lower* than the accuracy to which you request your solutions be computed.  Perhaps by at least two orders of magnitude, but the default value is a factor of 10 less stringent.  This also depends on the norm being used to tell whether two points are the same, and the norm used for the convergence condition to terminate tracking.
+
+private:
+	friend class boost::serialization::access;
+
+	template <typename Archive>
+	void serialize(Archive& ar, const unsigned version)
+	{
+		ar & real_threshold;
+		ar & endpoint_finite_threshold;
+		ar & same_point_tolerance;
+	}
 };
 
 template<typename ComplexT>
@@ -138,6 +175,23 @@ struct ZeroDimConfig
 	ComplexT target_time = ComplexT(0);
 
 	std::string path_variable_name = "ZERO_DIM_PATH_VARIABLE";
+
+	unsigned num_threads = 1; ///< The number of threads to track paths with.  0 means as many as the hardware supports.  Results do not depend on this number.
+
+private:
+	friend class boost::serialization::access;
+
+	template <typename Archive>
+	void serialize(Archive& ar, const unsigned version)
+	{
+		ar & initial_ambient_precision;
+		ar & max_num_crossed_path_resolve_attempts;
+		ar & start_time;
+		ar & endgame_boundary;
+		ar & target_time;
+		ar & path_variable_name;
+		ar & num_threads;
+	}
 };
 
 struct MetaConfig
@@ -0,0 +1,175 @@
+//This file is part of Bertini 2.
+//
+//include/bertini2/nag_algorithms/common/projected_neighbors.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//include/bertini2/nag_algorithms/common/projected_neighbors.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with include/bertini2/nag_algorithms/common/projected_neighbors.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin-eau claire
+
+
+/**
+\file include/bertini2/nag_algorithms/common/projected_neighbors.hpp
+
+\brief Finding the pairs of points which are close to each other, without comparing every pair, by sorting a random projection of them to the real line.
+*/
+
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/parallel/thread_pool.hpp"
+
+namespace bertini{
+	namespace algorithm{
+
+
+		/**
+		\brief The norm in which points are close, for ProjectedNeighborPairs.
+		*/
+		enum class ProjectionNorm
+		{
+			Two,
+			Infinity
+		};
+
+
+		/**
+		\brief Find the pairs of points which are close, by a given test, comparing only pairs which could be.
+
+		The points are sorted by a random projection to the real line, which moves no two points further apart than a known multiple of the norm of their difference.  Each point is then only compared with the points near it in the sorted order, as near as a point close to it can be, which for well-separated points is only a few, so the search takes \f$O(n \log n)\f$ comparisons.  The projections are computed in double precision, with a little slack for their roundoff, and points too large to project in double precision are compared with all the others.
+
+		The comparisons are spread over threads, in blocks of the sorted points, and the result doesn't depend on the number of threads.  The projection is seeded by the number of variables, so the search is repeatable.
+
+		\param indices The indices of the points to search among.
+		\param point The point for an index.
+		\param norm The norm in which distance_bound measures.
+		\param distance_bound How far from a point, in `norm`, a point close to it can be.
+		\param close Whether the points for indices ii < jj are close, the bound for which is distance_bound of the point for ii.  Called from all the threads at once.
+		\param num_threads The number of threads to compare with.  At least 1.
+		\return The pairs of indices ii < jj whose points are close, sorted.
+		*/
+		template<typename IndexT, typename PointF, typename BoundF, typename CloseF>
+		std::vector<std::pair<IndexT, IndexT>> ProjectedNeighborPairs(std::vector<IndexT> const& indices, PointF const& point, ProjectionNorm norm, BoundF const& distance_bound, CloseF const& close, unsigned num_threads)
+		{
+			using std::abs;
+			using Pair = std::pair<IndexT, IndexT>;
+
+			if (indices.size() < 2)
+				return {};
+
+			// a random projection x -> sum_k a_k Re(x_k) + b_k Im(x_k).  it moves two points apart by at most `spread` times the norm of their difference.
+			const auto num_variables = point(indices.front()).size();
+			std::mt19937 generator(num_variables);
+			std::uniform_real_distribution<double> distribution(-1,1);
+			std::vector<double> weights(2*num_variables);
+			double spread = 0;
+			for (auto& w : weights)
+			{
+				w = distribution(generator);
+				spread += norm==ProjectionNorm::Two ? w*w : abs(w);
+			}
+			if (norm==ProjectionNorm::Two)
+				spread = std::sqrt(spread);
+
+			const double roundoff = 8*(num_variables+1)*std::numeric_limits<double>::epsilon();
+
+			struct Projected
+			{
+				double projection; ///< Where the point lands on the line.
+				double reach; ///< How far along the line a point close to this one can be.
+				IndexT index;
+			};
+
+			std::vector<Projected> projected;
+			std::vector<IndexT> unprojectable; // overflowed in double precision, so are compared with everything
+			projected.reserve(indices.size());
+			for (auto ii : indices)
+			{
+				auto const& x = point(ii);
+				double projection = 0;
+				for (int kk = 0; kk < x.size(); ++kk)
+					projection += weights[2*kk]*static_cast<double>(real(x(kk))) + weights[2*kk+1]*static_cast<double>(imag(x(kk)));
+
+				const double norm_x = norm==ProjectionNorm::Two ? static_cast<double>(x.norm()) : static_cast<double>(x.template lpNorm<Eigen::Infinity>());
+				const double bound = static_cast<double>(distance_bound(ii));
+				const double reach = spread * (bound + roundoff*(2*norm_x + bound));
+
+				if (std::isfinite(projection) && std::isfinite(reach) && x.size()==num_variables)
+					projected.push_back({projection, reach, ii});
+				else
+					unprojectable.push_back(ii);
+			}
+			std::sort(projected.begin(), projected.end(), [](Projected const& a, Projected const& b){ return a.projection < b.projection; });
+
+
+			// compare each point with the later-indexed ones within its reach, on both sides, in blocks of the sorted points, spread over the threads
+			const unsigned num_workers = std::max(num_threads, 1u);
+			std::vector<std::vector<Pair>> found(num_workers);
+
+			const std::size_t block_size = 256;
+			const std::size_t num_blocks = (projected.size() + block_size - 1)/block_size;
+
+			parallel::ForEachIndex(num_blocks + unprojectable.size(), num_workers, [&](unsigned worker, std::size_t task)
+			{
+				auto Compare = [&](IndexT ii, IndexT jj)
+				{
+					if (close(ii, jj))
+						found[worker].emplace_back(ii, jj);
+				};
+
+				if (task < num_blocks)
+				{
+					const auto end = std::min(projected.size(), (task+1)*block_size);
+					for (auto kk = task*block_size; kk < end; ++kk)
+					{
+						const auto& p = projected[kk];
+						for (auto mm = kk; mm-- > 0 && p.projection - projected[mm].projection <= p.reach; )
+							if (projected[mm].index > p.index)
+								Compare(p.index, projected[mm].index);
+						for (auto mm = kk+1; mm < projected.size() && projected[mm].projection - p.projection <= p.reach; ++mm)
+							if (projected[mm].index > p.index)
+								Compare(p.index, projected[mm].index);
+					}
+				}
+				else
+				{
+					const auto ii = unprojectable[task - num_blocks];
+					for (auto jj : indices)
+						if (jj != ii)
+							Compare(std::min(ii,jj), std::max(ii,jj));
+				}
+			});
+
+			std::vector<Pair> pairs;
+			for (auto const& f : found)
+				pairs.insert(pairs.end(), f.begin(), f.end());
+			std::sort(pairs.begin(), pairs.end());
+			pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end()); // two unprojectable points find each other twice
+			return pairs;
+		}
+
+	} // re: namespace algorithm
+}// re: namespace bertini
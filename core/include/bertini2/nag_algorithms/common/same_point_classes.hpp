@@ -0,0 +1,143 @@
+//This file is part of Bertini 2.
+//
+//include/bertini2/nag_algorithms/common/same_point_classes.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//include/bertini2/nag_algorithms/common/same_point_classes.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with include/bertini2/nag_algorithms/common/same_point_classes.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin-eau claire
+
+
+/**
+\file include/bertini2/nag_algorithms/common/same_point_classes.hpp
+
+\brief Grouping points which are the same, to a tolerance, into classes, such as the endpoints of paths converging to the same solution.
+*/
+
+
+#pragma once
+
+#include <numeric>
+#include <vector>
+
+#include "bertini2/common/config.hpp"
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/nag_algorithms/common/projected_neighbors.hpp"
+
+namespace bertini{
+	namespace algorithm{
+
+
+		/**
+		\brief Disjoint sets of the indices [0,n), merged with Union, and identified by the smallest index in each.
+		*/
+		class DisjointSets
+		{
+		public:
+			using IndexT = std::size_t;
+
+			explicit
+			DisjointSets(IndexT n) : parent_(n)
+			{
+				std::iota(parent_.begin(), parent_.end(), IndexT(0));
+			}
+
+			/**
+			\brief The smallest index in the set containing ii.
+			*/
+			IndexT Find(IndexT ii)
+			{
+				while (parent_[ii] != ii)
+				{
+					parent_[ii] = parent_[parent_[ii]]; // path halving
+					ii = parent_[ii];
+				}
+				return ii;
+			}
+
+			/**
+			\brief Merge the sets containing ii and jj.
+			*/
+			void Union(IndexT ii, IndexT jj)
+			{
+				ii = Find(ii);
+				jj = Find(jj);
+				if (ii < jj)
+					parent_[jj] = ii;
+				else if (jj < ii)
+					parent_[ii] = jj;
+			}
+
+		private:
+			std::vector<IndexT> parent_;
+		};
+
+
+
+		/**
+		\brief Group points into classes of the same point.
+
+		Two points are the same if the 2-norm of their difference is less than the tolerance, and classes are closed under this relation, so a chain of points, each the same as the next, is one class.
+
+		Rather than comparing every pair of points, only the pairs which could be the same are compared, found by ProjectedNeighborPairs, so grouping takes \f$O(n \log n)\f$ comparisons for well-separated points.  The comparisons are spread over threads, and the results don't depend on the number of threads.
+
+		\param points The points to group.
+		\param included Which of the points to group.  The others are each in a class of their own.
+		\param tolerance The distance below which two points are the same.
+		\param num_threads The number of threads to compare points with.
+		\return For each point, the smallest index of a point in its class.
+		*/
+		template<typename ComplexT>
+		std::vector<std::size_t> SamePointClasses(std::vector<Vec<ComplexT>> const& points, std::vector<bool> const& included, NumErrorT tolerance, unsigned num_threads = 1)
+		{
+			using IndexT = std::size_t;
+
+			if (included.size() != points.size())
+				throw std::runtime_error("number of flags for which points to group into classes must match the number of points");
+
+			DisjointSets classes(points.size());
+
+			std::vector<IndexT> grouped;
+			for (IndexT ii = 0; ii < points.size(); ++ii)
+				if (included[ii])
+					grouped.push_back(ii);
+			if (grouped.size() < 2)
+			{
+				std::vector<IndexT> result(points.size());
+				std::iota(result.begin(), result.end(), IndexT(0));
+				return result;
+			}
+
+			const auto same = ProjectedNeighborPairs(grouped,
+				[&](IndexT ii) -> Vec<ComplexT> const& { return points[ii]; },
+				ProjectionNorm::Two,
+				[&](IndexT) { return tolerance; },
+				[&](IndexT ii, IndexT jj) { return (points[ii] - points[jj]).norm() < tolerance; },
+				num_threads);
+
+			for (auto const& pair : same)
+				classes.Union(pair.first, pair.second);
+
+			std::vector<IndexT> result(points.size());
+			for (IndexT ii = 0; ii < points.size(); ++ii)
+				result[ii] = classes.Find(ii);
+			return result;
+		}
+
+	} // re: namespace algorithm
+}// re: namespace bertini
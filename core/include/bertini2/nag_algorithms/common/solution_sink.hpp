@@ -0,0 +1,80 @@
+//This file is part of Bertini 2.
+//
+//bertini2/nag_algorithms/common/solution_sink.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/nag_algorithms/common/solution_sink.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/nag_algorithms/common/solution_sink.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+/**
+\file bertini2/nag_algorithms/common/solution_sink.hpp
+
+\brief Provides the interface for taking the results of an algorithm path by path, as they are computed.
+*/
+
+#pragma once
+
+#include <cstddef>
+
+namespace bertini {
+
+	namespace algorithm {
+
+		/**
+		\brief Takes the results of an algorithm as each path finishes, rather than all at once after it is done.
+
+		An algorithm streaming into a sink releases the full-precision data of each path after passing it to the sink, so its memory use does not grow with the number of paths as fast.  See output::StreamingClassic for one which writes to a file.
+
+		PathFinished is called from whichever thread tracked the path, so sinks used with more than one thread must be safe to call concurrently.
+
+		\tparam AlgoT The type of algorithm the results come from.
+		*/
+		template<typename AlgoT>
+		class SolutionSink
+		{
+		public:
+
+			virtual ~SolutionSink() = default;
+
+			/**
+			\brief Called once at the start of a run of the algorithm, before any paths are tracked.
+			*/
+			virtual void Started(AlgoT const& alg)
+			{}
+
+			/**
+			\brief Called once for each path when it is finished, successfully or not, while its results are still held by the algorithm.
+
+			Paths which failed before getting results have only their metadata, with the success code of the failure.
+
+			\param alg The algorithm, from which to get the results of the path.
+			\param index The index of the path.
+			*/
+			virtual void PathFinished(AlgoT const& alg, std::size_t index) = 0;
+
+			/**
+			\brief Called once at the end of a run of the algorithm, after post-processing, which needs all the paths.
+			*/
+			virtual void Finished(AlgoT const& alg)
+			{}
+		};
+
+	} // namespace algorithm
+
+} // namespace bertini
@@ -35,8 +35,13 @@ This essentially amounts to being certain that no two points are the same.
 
 #pragma once
 
+#include <unordered_map>
+
 #include "bertini2/nag_algorithms/common/config.hpp"
+#include "bertini2/nag_algorithms/common/projected_neighbors.hpp"
 #include "bertini2/detail/configured.hpp"
+#include "bertini2/parallel/thread_pool.hpp"
+#include "bertini2/system/start_base.hpp"
 
 namespace bertini{
 	namespace algorithm{
@@ -101,6 +106,11 @@ namespace bertini{
 					return rerun_;
 				}
 
+				std::vector< std::pair<PathIndT, bool> > const& crossed_with() const
+				{
+					return crossed_with_;
+				}
+
 
 			private:
 				PathIndT index_;
@@ -125,78 +135,45 @@ namespace bertini{
 			
 			/**
 			 \brief Checks the solution data at the endgame boundary to see if any paths have crossed during tracking before the endgame.
+
+			 Two successful paths ii < jj have crossed if \f$ \|x_{ii} - x_{jj}\|_\infty / \|x_{ii}\|_\infty \f$ is less than the same point tolerance.  Rather than comparing every pair of points, the points are sorted by a random projection to the real line, which moves no two points further apart than a known multiple of the infinity norm of their difference.  Each point is then only compared with its neighbors in the sorted order which are close enough to possibly be the same point, which for well-separated points is only a few, making the check \f$O(n \log n)\f$ in the number of paths.  The comparison itself is exactly the one above, so the crossed paths found are exactly those of comparing every pair, in the same order.
+
+			 The comparisons are spread over MidPathConfig::num_threads threads.
 			 
 			 \param boundary_data Solution data at the endgame boundary
+			 \param start_system The start system, whose start points are compared for the paths which crossed.
 			 
-			 \returns A Data object which stores data about crossed paths
+			 \returns Whether the check passed, that is, no paths crossed on this or any previous check.
 			 
 			*/
 			template <typename StartSystemT>
 			bool Check(BoundaryData const& boundary_data, StartSystemT const& start_system)
 			{
-				for (PathIndT ii = 0; ii < boundary_data.size(); ++ii)
+				// start points are only needed for the paths which crossed, so are made on demand
+				std::unordered_map<PathIndT, Vec<ComplexType>> start_points;
+				return CheckWith(boundary_data, [&](PathIndT ii) -> Vec<ComplexType> const&
 				{
-					if ( boundary_data[ii].success_code != SuccessCode::Success)
-							continue;
-
-					const Vec<ComplexType>& solution_ii = boundary_data[ii].path_point;
-					const auto start_ii = start_system.template StartPoint<ComplexType>(ii);
-
-					for (PathIndT jj = ii+1; jj < boundary_data.size(); ++jj)
-					{
-						if ( boundary_data[jj].success_code != SuccessCode::Success)
-							continue;
-
-						const Vec<ComplexType>& solution_jj = boundary_data[jj].path_point;
-						const Vec<ComplexType> diff_sol = solution_ii - solution_jj;
-						
-						if ((diff_sol.template lpNorm<Eigen::Infinity>()/solution_ii.template lpNorm<Eigen::Infinity>()) < SamePointTol())
-						{
-							bool i_already_stored = false;
-							bool j_already_stored = false;
-							// Check if start points are the same
-							
-							const auto start_jj = start_system.template StartPoint<ComplexType>(jj);
-							auto diff_start = start_ii - start_jj;
-							bool same_start = (diff_start.template lpNorm<Eigen::Infinity>() > SamePointTol());
-							
-							
-							// Check if path has already been stored in crossed_paths_
-							for(auto& v : crossed_paths_)
-							{
-								if(v.index() == ii)
-								{
-									v.crossed_with(std::make_pair(jj,same_start));
-									i_already_stored = true;
-									v.rerun(same_start);
-								}
-								if(v.index() == jj)
-								{
-									v.crossed_with(std::make_pair(ii,same_start));
-									j_already_stored = true;
-									v.rerun(same_start);
-								}
-							}
-							
-							// If not already stored, create CrossedPath object and add to crossed_paths_
-							if(!i_already_stored)
-							{
-								CrossedPath tempPath(ii, jj, same_start);
-								crossed_paths_.push_back(tempPath);
-							}
-							if(!j_already_stored)
-							{
-								CrossedPath tempPath(jj, ii, same_start);
-								crossed_paths_.push_back(tempPath);
-							}
-							
-							passed_ = false;
-							
-						}
-					}
-				}
-				return passed_;
-			};
+					auto found = start_points.find(ii);
+					if (found==start_points.end())
+						found = start_points.emplace(ii, start_system.template StartPoint<ComplexType>(ii)).first;
+					return found->second;
+				});
+			}
+
+
+			/**
+			 \brief Checks the solution data at the endgame boundary, with start points already made, as by StartSystem::StartPoints.
+
+			 \param boundary_data Solution data at the endgame boundary
+			 \param start_points The start points of the paths, which must include all of them.
+			*/
+			bool Check(BoundaryData const& boundary_data, start_system::StartPointBlock<ComplexType> const& start_points)
+			{
+				return CheckWith(boundary_data, [&](PathIndT ii)
+				{
+					return start_points.Point(ii);
+				});
+			}
 			
 			
 			const std::vector<CrossedPath> GetCrossedPaths() const
@@ -207,8 +184,82 @@ namespace bertini{
 			
 			
 		private:
+
+			/**
+			 \brief Record the crossed paths, comparing the start points of each pair got from a function of the path index.
+			*/
+			template <typename StartPointF>
+			bool CheckWith(BoundaryData const& boundary_data, StartPointF && StartPoint)
+			{
+				for (auto const& crossing : CrossingPairs(boundary_data))
+				{
+					const auto ii = crossing.first, jj = crossing.second;
+
+					// Check if start points are the same
+					const Vec<ComplexType> diff_start = StartPoint(ii) - StartPoint(jj);
+					bool same_start = (diff_start.template lpNorm<Eigen::Infinity>() > SamePointTol());
+
+					Record(ii, jj, same_start);
+					Record(jj, ii, same_start);
+
+					passed_ = false;
+				}
+				return passed_;
+			}
+
+			/**
+			 \brief Whether two points at the endgame boundary are the same, relative to the first.
+			*/
+			bool SamePoint(Vec<ComplexType> const& solution_ii, Vec<ComplexType> const& solution_jj) const
+			{
+				const Vec<ComplexType> diff_sol = solution_ii - solution_jj;
+				return (diff_sol.template lpNorm<Eigen::Infinity>()/solution_ii.template lpNorm<Eigen::Infinity>()) < SamePointTol();
+			}
+
+
+			/**
+			 \brief All pairs of paths ii < jj which have crossed, sorted.
+			*/
+			std::vector<std::pair<PathIndT, PathIndT>> CrossingPairs(BoundaryData const& boundary_data) const
+			{
+				const double tol = SamePointTol();
+
+				std::vector<PathIndT> successful;
+				for (PathIndT ii = 0; ii < boundary_data.size(); ++ii)
+					if (boundary_data[ii].success_code == SuccessCode::Success)
+						successful.push_back(ii);
+
+				return ProjectedNeighborPairs(successful,
+					[&](PathIndT ii) -> Vec<ComplexType> const& { return boundary_data[ii].path_point; },
+					ProjectionNorm::Infinity,
+					[&](PathIndT ii) { return static_cast<double>(boundary_data[ii].path_point.template lpNorm<Eigen::Infinity>()) * tol; },
+					[&](PathIndT ii, PathIndT jj) { return SamePoint(boundary_data[ii].path_point, boundary_data[jj].path_point); },
+					parallel::NumThreads(this->template Get<MidPathConfT>().num_threads));
+			}
+
+
+			/**
+			 \brief Record that path ii crossed path jj.
+			*/
+			void Record(PathIndT ii, PathIndT jj, bool same_start)
+			{
+				auto found = crossed_path_locations_.find(ii);
+				if (found != crossed_path_locations_.end())
+				{
+					auto& v = crossed_paths_[found->second];
+					v.crossed_with(std::make_pair(jj,same_start));
+					v.rerun(same_start);
+				}
+				else
+				{
+					crossed_path_locations_.emplace(ii, crossed_paths_.size());
+					crossed_paths_.push_back(CrossedPath(ii, jj, same_start));
+				}
+			}
+
 			
 			std::vector<CrossedPath> crossed_paths_; // Data for all paths that crossed on last check
+			std::unordered_map<PathIndT, std::size_t> crossed_path_locations_; // Where in crossed_paths_ each crossed path is
 			bool passed_;  // Did the check pass?
 			
 			
@@ -33,6 +33,12 @@ You can also provide your own, that's the point of these policies.
 #include "bertini2/nag_algorithms/zero_dim_solve.hpp"
 #include "bertini2/io/generators.hpp"
 
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
 
 namespace bertini {
 namespace algorithm {
@@ -113,6 +119,52 @@ struct Classic <ZeroDim<A,B,C,D,E>>
 	}
 
 
+	/**
+	\brief Where the time of the latest solve went: wall-clock time and paths tracked for each phase, and the work done by the trackers in it, by precision.
+	*/
+	template <typename OutT>
+	static
+	void Profile(OutT & out, ZDT const& zd)
+	{
+		const auto& md = zd.AlgorithmMetadata();
+		const auto start = std::chrono::system_clock::to_time_t(md.start_time);
+
+		out << "solve started " << std::put_time(std::localtime(&start), "%F %T")
+			<< ", took " << Seconds(md.elapsed_time) << " seconds\n"
+			<< md.number_paths_tracked << " paths, " << md.number_path_successes << " successful, " << md.number_path_failures << " failed, "
+			<< md.number_midpath_resolve_attempts << " attempts to resolve crossed paths\n\n";
+
+		PhaseProfile(out, "before endgame", md.before_endgame);
+		PhaseProfile(out, "endgame boundary", md.endgame_boundary);
+		PhaseProfile(out, "during endgame", md.during_endgame);
+		PhaseProfile(out, "post-processing", md.post_processing);
+	}
+
+
+	/**
+	\brief The wall-clock time and paths tracked for one phase of a solve, and a table of the work done by the trackers, by precision.
+	*/
+	template <typename OutT>
+	static
+	void PhaseProfile(OutT & out, std::string const& name, typename ZDT::PhaseMetaData const& phase, std::string const& additional = "\n")
+	{
+		out << name << ": " << Seconds(phase.elapsed_time) << " seconds, " << phase.number_paths_tracked << " paths tracked\n";
+
+		const auto& by_precision = phase.tracker_counts.ByPrecision();
+		if (by_precision.empty())
+		{
+			out << additional;
+			return;
+		}
+
+		out << "precision\tsteps\tfailed\tf evals\tJ evals\tdt evals\tLU\tprec up\tprec down\n";
+		for (const auto& c : by_precision)
+			PrecisionCountsRow(out, std::to_string(c.first), c.second);
+		if (by_precision.size() > 1)
+			PrecisionCountsRow(out, "total", phase.tracker_counts.Total());
+		out << additional;
+	}
+
 	template <typename OutT>
 	static 
 	void NumVariables(OutT & out, ZDT const& zd, std::string const& additional = "\n")
@@ -197,6 +249,27 @@ struct Classic <ZeroDim<A,B,C,D,E>>
 
 
 
+	template <typename OutT>
+	static
+	void PrecisionCountsRow(OutT & out, std::string const& precision, tracking::PrecisionCounts const& c)
+	{
+		out << precision << "\t\t"
+			<< c.successful_steps + c.failed_steps << '\t'
+			<< c.failed_steps << '\t'
+			<< c.function_evaluations << '\t'
+			<< c.jacobian_evaluations << '\t'
+			<< c.time_derivative_evaluations << "\t\t"
+			<< c.lu_factorizations << '\t'
+			<< c.precision_increases << '\t'
+			<< c.precision_decreases << '\n';
+	}
+
+	static
+	double Seconds(std::chrono::microseconds const& t)
+	{
+		return std::chrono::duration<double>(t).count();
+	}
+
 	template <typename IndexT, typename OutT>
 	static
 	void EndPointMDRaw(IndexT const& ind, OutT & out, ZDT const& zd, std::string const& additional = "\n")
@@ -217,10 +290,101 @@ struct Classic <ZeroDim<A,B,C,D,E>>
 			<< additional;
 	}
 
+	/**
+	\brief A record of a path which failed before the endgame, so has no endpoint: its index, the word `failed`, and the success code of the failure.
+	*/
+	template <typename IndexT, typename OutT>
+	static
+	void FailedPathRaw(IndexT const& ind, OutT & out, ZDT const& zd, std::string const& additional = "\n")
+	{
+		const auto& data = zd.FinalSolutionMetadata()[ind];
+		out << data.path_index << '\n'
+			<< "failed\n"
+			<< data.pre_endgame_success << '\n'
+			<< additional;
+	}
+
 
 };
 
 
+/**
+\brief Writes the results of a zero dim solve to a file path by path, as they are computed.
+
+The file starts with the number of variables, followed by a record for each path, in the order they finished.  A path which made it to the endgame has a record in the format of Classic::EndPointMDRaw, whatever the endgame returned, and one which failed before it has a record in the format of Classic::FailedPathRaw.  The records are written as the paths finish, so a file of a solve in progress holds the paths done so far.  At the end of the solve, the multiplicities are appended, after a line `multiplicities`, as a line `path_index solution_class multiplicity` for each path which made it to the endgame.
+
+Records are formatted by the thread which tracked the path, and written under a lock, so one of these can be used with any number of threads.
+
+\code
+auto sink = std::make_shared<output::StreamingClassic<decltype(zd)>>("raw_data");
+zd.StreamSolutions(sink);
+zd.Solve();
+\endcode
+*/
+template <typename ZDT>
+class StreamingClassic : public SolutionSink<ZDT>
+{
+public:
+
+	/**
+	\param filename The file to write.  Overwritten if it exists.
+	\throws std::runtime_error if the file can't be opened.
+	*/
+	explicit
+	StreamingClassic(std::string const& filename) : file_(filename, std::ios::trunc)
+	{
+		if (!file_)
+			throw std::runtime_error("unable to open " + filename + " for writing solutions");
+	}
+
+	void Started(ZDT const& zd) override
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		Classic<ZDT>::NumVariables(file_, zd, "\n\n");
+	}
+
+	void PathFinished(ZDT const& zd, std::size_t index) override
+	{
+		std::ostringstream record;
+		if (zd.FinalSolutionMetadata()[index].pre_endgame_success == SuccessCode::Success)
+			Classic<ZDT>::EndPointMDRaw(index, record, zd, "\n\n");
+		else
+			Classic<ZDT>::FailedPathRaw(index, record, zd, "\n\n");
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		file_ << record.str();
+		++num_written_;
+	}
+
+	void Finished(ZDT const& zd) override
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		file_ << "multiplicities\n";
+		for (const auto& data : zd.FinalSolutionMetadata())
+			if (data.endgame_success != SuccessCode::NeverStarted)
+				file_ << data.path_index << ' ' << data.solution_class << ' ' << data.multiplicity << '\n';
+		file_ << '\n';
+		file_.flush();
+	}
+
+	/**
+	\brief The number of paths written so far.
+	*/
+	std::size_t NumWritten() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return num_written_;
+	}
+
+private:
+	std::ofstream file_;
+	mutable std::mutex mutex_;
+	std::size_t num_written_ = 0;
+};
+
+
+
 struct NonsingularSolutions
 {
 
@@ -34,7 +34,11 @@
 
 #include "bertini2/detail/visitable.hpp"
 #include "bertini2/tracking.hpp"
+#include "bertini2/endgames/base_endgame.hpp"
 #include "bertini2/nag_algorithms/midpath_check.hpp"
+#include "bertini2/nag_algorithms/common/checkpoint.hpp"
+#include "bertini2/nag_algorithms/common/same_point_classes.hpp"
+#include "bertini2/nag_algorithms/common/solution_sink.hpp"
 #include "bertini2/io/generators.hpp"
 
 #include "bertini2/detail/configured.hpp"
@@ -43,7 +47,15 @@
 #include "bertini2/nag_algorithms/common/algorithm_base.hpp"
 #include "bertini2/nag_algorithms/common/config.hpp"
 #include "bertini2/nag_algorithms/common/policies.hpp"
+#include "bertini2/parallel/thread_pool.hpp"
+#include "bertini2/trackers/telemetry.hpp"
+#include <algorithm>
 #include <chrono>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
 
 
 namespace bertini {
@@ -129,6 +141,17 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 
 /// metadata structs
 
+			/**
+			\brief Where the time of one phase of a solve went.
+			*/
+			struct PhaseMetaData
+			{
+				std::chrono::microseconds elapsed_time{0}; ///< Wall-clock time spent in the phase.
+				SolnIndT number_paths_tracked = 0; ///< Counting a path as many times as it was tracked.
+				tracking::TrackingCounts tracker_counts; ///< Evaluations, factorizations, steps and changes of precision made by the trackers, summed over threads.
+			};
+
+
 			struct AlgorithmMetaData
 			{
 				SolnIndT number_path_failures = 0;
@@ -136,7 +159,14 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 				SolnIndT number_paths_tracked = 0;
 
 				std::chrono::system_clock::time_point start_time;
-				std::chrono::microseconds elapsed_time;
+				std::chrono::microseconds elapsed_time{0};
+
+				PhaseMetaData before_endgame; ///< Tracking from the start points to the endgame boundary.
+				PhaseMetaData endgame_boundary; ///< Checking for path crossings at the endgame boundary, and re-tracking crossed paths.
+				PhaseMetaData during_endgame; ///< Running the endgame on the paths which reached the boundary.
+				PhaseMetaData post_processing; ///< Computing multiplicities, etc.
+
+				unsigned number_midpath_resolve_attempts = 0; ///< The number of times crossed paths were re-tracked.
 			};
 
 
@@ -178,9 +208,30 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 				NumErrorT function_residual; 	// the latest function residual
 
 				int multiplicity = 1; 		// multiplicity
+				SolnIndT solution_class;	// the smallest path index of the endpoints at the same point as this one
 				bool is_real;       		// real flag:  0 - not real, 1 - real
 				bool is_finite;     		// finite flag: -1 - no finite/infinite distinction, 0 - infinite, 1 - finite
 				bool is_singular;       		// singular flag: 0 - non-sigular, 1 - singular
+
+				// the things added by post-processing are computed again when resuming, so are not saved
+				template <typename Archive>
+				void serialize(Archive& ar, const unsigned version)
+				{
+					ar & path_index;
+					ar & solution_index;
+					ar & precision_changed;
+					ar & time_of_first_prec_increase;
+					ar & max_precision_used;
+					ar & pre_endgame_success;
+					ar & condition_number;
+					ar & newton_residual;
+					ar & final_time_used;
+					ar & accuracy_estimate;
+					ar & accuracy_estimate_user_coords;
+					ar & cycle_num;
+					ar & endgame_success;
+					ar & function_residual;
+				}
 			};
 
 
@@ -195,6 +246,14 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 				EGBoundaryMetaData(Vec<BaseComplexType> const& pt, SuccessCode const& code, BaseRealType const& ss) :
 					path_point(pt), success_code(code), last_used_stepsize(ss)
 				{}
+
+				template <typename Archive>
+				void serialize(Archive& ar, const unsigned version)
+				{
+					ar & path_point;
+					ar & success_code;
+					ar & last_used_stepsize;
+				}
 					
 			};
 
@@ -434,24 +493,141 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			*/
 			void Solve()
 			{
+				metadata_ = AlgorithmMetaData();
+				metadata_.start_time = std::chrono::system_clock::now();
+				const auto start = std::chrono::steady_clock::now();
+
 				PreSolveChecks();
 
 				PreSolveSetup();
 
-				TrackBeforeEG();
+				OpenCheckpoint({});
+
+				TimePhase(metadata_.before_endgame, [this]{ TrackBeforeEG(); });
+
+				TimePhase(metadata_.endgame_boundary, [this]{ EGBoundaryAction(); });
+
+				TimePhase(metadata_.during_endgame, [this]{ TrackDuringEG(); });
 
-				EGBoundaryAction();
+				TimePhase(metadata_.post_processing, [this]{ PostEGAction(); });
 
-				TrackDuringEG();
+				checkpoint_.reset();
 
-				PostEGAction();
+				metadata_.elapsed_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
 			}
 
 
+			/**
+			\brief Finish a solve which was interrupted, from its checkpoint file.
+
+			The settings of the algorithm, and the target system, start system, and homotopy -- including the random numbers they were made with -- are restored from the checkpoint, replacing those of this object.  Paths which reached the endgame boundary, or finished their endgame, before the interruption are restored rather than tracked again, and the rest are tracked as usual.  The tracker and endgame are this object's own, so should be set up as they were for the interrupted solve.
+
+			If checkpointing, the new checkpoint holds the restored records, and replaces the old one once they are written, so the same file can be resumed from again.
+
+			\param filename The checkpoint file written by the interrupted solve.
+			\throws std::runtime_error if the file can't be read, or doesn't hold a checkpoint of a zero dim solve of this type.
+			*/
+			void Resume(std::string const& filename)
+			{
+				static_assert(std::is_same<StoredSystemT, SystemType>::value && std::is_same<StoredStartSystemT, StartSystemType>::value,
+				              "resuming replaces the systems, so requires a system management policy which owns them");
+
+				auto records = ReadCheckpoint(filename);
+				if (records.empty() || records.front().kind != CheckpointKind::Header)
+					throw std::runtime_error("checkpoint file " + filename + " doesn't start with the setup of a zero dim solve");
+
+				RestoreCheckpointHeader(records.front().payload);
+
+				metadata_ = AlgorithmMetaData();
+				metadata_.start_time = std::chrono::system_clock::now();
+				const auto start = std::chrono::steady_clock::now();
 
+				PreSolveChecks();
+
+				PreSolveSetup();
+
+				std::vector<bool> at_boundary(num_start_points_, false), finished(num_start_points_, false);
+				bool boundary_checked = false;
+				for (auto r = records.begin()+1; r != records.end(); ++r)
+				{
+					SolnIndT soln_ind;
+					SolutionMetaData smd;
+					switch (r->kind)
+					{
+						case CheckpointKind::Boundary:
+						{
+							EGBoundaryMetaData boundary;
+							FromCheckpointPayload(r->payload, soln_ind, boundary, smd);
+							solutions_at_endgame_boundary_.at(soln_ind) = boundary;
+							solution_final_metadata_.at(soln_ind) = smd;
+							at_boundary[soln_ind] = true;
+							break;
+						}
+						case CheckpointKind::BoundaryChecked:
+							boundary_checked = true;
+							break;
+						case CheckpointKind::Endgame:
+						{
+							Vec<BaseComplexType> endpoint;
+							FromCheckpointPayload(r->payload, soln_ind, endpoint, smd);
+							solutions_post_endgame_.at(soln_ind) = endpoint;
+							solution_final_metadata_.at(soln_ind) = smd;
+							finished[soln_ind] = true;
+							break;
+						}
+						default:
+							throw std::runtime_error("checkpoint file " + filename + " has a record of unknown kind");
+					}
+				}
+
+				OpenCheckpoint(std::vector<CheckpointRecord>(records.begin()+1, records.end()));
+
+				std::vector<SolnIndT> path_indices;
+				if (!boundary_checked)
+				{
+					for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
+						if (!at_boundary[ii])
+							path_indices.push_back(static_cast<SolnIndT>(ii));
+
+					TimePhase(metadata_.before_endgame, [&]{ TrackBeforeEG(path_indices); });
+
+					TimePhase(metadata_.endgame_boundary, [this]{ EGBoundaryAction(); });
+				}
+
+				path_indices.clear();
+				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
+				{
+					auto soln_ind = static_cast<SolnIndT>(ii);
+					if (!finished[ii])
+						path_indices.push_back(soln_ind);
+					else if (solution_sink_)
+						StreamSolution(soln_ind);
+				}
+
+				TimePhase(metadata_.during_endgame, [&]{ TrackDuringEG(path_indices); });
+
+				TimePhase(metadata_.post_processing, [this]{ PostEGAction(); });
+
+				checkpoint_.reset();
+
+				metadata_.elapsed_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+			}
+
+
+
+
+			/**
+			\brief Get the metadata about the latest solve as a whole: when it started, how long it took, and where the time went, by phase.
+			*/
+			const AlgorithmMetaData& AlgorithmMetadata() const
+			{
+				return metadata_;
+			}
 
 			/**
 			\brief Get the final computed solutions
+
+			When streaming solutions to a sink, these are released once passed to it, so are empty after solving.
 			*/
 			const auto& FinalSolutions() const
 			{
@@ -468,14 +644,274 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 
 			/**
 			\brief Get the solutions as computed at the endgame boundary
+
+			When streaming solutions to a sink, the points are released once the endgame is done with them, so are empty after solving.
 			*/
 			const auto& EndgameBoundaryData() const
 			{
 				return solutions_at_endgame_boundary_;
 			}
 
+
+			/**
+			\brief Record every step of tracking, before and during the endgame, into a trace file.
+
+			Each thread tracking paths records into a ring of its own, which the writer drains into the file in the background.  The writer must outlive the solves which record into it.
+
+			\param writer The writer of the trace file.  Pass `nullptr` to stop recording.
+			*/
+			void RecordSteps(std::shared_ptr<tracking::TraceWriter> const& writer)
+			{
+				trace_writer_ = writer;
+				if (trace_writer_)
+					step_recorder_.WriteTo(*trace_writer_);
+				else
+					step_recorder_.StopWriting();
+			}
+
+			/**
+			\brief Pass the results of each path to a sink as soon as its endgame is done, instead of holding them all until the end of the solve.
+
+			Every path is passed to the sink, those which failed before the endgame as well, when the endgame would have started on them.  Once passed to the sink, a path's endpoint and endgame boundary point are released, and only a copy of the endpoint in double precision, for computing multiplicities, and the metadata are kept.  The sink is told the multiplicities when it is Finished.
+
+			So streaming bounds the memory for the full-precision points, but not all the memory of a solve: the metadata and the compact endpoints are kept for every path, since grouping the endpoints into classes of the same point needs all of them, and memory remains linear in the number of paths.
+
+			\param sink The sink to stream into.  Pass `nullptr` to keep everything in memory again.
+			*/
+			void StreamSolutions(std::shared_ptr<SolutionSink<ZeroDim>> const& sink)
+			{
+				solution_sink_ = sink;
+			}
+
+
+			/**
+			\brief Checkpoint solves into a file, so that they can be resumed if interrupted.
+
+			The file starts with the settings and systems of the solve, and a record is appended as each path reaches the endgame boundary, once crossed paths are resolved, and as each path finishes its endgame.  Records are serialized by the thread which tracked the path, and the file is only ever appended to, so checkpointing doesn't wait on writing out the whole state.
+
+			\param filename The file to checkpoint into.  Overwritten by each solve.  Pass an empty name to stop checkpointing.
+			\param flush_interval How often the records are flushed to disk.  Records not yet flushed when a run dies are lost, and their paths tracked again when resuming.
+
+			\see Resume
+			*/
+			void CheckpointTo(std::string const& filename, std::chrono::milliseconds flush_interval = std::chrono::seconds(10))
+			{
+				checkpoint_filename_ = filename;
+				checkpoint_flush_interval_ = flush_interval;
+			}
+
 		private:
 
+			/**
+			\brief The kinds of records in a checkpoint file.
+			*/
+			struct CheckpointKind
+			{
+				static constexpr char Header = 'H'; ///< The settings and systems.  The first record.
+				static constexpr char Boundary = 'B'; ///< A path at the endgame boundary, with its metadata so far.
+				static constexpr char BoundaryChecked = 'C'; ///< Crossed paths at the endgame boundary were resolved.
+				static constexpr char Endgame = 'E'; ///< A path after its endgame, with its metadata.
+			};
+
+
+			/**
+			\brief Start a new checkpoint file, if checkpointing, with the settings and systems, and any records restored from an earlier one.
+
+			The file is written under a temporary name, and moved into place once the restored records are in it, so resuming from it again is safe even if this run dies right away.
+			*/
+			void OpenCheckpoint(std::vector<CheckpointRecord> const& restored)
+			{
+				checkpoint_.reset();
+				if (checkpoint_filename_.empty())
+					return;
+
+				const auto temporary = checkpoint_filename_ + ".new";
+				checkpoint_ = std::make_shared<CheckpointWriter>(temporary, checkpoint_flush_interval_);
+
+				checkpoint_->Append(CheckpointKind::Header,
+				                    ToCheckpointPayload(this->template Get<Tolerances>(), this->template Get<PostProcessing>(),
+				                                        this->template Get<ZeroDimConf>(), this->template Get<AutoRetrack>(),
+				                                        TargetSystem(), StartSystem(), Homotopy(), num_start_points_));
+				for (auto const& r : restored)
+					checkpoint_->Append(r.kind, r.payload);
+				checkpoint_->Flush();
+
+				if (std::rename(temporary.c_str(), checkpoint_filename_.c_str()) != 0)
+					throw std::runtime_error("unable to move checkpoint file " + temporary + " to " + checkpoint_filename_);
+			}
+
+
+			/**
+			\brief Restore the settings and systems from the first record of a checkpoint file.
+			*/
+			void RestoreCheckpointHeader(std::string const& payload)
+			{
+				Tolerances tolerances;
+				PostProcessing post_processing;
+				ZeroDimConf zero_dim;
+				AutoRetrack auto_retrack;
+				SystemType target, homotopy;
+				StartSystemType start;
+				decltype(num_start_points_) num_start_points;
+
+				FromCheckpointPayload(payload, tolerances, post_processing, zero_dim, auto_retrack, target, start, homotopy, num_start_points);
+
+				this->template Set<Tolerances>(tolerances);
+				this->template Set<PostProcessing>(post_processing);
+				this->template Set<ZeroDimConf>(zero_dim);
+				this->template Set<AutoRetrack>(auto_retrack);
+
+				SystemManagementPolicy::TargetSystem(target);
+				SystemManagementPolicy::StartSystem(start);
+				SystemManagementPolicy::Homotopy(homotopy);
+				num_start_points_ = num_start_points;
+
+				tracker_.SetSystem(Homotopy());
+			}
+
+
+			/**
+			\brief References to the objects used to track a single path.
+
+			When tracking serially, these refer to the algorithm's own tracker, endgame, target system, and observers.  When tracking with several threads, they refer to the objects owned by one PathWorker.
+			*/
+			struct PathContext
+			{
+				TrackerType & tracker;
+				EndgameType & endgame;
+				const SystemType & target_system;
+				tracking::FirstPrecisionRecorder<TrackerType> & first_prec_rec;
+				tracking::MinMaxPrecisionRecorder<TrackerType> & min_max_prec;
+				tracking::StepRecorder<TrackerType> & step_recorder;
+			};
+
+
+			/**
+			\brief The objects owned by one thread, when tracking with more than one thread.
+
+			The homotopy and target system are clones of the algorithm's, because evaluating a system changes its internal state.  The tracker and endgame are copies of the algorithm's, so they have the same settings, re-associated with the cloned systems.  Observers attached to the algorithm's tracker and endgame are not carried over to the copies.
+			*/
+			struct PathWorker
+			{
+				SystemType homotopy;
+				SystemType target_system;
+				TrackerType tracker;
+				EndgameType endgame;
+				tracking::FirstPrecisionRecorder<TrackerType> first_prec_rec;
+				tracking::MinMaxPrecisionRecorder<TrackerType> min_max_prec;
+				tracking::StepRecorder<TrackerType> step_recorder;
+
+				PathWorker(SystemType const& hom, SystemType const& target, TrackerType const& tr, EndgameType const& eg) :
+					homotopy(Clone(hom)), target_system(Clone(target)), tracker(tr), endgame(eg)
+				{
+					homotopy.precision(hom.precision());
+					target_system.precision(target.precision());
+
+					tracker.RemoveAllObservers();
+					tracker.SeparatePredictorCorrector();
+					tracker.SetSystem(homotopy);
+
+					endgame.RemoveAllObservers();
+					endgame.SetTracker(tracker);
+				}
+
+				// the tracker and endgame refer to the other members, so no copying
+				PathWorker(PathWorker const&) = delete;
+				PathWorker& operator=(PathWorker const&) = delete;
+
+				PathContext Context()
+				{
+					return {tracker, endgame, target_system, first_prec_rec, min_max_prec, step_recorder};
+				}
+			};
+
+
+			/**
+			\brief The start points of a collection of paths, made in chunks as the paths are handed out to be tracked.
+
+			A chunk is the start points of consecutive positions in the collection, so the chunks follow the queue of ForEachPath, which hands out the paths in order.  A chunk is made when the first of its paths is handed out, and released once all of them have been, so only the chunks of the paths being started are held, rather than all the start points of a solve.  Chunks of consecutive start points are made as a StartPointBlock, and the others point by point.
+
+			Start systems are not required to be able to make start points concurrently, so chunks are made under a lock.
+			*/
+			class StartPointQueue
+			{
+			public:
+
+				StartPointQueue(StartSystemType const& start_system, std::vector<SolnIndT> const& path_indices, unsigned precision) :
+					start_system_(start_system), path_indices_(path_indices), precision_(precision)
+				{}
+
+				/**
+				\brief Get the start point of the path at a position in the collection, at the initial ambient precision, which becomes the default precision of the calling thread.
+				*/
+				Vec<BaseComplexType> Take(std::size_t position)
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					DefaultPrecision(precision_);
+
+					const auto chunk_index = position / ChunkSize;
+					auto found = chunks_.find(chunk_index);
+					if (found==chunks_.end())
+						found = chunks_.emplace(chunk_index, MakeChunk(chunk_index)).first;
+
+					auto& chunk = found->second;
+					Vec<BaseComplexType> point = std::move(chunk.points[position - chunk_index*ChunkSize]);
+					if (++chunk.num_taken == chunk.points.size())
+						chunks_.erase(found);
+					return point;
+				}
+
+				static constexpr std::size_t ChunkSize = 1024; ///< The number of start points in a chunk.
+
+			private:
+
+				struct Chunk
+				{
+					std::vector<Vec<BaseComplexType>> points;
+					std::size_t num_taken = 0;
+				};
+
+				Chunk MakeChunk(std::size_t chunk_index) const
+				{
+					const auto begin = chunk_index*ChunkSize;
+					const auto end = std::min(begin + ChunkSize, path_indices_.size());
+
+					bool consecutive = true;
+					for (auto ii = begin+1; ii < end && consecutive; ++ii)
+						consecutive = path_indices_[ii] == path_indices_[ii-1] + 1;
+
+					Chunk chunk;
+					chunk.points.reserve(end - begin);
+					if (consecutive)
+					{
+						const auto block = start_system_.template StartPoints<BaseComplexType>(path_indices_[begin], end - begin);
+						for (auto ii = begin; ii < end; ++ii)
+							chunk.points.push_back(block.Point(path_indices_[ii]));
+					}
+					else
+						for (auto ii = begin; ii < end; ++ii)
+							chunk.points.push_back(start_system_.template StartPoint<BaseComplexType>(path_indices_[ii]));
+					return chunk;
+				}
+
+				StartSystemType const& start_system_;
+				std::vector<SolnIndT> const& path_indices_;
+				const unsigned precision_;
+
+				std::mutex mutex_;
+				std::map<std::size_t, Chunk> chunks_; ///< the chunks made and not yet all taken, by index.
+			};
+
+
+			/**
+			\brief Get references to the algorithm's own tracker, endgame, etc, for tracking serially.
+			*/
+			PathContext SerialContext()
+			{
+				return {tracker_, endgame_, TargetSystem(), first_prec_rec_, min_max_prec_, step_recorder_};
+			}
+
+
 			/**
 			\brief Check that the solver functor is ready to go.
 			*/
@@ -490,13 +926,106 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			{
 				auto num_as_size_t = static_cast<SolnIndT>(num_start_points_);
 
-				solution_final_metadata_.resize(num_as_size_t);
+				solution_final_metadata_.assign(num_as_size_t, SolutionMetaData());
 				solutions_at_endgame_boundary_.resize(num_as_size_t);
 				solutions_post_endgame_.resize(num_as_size_t);
 
 				SetMidpathRetrackTol(this->template Get<Tolerances>().newton_before_endgame);
+
+				SetUpWorkers();
+
+				compact_endpoints_.clear();
+				if (solution_sink_)
+				{
+					compact_endpoints_.resize(num_as_size_t);
+					solution_sink_->Started(*this);
+				}
 			}
 
+
+			/**
+			\brief Make the per-thread copies of the systems, tracker, and endgame, if tracking with more than one thread.
+
+			Changes made to the tracker or endgame after this point are not seen by the workers, so this is done at the start of every solve.
+			*/
+			void SetUpWorkers()
+			{
+				workers_.clear();
+
+				auto num_threads = parallel::NumThreads(this->template Get<ZeroDimConf>().num_threads);
+				if (num_threads < 2)
+					return;
+
+				workers_.reserve(num_threads);
+				for (unsigned ii{0}; ii < num_threads; ++ii)
+				{
+					workers_.push_back(std::make_shared<PathWorker>(Homotopy(), TargetSystem(), GetTracker(), GetEndgame()));
+					if (trace_writer_)
+						workers_.back()->step_recorder.WriteTo(*trace_writer_);
+				}
+			}
+
+
+			/**
+			\brief Run one phase of a solve, recording its wall-clock time, and the work done by the trackers during it.
+
+			The counts of the algorithm's tracker and those of the workers are reset at the start of the phase, so counts made by using the tracker outside of a solve are lost.
+			*/
+			template<typename F>
+			void TimePhase(PhaseMetaData & phase, F const& f)
+			{
+				GetTracker().ResetCounts();
+				for (auto& w : workers_)
+					w->tracker.ResetCounts();
+
+				const auto start = std::chrono::steady_clock::now();
+				f();
+				phase.elapsed_time += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+				phase.tracker_counts += GetTracker().Counts();
+				for (auto& w : workers_)
+					phase.tracker_counts += w->tracker.Counts();
+			}
+
+
+			/**
+			\brief Set the tracking tolerance for the algorithm's tracker, and for those of the workers.
+			*/
+			void SetTrackingTolerances(NumErrorT const& tol)
+			{
+				GetTracker().SetTrackingTolerance(tol);
+				for (auto& w : workers_)
+					w->tracker.SetTrackingTolerance(tol);
+			}
+
+
+			/**
+			\brief Run a function for each of a collection of paths, either serially or spread over the workers.
+
+			Paths are handed out to the workers one at a time, as each finishes its previous path.  Since every path is tracked from scratch, and its results stored by its index, the results are the same regardless of the number of workers, and of which worker tracked which path.
+
+			\param path_indices The indices of the paths.
+			\param f The function to run, called as `f(ii, context)`, where `ii` is the position in path_indices of the path to work on, and `context` contains the objects to work with.
+			*/
+			template<typename F>
+			void ForEachPath(std::vector<SolnIndT> const& path_indices, F const& f)
+			{
+				if (workers_.empty())
+				{
+					auto context = SerialContext();
+					for (std::size_t ii{0}; ii < path_indices.size(); ++ii)
+						f(ii, context);
+				}
+				else
+					parallel::ForEachIndex(path_indices.size(), static_cast<unsigned>(workers_.size()),
+						[&](unsigned worker_index, std::size_t ii)
+						{
+							auto context = workers_[worker_index]->Context();
+							f(ii, context);
+						});
+			}
+
+
 			/**
 			\brief Track from the start point in time, from each start point of the start system, to the endgame boundary.
 
@@ -505,18 +1034,41 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			The point at the endgame boundary, as well as the success flag, and the stepsize, are all stored.
 			*/
 			void TrackBeforeEG()
+			{
+				std::vector<SolnIndT> path_indices(static_cast<SolnIndT>(num_start_points_));
+				std::iota(path_indices.begin(), path_indices.end(), SolnIndT{0});
+
+				TrackBeforeEG(path_indices);
+			}
+
+
+			/**
+			\brief Track some of the paths to the endgame boundary, with the tolerances for doing so.
+			*/
+			void TrackBeforeEG(std::vector<SolnIndT> const& path_indices)
 			{
 				DefaultPrecision(this->template Get<ZeroDimConf>().initial_ambient_precision);
 
-				GetTracker().SetTrackingTolerance(this->template Get<Tolerances>().newton_before_endgame);
+				SetTrackingTolerances(this->template Get<Tolerances>().newton_before_endgame);
 
-				auto t_start = this->template Get<ZeroDimConf>().start_time;
-				auto t_endgame_boundary = this->template Get<ZeroDimConf>().endgame_boundary;
+				metadata_.before_endgame.number_paths_tracked += path_indices.size();
+				TrackPathsBeforeEG(path_indices);
+			}
 
-				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
+
+			/**
+			\brief Track a collection of paths to the endgame boundary.
+
+			The start points are made in chunks as the paths are handed out, by a StartPointQueue.
+			*/
+			void TrackPathsBeforeEG(std::vector<SolnIndT> const& path_indices)
+			{
+				StartPointQueue start_points(StartSystem(), path_indices, this->template Get<ZeroDimConf>().initial_ambient_precision);
+
+				ForEachPath(path_indices, [&](std::size_t ii, PathContext & context)
 				{
-					TrackSinglePathBeforeEG(static_cast<SolnIndT>(ii));
-				}
+					TrackSinglePathBeforeEG(path_indices[ii], start_points.Take(ii), context);
+				});
 			}
 
 
@@ -524,13 +1076,21 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			/**
 			 /brief Track a single path before we reach the endgame boundary.
 			*/
-			void TrackSinglePathBeforeEG(SolnIndT soln_ind)
+			void TrackSinglePathBeforeEG(SolnIndT soln_ind, Vec<BaseComplexType> const& start_point, PathContext & context)
 			{
+					auto& tracker = context.tracker;
+
 					// if you can think of a way to replace this `if` with something meta, please do so.
 					if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
 					{
-						GetTracker().AddObserver(first_prec_rec_);
-						GetTracker().AddObserver(min_max_prec_);
+						tracker.AddObserver(context.first_prec_rec);
+						tracker.AddObserver(context.min_max_prec);
+					}
+
+					if (context.step_recorder.IsWriting())
+					{
+						context.step_recorder.SetPath(soln_ind);
+						tracker.AddObserver(context.step_recorder);
 					}
 
 					auto& smd = solution_final_metadata_[soln_ind];
@@ -541,45 +1101,57 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 				DefaultPrecision(this->template Get<ZeroDimConf>().initial_ambient_precision);
 				auto t_start = this->template Get<ZeroDimConf>().start_time;
 				auto t_endgame_boundary = this->template Get<ZeroDimConf>().endgame_boundary;
-				auto start_point = StartSystem().template StartPoint<BaseComplexType>(soln_ind);
+
+				// the endgame turns this off, and paths must not depend on which path was tracked before them
+				tracker.ReinitializeInitialStepSize(true);
 
 				Vec<BaseComplexType> result;
-				auto tracking_success = GetTracker().TrackPath(result, t_start, t_endgame_boundary, start_point);
+				auto tracking_success = tracker.TrackPath(result, t_start, t_endgame_boundary, start_point);
 
-				solutions_at_endgame_boundary_[soln_ind] = EGBoundaryMetaData({ result, tracking_success, GetTracker().CurrentStepsize() });
+				solutions_at_endgame_boundary_[soln_ind] = EGBoundaryMetaData({ result, tracking_success, tracker.CurrentStepsize() });
 
 					smd.pre_endgame_success = tracking_success;
 
+					tracker.RemoveObserver(context.step_recorder);
+
 					// if you can think of a way to replace this `if` with something meta, please do so.
 					if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
 					{
-						if (first_prec_rec_.DidPrecisionIncrease())
+						if (context.first_prec_rec.DidPrecisionIncrease())
 						{
 							smd.precision_changed = true;
-							smd.time_of_first_prec_increase = first_prec_rec_.TimeOfIncrease();
+							smd.time_of_first_prec_increase = context.first_prec_rec.TimeOfIncrease();
 						}
 						else
-						GetTracker().RemoveObserver(first_prec_rec_);
-						GetTracker().RemoveObserver(min_max_prec_);
+						tracker.RemoveObserver(context.first_prec_rec);
+						tracker.RemoveObserver(context.min_max_prec);
 						using std::max;
 						smd.max_precision_used =
-							max(smd.max_precision_used, min_max_prec_.MaxPrecision());
+							max(smd.max_precision_used, context.min_max_prec.MaxPrecision());
 					}
 
-
+				if (checkpoint_)
+					checkpoint_->Append(CheckpointKind::Boundary, ToCheckpointPayload(soln_ind, solutions_at_endgame_boundary_[soln_ind], smd));
 			}
 
 			void EGBoundaryAction()
 			{
+				// the start points of crossed paths are made by the checker as it needs them
+				DefaultPrecision(this->template Get<ZeroDimConf>().initial_ambient_precision);
 				auto midcheckpassed = midpath_.Check(solutions_at_endgame_boundary_, StartSystem());
 
 				unsigned num_resolve_attempts = 0;
 				while (!midcheckpassed && num_resolve_attempts < this->template Get<ZeroDimConf>().max_num_crossed_path_resolve_attempts)
 				{
 					MidpathResolve();
+					DefaultPrecision(this->template Get<ZeroDimConf>().initial_ambient_precision);
 					midcheckpassed = midpath_.Check(solutions_at_endgame_boundary_, StartSystem());
 					num_resolve_attempts++;
 				}
+				metadata_.number_midpath_resolve_attempts = num_resolve_attempts;
+
+				if (checkpoint_)
+					checkpoint_->Append(CheckpointKind::BoundaryChecked, ToCheckpointPayload(num_resolve_attempts));
 			}
 
 
@@ -587,72 +1159,110 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			{
 				ShrinkMidpathTolerance();
 
+				std::vector<SolnIndT> path_indices;
 				for(auto const& v : midpath_.GetCrossedPaths())
 				{
 					if(v.rerun())
 					{
 						unsigned long long index = v.index();
-						auto soln_ind = static_cast<SolnIndT>(index);
-						TrackSinglePathBeforeEG(soln_ind);
+						path_indices.push_back(static_cast<SolnIndT>(index));
 					}
 				}
 
+				metadata_.endgame_boundary.number_paths_tracked += path_indices.size();
+				TrackPathsBeforeEG(path_indices);
 			}
 
 
 			void ShrinkMidpathTolerance()
 			{
 				midpath_retrack_tolerance_ *= this->template Get<AutoRetrack>().midpath_decrease_tolerance_factor;
-				GetTracker().SetTrackingTolerance(midpath_retrack_tolerance_);
+				SetTrackingTolerances(midpath_retrack_tolerance_);
 			}
 
 
 
 			void TrackDuringEG()
 			{
+				std::vector<SolnIndT> candidates(static_cast<SolnIndT>(num_start_points_));
+				std::iota(candidates.begin(), candidates.end(), SolnIndT{0});
 
-				GetTracker().SetTrackingTolerance(this->template Get<Tolerances>().newton_during_endgame);
+				TrackDuringEG(candidates);
+			}
 
-				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
-				{
-					auto soln_ind = static_cast<SolnIndT>(ii);
 
+			/**
+			\brief Run the endgame on those of some paths which reached the endgame boundary.
+			*/
+			void TrackDuringEG(std::vector<SolnIndT> const& candidates)
+			{
+
+				SetTrackingTolerances(this->template Get<Tolerances>().newton_during_endgame);
+
+				std::vector<SolnIndT> path_indices;
+				for (auto soln_ind : candidates)
+				{
 					if (solution_final_metadata_[soln_ind].pre_endgame_success != SuccessCode::Success)
+					{
+						// the endgame isn't run on these, so they are finished, failed
+						if (solution_sink_)
+							StreamSolution(soln_ind);
 						continue;
+					}
 
-					TrackSinglePathDuringEG(soln_ind);
+					path_indices.push_back(soln_ind);
 				}
+
+				metadata_.during_endgame.number_paths_tracked += path_indices.size();
+				ForEachPath(path_indices, [&](std::size_t ii, PathContext & context)
+				{
+					TrackSinglePathDuringEG(path_indices[ii], context);
+				});
 			}
 
 
-			void TrackSinglePathDuringEG(SolnIndT soln_ind)
+			void TrackSinglePathDuringEG(SolnIndT soln_ind, PathContext & context)
 			{
+					auto& tracker = context.tracker;
+					auto& endgame = context.endgame;
+					auto& target_system = context.target_system;
 
 					auto& smd = solution_final_metadata_[soln_ind];
 					// if you can think of a way to replace this `if` with something meta, please do so.
 					if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
 					{
 						if (!smd.precision_changed)
-							GetTracker().AddObserver(first_prec_rec_);
-						GetTracker().AddObserver(min_max_prec_);
+							tracker.AddObserver(context.first_prec_rec);
+						tracker.AddObserver(context.min_max_prec);
+					}
+
+					if (context.step_recorder.IsWriting())
+					{
+						context.step_recorder.SetPath(soln_ind);
+						tracker.AddObserver(context.step_recorder);
 					}
 
 				const auto& bdry_point = solutions_at_endgame_boundary_[soln_ind].path_point;
 
 
-				GetTracker().SetStepSize(solutions_at_endgame_boundary_[soln_ind].last_used_stepsize);
-				GetTracker().ReinitializeInitialStepSize(false);
+				tracker.SetStepSize(solutions_at_endgame_boundary_[soln_ind].last_used_stepsize);
+				tracker.ReinitializeInitialStepSize(false);
 
 				DefaultPrecision(Precision(bdry_point));
 				// we make these fresh so they are in the correct precision to start.
 				BaseComplexType t_end = this->template Get<ZeroDimConf>().target_time;
 				BaseComplexType t_endgame_boundary = this->template Get<ZeroDimConf>().endgame_boundary;
 
-				auto eg_success = GetEndgame().Run(t_endgame_boundary, bdry_point, t_end);
+				// seeded by the index of the path, so the path's endgame is the same whichever thread runs it, and no thread draws from the shared generators
+				endgame.SetNextRandVec(bertini::endgame::PathRandomVector<BaseComplexType>(soln_ind, bdry_point.size()));
+
+				auto eg_success = endgame.Run(t_endgame_boundary, bdry_point, t_end);
 
-				solutions_post_endgame_[soln_ind] = GetEndgame().template FinalApproximation<BaseComplexType>();
+				solutions_post_endgame_[soln_ind] = endgame.template FinalApproximation<BaseComplexType>();
 
 
+					tracker.RemoveObserver(context.step_recorder);
+
 					// finally, store the metadata as necessary
 					smd.endgame_success = eg_success;
 						// if you can think of a way to replace this `if` with something meta, please do so.
@@ -660,42 +1270,72 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 					{
 						if (!smd.precision_changed)
 						{
-							if (first_prec_rec_.DidPrecisionIncrease())
+							if (context.first_prec_rec.DidPrecisionIncrease())
 							{
 								smd.precision_changed = true;
-								smd.time_of_first_prec_increase = first_prec_rec_.TimeOfIncrease();
+								smd.time_of_first_prec_increase = context.first_prec_rec.TimeOfIncrease();
 							}
 						}
-						GetTracker().RemoveObserver(first_prec_rec_);
-						GetTracker().RemoveObserver(min_max_prec_);
+						tracker.RemoveObserver(context.first_prec_rec);
+						tracker.RemoveObserver(context.min_max_prec);
 						using std::max;
 						smd.max_precision_used =
-							max(smd.max_precision_used, min_max_prec_.MaxPrecision());
+							max(smd.max_precision_used, context.min_max_prec.MaxPrecision());
 					}
 					if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
 					{
-						assert(Precision(solutions_post_endgame_[soln_ind])==Precision(GetEndgame().template FinalApproximation<BaseComplexType>()));
+						assert(Precision(solutions_post_endgame_[soln_ind])==Precision(endgame.template FinalApproximation<BaseComplexType>()));
 						DefaultPrecision(Precision(solutions_post_endgame_[soln_ind]));
-						TargetSystem().precision(Precision(solutions_post_endgame_[soln_ind]));
+						target_system.precision(Precision(solutions_post_endgame_[soln_ind]));
 					}
-					smd.function_residual = static_cast<NumErrorT>(TargetSystem().Eval(solutions_post_endgame_[soln_ind]).template lpNorm<Eigen::Infinity>());
-					smd.final_time_used = GetEndgame().LatestTime();
-					smd.condition_number = GetTracker().LatestConditionNumber();
-					smd.newton_residual = GetTracker().LatestNormOfStep();
+					smd.function_residual = static_cast<NumErrorT>(target_system.Eval(solutions_post_endgame_[soln_ind]).template lpNorm<Eigen::Infinity>());
+					smd.final_time_used = endgame.LatestTime();
+					smd.condition_number = tracker.LatestConditionNumber();
+					smd.newton_residual = tracker.LatestNormOfStep();
 
-					smd.accuracy_estimate = GetEndgame().ApproximateError();
+					smd.accuracy_estimate = endgame.ApproximateError();
 					smd.accuracy_estimate_user_coords =
-						static_cast<NumErrorT>( (TargetSystem().DehomogenizePoint(solutions_post_endgame_[soln_ind]) -
-						TargetSystem().DehomogenizePoint(GetEndgame().template PreviousApproximation<BaseComplexType>())).template lpNorm<Eigen::Infinity>() );
-					smd.cycle_num = GetEndgame().CycleNumber();
+						static_cast<NumErrorT>( (target_system.DehomogenizePoint(solutions_post_endgame_[soln_ind]) -
+						target_system.DehomogenizePoint(endgame.template PreviousApproximation<BaseComplexType>())).template lpNorm<Eigen::Infinity>() );
+					smd.cycle_num = endgame.CycleNumber();
 					// end metadata gathering
+
+				if (checkpoint_)
+					checkpoint_->Append(CheckpointKind::Endgame, ToCheckpointPayload(soln_ind, solutions_post_endgame_[soln_ind], smd));
+
+				if (solution_sink_)
+					StreamSolution(soln_ind);
 			}
 
 
+			/**
+			\brief Pass the results of a path to the sink, and release all but a compact copy of its endpoint.
+
+			Called for every path, from the thread which tracked it if it made it to the endgame, and touches only the data of that path.  A path which failed before the endgame has no endpoint, and its compact copy is empty.
+			*/
+			void StreamSolution(SolnIndT soln_ind)
+			{
+				solution_sink_->PathFinished(*this, soln_ind);
+
+				auto& endpoint = solutions_post_endgame_[soln_ind];
+				auto& compact = compact_endpoints_[soln_ind];
+				compact.resize(endpoint.size());
+				for (int ii = 0; ii < endpoint.size(); ++ii)
+					compact(ii) = static_cast<dbl>(endpoint(ii));
+
+				endpoint = Vec<BaseComplexType>();
+				solutions_at_endgame_boundary_[soln_ind].path_point = Vec<BaseComplexType>();
+			}
 
 			void PostEGAction()
 			{
 				ComputePostTrackMetadata();
+
+				if (solution_sink_)
+				{
+					solution_sink_->Finished(*this);
+					compact_endpoints_.clear();
+				}
 			}
 
 
@@ -708,30 +1348,39 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			void ComputePostTrackMetadata()
 			{
 				ComputeMultiplicities();
+
+				metadata_.number_paths_tracked = static_cast<SolnIndT>(num_start_points_);
+				metadata_.number_path_successes = static_cast<SolnIndT>(std::count_if(solution_final_metadata_.begin(), solution_final_metadata_.end(),
+				                                  [](SolutionMetaData const& smd){ return smd.endgame_success==SuccessCode::Success; }));
+				metadata_.number_path_failures = metadata_.number_paths_tracked - metadata_.number_path_successes;
 			}
 
+			/**
+			\brief Group the successful endpoints into classes of the same point, and set their multiplicities to the sizes of their classes.
+
+			Endpoints are the same if the 2-norm of their difference is less than the post-processing same point tolerance.  When streaming solutions, the endpoints have been released, and their copies in double precision are compared instead.
+			*/
 			void ComputeMultiplicities()
 			{
-				std::vector<std::vector<int>> multiplicity_indices(num_start_points_);
-
+				std::vector<bool> successful(num_start_points_);
 				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
-				{
-					if (solution_final_metadata_[ii].endgame_success!=SuccessCode::Success)
-						continue;
+					successful[ii] = solution_final_metadata_[ii].endgame_success==SuccessCode::Success;
 
-					for (decltype(num_start_points_) jj{ii+1}; jj < num_start_points_; ++jj)
-					{
-						if (solution_final_metadata_[jj].endgame_success!=SuccessCode::Success)
-							continue;
+				const auto tolerance = this->template Get<PostProcessing>().same_point_tolerance;
+				const auto num_threads = parallel::NumThreads(this->template Get<ZeroDimConf>().num_threads);
+				const auto classes = solution_sink_ ? SamePointClasses(compact_endpoints_, successful, tolerance, num_threads)
+				                                    : SamePointClasses(solutions_post_endgame_, successful, tolerance, num_threads);
 
-						if ( (solutions_post_endgame_[ii] - solutions_post_endgame_[jj]).norm() < this->template Get<PostProcessing>().same_point_tolerance)
-						{
-							multiplicity_indices[ii].push_back(jj);
-							multiplicity_indices[jj].push_back(ii);
-							++solution_final_metadata_[ii].multiplicity;
-							++solution_final_metadata_[jj].multiplicity;
-						}
-					}
+				std::vector<int> class_sizes(num_start_points_, 0);
+				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
+					if (successful[ii])
+						++class_sizes[classes[ii]];
+
+				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
+				{
+					auto& smd = solution_final_metadata_[ii];
+					smd.solution_class = classes[ii];
+					smd.multiplicity = successful[ii] ? class_sizes[classes[ii]] : 1;
 				}
 			}
 
@@ -749,6 +1398,8 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			// i feel like these should be factored out into some policy class which prescribes how they are used, so that the actions taken are customizable.
 			tracking::FirstPrecisionRecorder<TrackerType> first_prec_rec_;
 			tracking::MinMaxPrecisionRecorder<TrackerType> min_max_prec_;
+			tracking::StepRecorder<TrackerType> step_recorder_; ///< records steps into trace_writer_, if there is one.
+			std::shared_ptr<tracking::TraceWriter> trace_writer_;
 
 
 			/// function objects used during the algorithm
@@ -762,6 +1413,18 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			SolnCont< EGBoundaryMetaData > solutions_at_endgame_boundary_; // the BaseRealType is the last used stepsize
 			SolnCont<Vec<BaseComplexType> > solutions_post_endgame_;
 			SolnCont<SolutionMetaData> solution_final_metadata_;
+			AlgorithmMetaData metadata_;
+
+			std::shared_ptr<SolutionSink<ZeroDim>> solution_sink_; ///< where the results of each path go when finished, if anywhere.
+			std::vector<Vec<dbl>> compact_endpoints_; ///< the endpoints in double precision, for computing multiplicities, when streaming.
+
+			std::string checkpoint_filename_; ///< where to checkpoint solves, if anywhere.
+			std::chrono::milliseconds checkpoint_flush_interval_{std::chrono::seconds(10)};
+			std::shared_ptr<CheckpointWriter> checkpoint_; ///< open only during a solve.
+
+
+			/// per-thread copies of the objects used for tracking.  empty when tracking serially.  rebuilt at the start of every solve.
+			std::vector<std::shared_ptr<PathWorker>> workers_;
 
 
 		}; // struct ZeroDim
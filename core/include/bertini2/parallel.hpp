@@ -27,3 +27,4 @@
 */
 
 #include "bertini2/parallel/initialize_finalize.hpp"
+#include "bertini2/parallel/thread_pool.hpp"
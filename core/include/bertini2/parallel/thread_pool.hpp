@@ -0,0 +1,124 @@
+//This file is part of Bertini 2.
+//
+//bertini2/parallel/thread_pool.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/parallel/thread_pool.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/parallel/thread_pool.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+
+/**
+\file bertini2/parallel/thread_pool.hpp
+
+\brief Provides a small shared-memory worker pool, for distributing independent tasks such as path tracking over threads.
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "bertini2/mpfr_complex.hpp"
+
+namespace bertini{
+
+	namespace parallel{
+
+	/**
+	\brief Turn a requested number of threads into an actual number of threads.
+
+	\param requested The number of threads asked for.  0 means to use as many as the hardware supports.
+	\return The number of threads to use, always at least 1.
+	*/
+	inline
+	unsigned NumThreads(unsigned requested)
+	{
+		if (requested==0)
+			requested = std::thread::hardware_concurrency();
+		return requested==0 ? 1 : requested;
+	}
+
+
+	/**
+	\brief Run a task for every index in [0, num_tasks), spreading the indices over a pool of worker threads.
+
+	The indices live in a shared queue (an atomic counter), from which each worker claims the next unclaimed index as soon as it finishes its previous one.  Expensive tasks therefore don't hold up the cheap ones.  The calling thread acts as worker 0, and `num_workers-1` additional threads are started, and joined before returning.
+
+	The task is called as `task(worker_index, task_index)`.  The worker index is in [0, num_workers), and is intended for addressing per-worker state, such as a tracker owned by that worker.  Two calls with the same worker index never run concurrently.  Tasks should write their results by task index, so that the outcome doesn't depend on which worker ran which task.
+
+	Each started thread inherits the default precision and variable precision options of the calling thread, since these are thread-local for multiprecision numbers.
+
+	If any task throws, no further tasks are started, and the first exception caught is rethrown in the calling thread once all workers have stopped.
+
+	\param num_tasks The number of tasks to run.
+	\param num_workers The number of workers to use.  Must be positive.
+	\param task The function to run for each task.
+	*/
+	template<typename TaskT>
+	void ForEachIndex(std::size_t num_tasks, unsigned num_workers, TaskT const& task)
+	{
+		if (num_workers==0)
+			throw std::runtime_error("number of workers for ForEachIndex must be positive");
+
+		std::atomic<std::size_t> next_task{0};
+		std::atomic<bool> failed{false};
+		std::exception_ptr first_error;
+		std::mutex error_mutex;
+
+		auto work = [&](unsigned worker_index)
+		{
+			try{
+				for (auto ii = next_task++; ii < num_tasks && !failed; ii = next_task++)
+					task(worker_index, ii);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(error_mutex);
+				if (!first_error)
+					first_error = std::current_exception();
+				failed = true;
+			}
+		};
+
+		const auto precision = DefaultPrecision();
+		const auto precision_options = mpfr_float::thread_default_variable_precision_options();
+
+		std::vector<std::thread> workers;
+		workers.reserve(num_workers-1);
+		for (unsigned ii=1; ii<num_workers; ++ii)
+			workers.emplace_back([&, ii]()
+			{
+				scoped_mpfr_precision_options_this_thread scoped_options(precision_options);
+				DefaultPrecision(precision);
+				work(ii);
+			});
+
+		work(0);
+
+		for (auto& w : workers)
+			w.join();
+
+		if (first_error)
+			std::rethrow_exception(first_error);
+	}
+
+	} // namespace parallel
+} // namespace bertini
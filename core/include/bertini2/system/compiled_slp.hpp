@@ -0,0 +1,185 @@
+//This file is part of Bertini 2.
+//
+//compiled_slp.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//compiled_slp.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with compiled_slp.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+/**
+\file compiled_slp.hpp
+
+\brief Ahead-of-time compilation of straight-line programs into C++, and loading the compiled evaluators back in.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+#include "bertini2/mpfr_complex.hpp"
+#include "bertini2/double_extensions.hpp"
+
+
+namespace bertini {
+
+	class StraightLineProgram;
+
+
+	/**
+	\brief A straight-line program which was compiled to C++ ahead of time, by the SLPCodeGenerator.
+
+	The evaluators do exactly what StraightLineProgram::Eval does to the program's memory -- read the inputs and numbers, and write the outputs -- but as straight C++, with nothing to interpret.  They depend only on the structure of the program, not on the values of its numbers, which are read from memory.  Hence one compiled evaluator serves every system of the same structure, such as a family of systems differing only in their coefficients.
+
+	Programs are matched to compiled evaluators by their StraightLineProgram::Fingerprint.
+	*/
+	struct CompiledSLP
+	{
+		using DoubleEvaluator = void (*)(dbl_complex*);
+		using MultiprecisionEvaluator = void (*)(mpfr_complex*);
+
+		std::uint64_t Fingerprint; ///< The fingerprint of the programs this evaluates.
+		char const* Name; ///< The name it was generated with.
+		DoubleEvaluator EvalDouble; ///< Evaluates in double precision, in the memory of a program.
+		MultiprecisionEvaluator EvalMultiprecision; ///< Evaluates in multiple precision, in the memory of a program.  The default precision must be the program's.
+
+		void Eval(dbl_complex* memory) const
+		{
+			EvalDouble(memory);
+		}
+
+		void Eval(mpfr_complex* memory) const
+		{
+			EvalMultiprecision(memory);
+		}
+	};
+
+
+
+	/**
+	\brief The compiled straight-line programs available to this process.
+
+	Generated code registers its evaluator when it is loaded, through a Registrar, so compiling a generated file into a program, or linking it in, makes its evaluator available.  Generated code compiled into a shared library can also be loaded at runtime, with Load.
+
+	Systems use registered evaluators with EvalMethod::CompiledStraightLineProgram.
+	*/
+	class CompiledSLPRegistry
+	{
+	public:
+
+		/**
+		\brief Make a compiled program available.  Replaces any previously registered one with the same fingerprint.
+		*/
+		static void Register(CompiledSLP const& compiled);
+
+		/**
+		\brief Find the compiled program with a fingerprint.
+
+		\return The compiled program, or nullptr if none is registered.  The pointer remains valid until the program is unregistered, which generated code never does.
+		*/
+		static CompiledSLP const* Find(std::uint64_t fingerprint);
+
+		/**
+		\brief Make a compiled program unavailable again.  Does nothing if none is registered with the fingerprint.
+
+		Programs already using it must not be evaluated after.  Meant for evaluators registered by hand for a while, through a ScopedRegistration.
+		*/
+		static void Unregister(std::uint64_t fingerprint);
+
+		/**
+		\brief Load a shared library of generated code, registering the evaluators in it.  The library stays loaded for the life of the process.
+
+		\throws std::runtime_error if the library can't be loaded.
+		*/
+		static void Load(std::string const& shared_library);
+
+		/**
+		\brief The number of registered compiled programs.
+		*/
+		static std::size_t NumRegistered();
+
+
+		/**
+		\brief Registers a compiled program on construction.  Generated code makes one of these at namespace scope.
+		*/
+		struct Registrar
+		{
+			explicit
+			Registrar(CompiledSLP const& compiled)
+			{
+				Register(compiled);
+			}
+		};
+
+
+		/**
+		\brief Registers a compiled program on construction, and unregisters it on destruction, so that it is available only within a scope.
+		*/
+		class ScopedRegistration
+		{
+		public:
+			explicit
+			ScopedRegistration(CompiledSLP const& compiled) : fingerprint_(compiled.Fingerprint)
+			{
+				Register(compiled);
+			}
+
+			~ScopedRegistration()
+			{
+				Unregister(fingerprint_);
+			}
+
+			ScopedRegistration(ScopedRegistration const&) = delete;
+			ScopedRegistration& operator=(ScopedRegistration const&) = delete;
+
+		private:
+			std::uint64_t fingerprint_;
+		};
+	};
+
+
+
+	/**
+	\brief Writes a straight-line program out as a C++ translation unit, to be compiled ahead of time.
+
+	The generated file has an evaluator for each of double and multiple precision, each one function with one statement per instruction of the packed program, fully unrolled.  In double precision the intermediate results are local variables, which the compiler is free to keep in registers; in multiple precision they stay in the program's memory, which is already allocated at the working precision.  The file registers its evaluators with the CompiledSLPRegistry when loaded.
+
+	Compile the generated file with optimization, and with `-fcx-limited-range` (or `-ffast-math`) if you can accept the usual complex multiplication without the checks for infinities, which otherwise make each double precision product a library call.
+
+	```
+	std::ofstream file("my_system.cpp");
+	SLPCodeGenerator().Generate(sys.GetStraightLineProgram(), "my_system", file);
+	```
+	*/
+	class SLPCodeGenerator
+	{
+	public:
+
+		/**
+		\brief Write the C++ for a program.
+
+		\param slp The program to generate code for.
+		\param name A name for the evaluators, which must be a valid C++ identifier, and unique among the generated files linked into one program.
+		\param out The stream to write the code to.
+		*/
+		void Generate(StraightLineProgram const& slp, std::string const& name, std::ostream & out) const;
+	};
+
+} // namespace bertini
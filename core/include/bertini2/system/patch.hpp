@@ -454,6 +454,38 @@ namespace bertini {
 		}
 
 
+		/**
+		\brief Get the number of variables in each variable group being patched, in the order of the patch equations.
+		*/
+		std::vector<unsigned> const& VariableGroupSizes() const
+		{
+			return variable_group_sizes_;
+		}
+
+
+		/**
+		\brief Get the coefficients of the patch for one variable group, in the current working precision, which are the entries of its row of the Jacobian.
+
+		\param group The index of the variable group.
+		*/
+		template<typename T>
+		Vec<T> const& Coefficients(unsigned group) const
+		{
+			return std::get<std::vector<Vec<T> > >(coefficients_working_)[group];
+		}
+
+
+		/**
+		\brief Get the coefficients of the patch for one variable group, in the highest precision available.
+
+		\param group The index of the variable group.
+		*/
+		Vec<mpfr_complex> const& HighestPrecisionCoefficients(unsigned group) const
+		{
+			return coefficients_highest_precision_[group];
+		}
+
+
 		friend std::ostream& operator<<(std::ostream & out, Patch const& p)
 		{
 			out << p.NumVariableGroups() << " variable groups being patched\n";
@@ -0,0 +1,620 @@
+//This file is part of Bertini 2.
+//
+//bertini2/system/polynomial_system.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/system/polynomial_system.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/system/polynomial_system.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+/**
+\file bertini2/system/polynomial_system.hpp
+
+\brief Provides the bertini::PolynomialSystem class, the functions of a polynomial system expanded into flat arrays of monomials.
+*/
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "bertini2/mpfr_complex.hpp"
+#include "bertini2/mpfr_extensions.hpp"
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/function_tree/forward_declares.hpp"
+#include "bertini2/function_tree/eval_context.hpp"
+#include "bertini2/detail/visitor.hpp"
+
+namespace bertini {
+
+	class System; // a forward declaration, solving the circular inclusion problem
+	class PolynomialExpander;
+
+
+	/**
+	\brief The functions of a polynomial system, expanded into sums of monomials, and stored flat.
+
+	Each monomial is a coefficient, and the variables appearing in it with their exponents.  The monomials of all the functions are stored one after another, and their variables and exponents likewise, so evaluating is a few loops over arrays, with none of the virtual calls and freshness checks of evaluating a function tree.  The path variable, if any, is treated as one more variable, after the others.
+
+	Evaluating first makes a table of the powers of each variable, up to the highest in which it appears, shared by all the monomials.  Then each monomial is its coefficient times one entry of the table per variable in it.  The derivatives come from the same exponents: the derivative of a monomial with respect to one of its variables is the product of the other entries, times the exponent and the next lower power, and for all its variables at once these are found from running products from the left and from the right.
+
+	The coefficients are kept as expressions of the numbers of the system, and rounded from copies of them, whose integers, rationals and floats give their values afresh at each precision, as exactly as they are known.  Only the functions are expanded; patches are left to the System.
+
+	\see EvalMethod::Polynomial
+	*/
+	class PolynomialSystem
+	{
+		friend PolynomialExpander;
+
+	public:
+
+		PolynomialSystem() = default;
+
+		/**
+		\brief Expand the functions of a system into monomials.
+
+		\throws std::runtime_error if the system is not polynomial, in its variables and its path variable.
+		*/
+		explicit
+		PolynomialSystem(System const& sys);
+
+
+		/**
+		\brief Evaluate the functions and their derivatives, at variable values.
+
+		\param variable_values The values of the variables.
+		*/
+		template<typename Derived>
+		void Eval(Eigen::MatrixBase<Derived> const& variable_values) const
+		{
+			using NumT = typename Derived::Scalar;
+			CopyVariableValues(variable_values);
+			EvalDerivatives<NumT>();
+		}
+
+		/**
+		\brief Evaluate the functions and their derivatives, at variable and path variable values.
+
+		\param variable_values The values of the variables.
+		\param time The value of the path variable.
+		*/
+		template<typename Derived, typename ComplexT>
+		void Eval(Eigen::MatrixBase<Derived> const& variable_values, ComplexT const& time) const
+		{
+			using NumT = typename Derived::Scalar;
+			static_assert(std::is_same<NumT, ComplexT>::value, "scalar types must be the same");
+
+			CopyVariableValues(variable_values);
+			CopyPathVariable(time);
+			EvalDerivatives<NumT>();
+		}
+
+		/**
+		\brief Evaluate the functions and their derivatives, unless the most recent such evaluation in this number type was at exactly these variable values.
+		*/
+		template<typename Derived>
+		void EvalIfChanged(Eigen::MatrixBase<Derived> const& variable_values) const
+		{
+			using NumT = typename Derived::Scalar;
+			if (!Memory<NumT>().tangents_evaluated || !HasVariableValues(variable_values))
+				Eval(variable_values);
+		}
+
+		/**
+		\brief Evaluate the functions and their derivatives, unless the most recent such evaluation in this number type was at exactly these variable and path variable values.
+		*/
+		template<typename Derived, typename ComplexT>
+		void EvalIfChanged(Eigen::MatrixBase<Derived> const& variable_values, ComplexT const& time) const
+		{
+			using NumT = typename Derived::Scalar;
+			if (!Memory<NumT>().tangents_evaluated || !HasVariableValues(variable_values) || !HasPathVariable(time))
+				Eval(variable_values, time);
+		}
+
+		/**
+		\brief Evaluate the functions only, unless they were already evaluated at exactly these variable values.
+		*/
+		template<typename Derived>
+		void EvalFunctionsIfChanged(Eigen::MatrixBase<Derived> const& variable_values) const
+		{
+			using NumT = typename Derived::Scalar;
+			if (!Memory<NumT>().is_evaluated || !HasVariableValues(variable_values))
+			{
+				CopyVariableValues(variable_values);
+				EvalFunctions<NumT>();
+			}
+		}
+
+		/**
+		\brief Evaluate the functions only, unless they were already evaluated at exactly these variable and path variable values.
+		*/
+		template<typename Derived, typename ComplexT>
+		void EvalFunctionsIfChanged(Eigen::MatrixBase<Derived> const& variable_values, ComplexT const& time) const
+		{
+			using NumT = typename Derived::Scalar;
+			static_assert(std::is_same<NumT, ComplexT>::value, "scalar types must be the same");
+
+			if (!Memory<NumT>().is_evaluated || !HasVariableValues(variable_values) || !HasPathVariable(time))
+			{
+				CopyVariableValues(variable_values);
+				CopyPathVariable(time);
+				EvalFunctions<NumT>();
+			}
+		}
+
+
+		/**
+		\brief Evaluate the functions, at the values of the variables already in memory.
+
+		\tparam NumT numeric type
+		*/
+		template<typename NumT>
+		void EvalFunctions() const
+		{
+			auto& memory = Memory<NumT>();
+			auto m = memory.values.data();
+			auto const& c = Coefficients<NumT>();
+
+			FillPowerTables(m);
+
+			NumT& term = m[scratch_];
+			for (size_t ii = 0; ii < num_functions_; ++ii)
+			{
+				NumT& f = m[functions_ + ii];
+				f = 0;
+				for (auto mono = function_starts_[ii]; mono < function_starts_[ii+1]; ++mono)
+				{
+					term = c[mono];
+					for (auto k = monomial_starts_[mono]; k < monomial_starts_[mono+1]; ++k)
+						term *= PowerOf(m, factor_variables_[k], factor_exponents_[k]);
+					f += term;
+				}
+			}
+
+			memory.is_evaluated = true;
+			memory.tangents_evaluated = false;
+		}
+
+
+		/**
+		\brief Evaluate the functions, and their derivatives with respect to the variables and the path variable, at the values of the variables already in memory.
+
+		\tparam NumT numeric type
+
+		For each monomial, the running products from the left of its coefficient and powers are kept, and the running product from the right is made while going back through them, so that the derivatives with respect to all its variables take about three multiplications each.
+		*/
+		template<typename NumT>
+		void EvalDerivatives() const
+		{
+			auto& memory = Memory<NumT>();
+			auto m = memory.values.data();
+			auto d = memory.tangents.data();
+			auto const& c = Coefficients<NumT>();
+
+			FillPowerTables(m);
+
+			// only the entries of functions depending on a variable can be non-zero, and the rest stay zero from when the memory was made
+			for (auto loc : nonzero_derivatives_)
+				d[loc] = 0;
+
+			NumT* left = m + scratch_;
+			NumT& right = m[scratch_ + max_factors_ + 1];
+			NumT& term = m[scratch_ + max_factors_ + 2];
+
+			for (size_t ii = 0; ii < num_functions_; ++ii)
+			{
+				NumT& f = m[functions_ + ii];
+				NumT* df = d + ii*num_inputs_;
+				f = 0;
+				for (auto mono = function_starts_[ii]; mono < function_starts_[ii+1]; ++mono)
+				{
+					const auto begin = monomial_starts_[mono], end = monomial_starts_[mono+1];
+
+					left[0] = c[mono];
+					for (auto k = begin; k < end; ++k)
+						left[k-begin+1] = left[k-begin] * PowerOf(m, factor_variables_[k], factor_exponents_[k]);
+					f += left[end-begin];
+
+					right = 1;
+					for (auto k = end; k-- > begin; )
+					{
+						const auto v = factor_variables_[k];
+						const auto e = factor_exponents_[k];
+
+						term = left[k-begin] * right;
+						if (e > 1)
+						{
+							term *= m[integers_ + e - 1];
+							term *= PowerOf(m, v, e-1);
+						}
+						df[v] += term;
+
+						if (k > begin)
+							right *= PowerOf(m, v, e);
+					}
+				}
+			}
+
+			memory.is_evaluated = true;
+			memory.tangents_evaluated = true;
+		}
+
+
+		/**
+		\brief Copy the values of the functions into the first NumFunctions() entries of a vector.
+		*/
+		template<typename Derived>
+		void GetFuncValsInPlace(Eigen::MatrixBase<Derived> & result) const
+		{
+			using NumT = typename Derived::Scalar;
+			auto const& m = Memory<NumT>().values;
+			for (size_t ii = 0; ii < num_functions_; ++ii)
+				result(ii) = m[functions_ + ii];
+		}
+
+		/**
+		\brief Copy the derivatives of the functions with respect to the variables into the first NumFunctions() rows of a matrix.
+		*/
+		template<typename Derived>
+		void GetJacobianInPlace(Eigen::MatrixBase<Derived> & result) const
+		{
+			using NumT = typename Derived::Scalar;
+			auto const& d = Memory<NumT>().tangents;
+			for (size_t jj = 0; jj < num_variables_; ++jj)
+				for (size_t ii = 0; ii < num_functions_; ++ii)
+					result(ii,jj) = d[ii*num_inputs_ + jj];
+		}
+
+		/**
+		\brief Copy the derivatives of the functions with respect to the path variable into the first NumFunctions() entries of a vector.
+		*/
+		template<typename Derived>
+		void GetTimeDerivInPlace(Eigen::MatrixBase<Derived> & result) const
+		{
+			using NumT = typename Derived::Scalar;
+			if (!have_path_variable_)
+				throw std::runtime_error("getting time derivatives of polynomial system with no path variable");
+
+			auto const& d = Memory<NumT>().tangents;
+			for (size_t ii = 0; ii < num_functions_; ++ii)
+				result(ii) = d[ii*num_inputs_ + num_variables_];
+		}
+
+
+		/**
+		\brief Change the precision of the multiple precision evaluation.  The coefficients are rounded anew from their exact expressions, the first time each precision is used.
+		*/
+		void precision(unsigned new_precision) const;
+
+		unsigned precision() const
+		{
+			return precision_;
+		}
+
+
+		size_t NumFunctions() const
+		{
+			return num_functions_;
+		}
+
+		size_t NumVariables() const
+		{
+			return num_variables_;
+		}
+
+		bool HavePathVariable() const
+		{
+			return have_path_variable_;
+		}
+
+		/**
+		\brief The number of monomials of all the functions together.
+		*/
+		size_t NumMonomials() const
+		{
+			return monomial_starts_.empty() ? 0 : monomial_starts_.size()-1;
+		}
+
+		/**
+		\brief The number of monomials of one function.
+		*/
+		size_t NumMonomials(size_t function) const
+		{
+			return function_starts_[function+1] - function_starts_[function];
+		}
+
+		/**
+		\brief The exponents of the variables, and then of the path variable if any, in a monomial.
+		*/
+		std::vector<int> Exponents(size_t monomial) const
+		{
+			std::vector<int> exponents(num_inputs_, 0);
+			for (auto k = monomial_starts_[monomial]; k < monomial_starts_[monomial+1]; ++k)
+				exponents[factor_variables_[k]] = factor_exponents_[k];
+			return exponents;
+		}
+
+		/**
+		\brief The index of the first monomial of a function.  Those of the function follow it.
+		*/
+		size_t FirstMonomial(size_t function) const
+		{
+			return function_starts_[function];
+		}
+
+	private:
+
+		/**
+		\brief Get the memory in which to evaluate, the system's own unless an EvalContext is active on this thread.
+
+		The values are the variables and path variable, the integers up to the highest exponent, the tables of powers, the functions, and scratch space, in that order.  The tangents are the derivatives of the functions, function by function, with respect to the variables and then the path variable.
+		*/
+		template<typename NumT>
+		ProgramMemory<NumT>& Memory() const
+		{
+			auto& own = std::get<ProgramMemory<NumT>>(memory_);
+			if (auto ctx = EvalContext::Active())
+			{
+				auto& mem = ctx->Memory<NumT>();
+				if (mem.owner != this || mem.values.size() != own.values.size())
+				{
+					mem.values = own.values;
+					mem.tangents = own.tangents;
+					mem.is_evaluated = false;
+					mem.tangents_evaluated = false;
+					mem.owner = this;
+				}
+				return mem;
+			}
+			return own;
+		}
+
+		template<typename NumT>
+		std::vector<NumT> const& Coefficients() const
+		{
+			return *std::get<std::shared_ptr<const std::vector<NumT>>>(coefficients_);
+		}
+
+		/**
+		\brief Round the coefficients to a number type, at the current precision, from copies of their expressions, so the numbers of the system are left as they are.
+		*/
+		template<typename NumT>
+		std::shared_ptr<const std::vector<NumT>> RoundCoefficients() const;
+
+		/**
+		\brief Make the memory, with the integers in it, once the layout is known.
+		*/
+		template<typename NumT>
+		void MakeMemory();
+
+		/**
+		\brief A positive power of an input, from the tables.
+		*/
+		template<typename NumT>
+		NumT const& PowerOf(NumT const* m, int variable, int exponent) const
+		{
+			return m[power_starts_[variable] + exponent - 1];
+		}
+
+		template<typename NumT>
+		void FillPowerTables(NumT* m) const
+		{
+			for (size_t v = 0; v < num_inputs_; ++v)
+			{
+				const auto p = power_starts_[v];
+				const auto max = max_exponents_[v];
+				if (max >= 1)
+					m[p] = m[v];
+				for (int e = 2; e <= max; ++e)
+					m[p+e-1] = m[p+e-2] * m[v];
+			}
+		}
+
+		template<typename Derived>
+		void CopyVariableValues(Eigen::MatrixBase<Derived> const& variable_values) const
+		{
+			using NumT = typename Derived::Scalar;
+			if (static_cast<size_t>(variable_values.size()) != num_variables_)
+				throw std::runtime_error("number of variable values passed to polynomial system doesn't match its number of variables");
+
+			auto& m = Memory<NumT>().values;
+			for (size_t ii = 0; ii < num_variables_; ++ii)
+				m[ii] = variable_values(ii);
+		}
+
+		template<typename ComplexT>
+		void CopyPathVariable(ComplexT const& time) const
+		{
+			if (!have_path_variable_)
+				throw std::runtime_error("calling Eval with path variable, but this polynomial system doesn't have one");
+			Memory<ComplexT>().values[num_variables_] = time;
+		}
+
+		template<typename Derived>
+		bool HasVariableValues(Eigen::MatrixBase<Derived> const& variable_values) const
+		{
+			using NumT = typename Derived::Scalar;
+			if (static_cast<size_t>(variable_values.size()) != num_variables_)
+				return false;
+
+			auto const& m = Memory<NumT>().values;
+			for (size_t ii = 0; ii < num_variables_; ++ii)
+				if (m[ii] != variable_values(ii))
+					return false;
+			return true;
+		}
+
+		template<typename ComplexT>
+		bool HasPathVariable(ComplexT const& time) const
+		{
+			return have_path_variable_ && Memory<ComplexT>().values[num_variables_] == time;
+		}
+
+
+		size_t num_functions_ = 0;
+		size_t num_variables_ = 0;
+		bool have_path_variable_ = false;
+		size_t num_inputs_ = 0; ///< The variables, and the path variable if any.
+
+		std::vector<size_t> function_starts_{0}; ///< Where the monomials of each function start, and, last, the number of monomials.
+		std::vector<size_t> monomial_starts_{0}; ///< Where the factors of each monomial start, and, last, the number of factors.
+		std::vector<int> factor_variables_; ///< The input of each factor of each monomial, in increasing order within a monomial.
+		std::vector<int> factor_exponents_; ///< The exponent of each factor of each monomial, always positive.
+		std::vector<size_t> nonzero_derivatives_; ///< The derivatives which can be non-zero, as locations in the tangents.
+
+		std::vector<int> max_exponents_; ///< The highest power of each input appearing in any monomial.
+		std::vector<size_t> power_starts_; ///< Where in memory the table of powers of each input starts, with the first power.
+		int max_exponent_ = 0;
+		size_t max_factors_ = 0; ///< The most factors in any one monomial.
+
+		size_t integers_ = 0; ///< Where in memory the integers 1, 2, ... max_exponent_ are, for differentiating powers.
+		size_t functions_ = 0; ///< Where in memory the values of the functions are.
+		size_t scratch_ = 0; ///< Where in memory the running products are made.
+		size_t memory_size_ = 0;
+
+		std::vector<std::shared_ptr<node::Node>> coefficient_nodes_; ///< The exact coefficient of each monomial, as an expression of the numbers of the system.
+		mutable std::tuple<std::shared_ptr<const std::vector<dbl>>, std::shared_ptr<const std::vector<mpfr_complex>>> coefficients_; ///< The coefficients rounded to double, and to the current precision.
+		mutable std::map<unsigned, std::shared_ptr<const std::vector<mpfr_complex>>> coefficients_at_precision_; ///< The coefficients rounded to each precision used so far.
+
+		mutable unsigned precision_ = DefaultPrecision();
+		mutable std::tuple<ProgramMemory<dbl>, ProgramMemory<mpfr_complex>> memory_;
+	};
+
+
+
+	/**
+	\brief Expands the functions of a polynomial system into monomials, making a PolynomialSystem.
+
+	Each node is expanded once, into a map from the exponents of the monomials to their coefficients, and nodes shared by several functions share their expansions.  Sums, differences and products of expansions are expanded as such, and integer powers by repeated squaring.  Any node without variables in it, such as `sqrt(2)`, is a coefficient, whatever its type.
+	*/
+	class PolynomialExpander : public VisitorBase,
+			// symbols and roots
+			public Visitor<node::Variable>,
+			public Visitor<node::Integer>,
+			public Visitor<node::Float>,
+			public Visitor<node::Rational>,
+			public Visitor<node::special_number::Pi>,
+			public Visitor<node::special_number::E>,
+			public Visitor<node::Function>,
+
+			// arithmetic
+			public Visitor<node::SumOperator>,
+			public Visitor<node::NegateOperator>,
+			public Visitor<node::MultOperator>,
+			public Visitor<node::IntegerPowerOperator>,
+			public Visitor<node::PowerOperator>,
+			public Visitor<node::SqrtOperator>,
+			public Visitor<node::ExpOperator>,
+			public Visitor<node::LogOperator>,
+
+			// the trig operators, which are polynomial only when constant
+			public Visitor<node::SinOperator>,
+			public Visitor<node::ArcSinOperator>,
+			public Visitor<node::CosOperator>,
+			public Visitor<node::ArcCosOperator>,
+			public Visitor<node::TanOperator>,
+			public Visitor<node::ArcTanOperator>
+	{
+	public:
+
+		/**
+		\brief The expansion of a polynomial: the coefficient of each of its monomials, by the exponents of the variables, and then of the path variable, in the monomial.  The zero polynomial has no monomials.
+		*/
+		using Monomials = std::map<std::vector<int>, std::shared_ptr<node::Node>>;
+
+		/**
+		\throws std::runtime_error if the system is not polynomial.
+		*/
+		PolynomialSystem Expand(System const& sys);
+
+		// symbols and roots
+		virtual void Visit(node::Variable const& n);
+		virtual void Visit(node::Integer const& n);
+		virtual void Visit(node::Float const& n);
+		virtual void Visit(node::Rational const& n);
+		virtual void Visit(node::special_number::Pi const& n);
+		virtual void Visit(node::special_number::E const& n);
+		virtual void Visit(node::Function const& n);
+
+		// arithmetic
+		virtual void Visit(node::SumOperator const& n);
+		virtual void Visit(node::NegateOperator const& n);
+		virtual void Visit(node::MultOperator const& n);
+		virtual void Visit(node::IntegerPowerOperator const& n);
+		virtual void Visit(node::PowerOperator const& n);
+		virtual void Visit(node::SqrtOperator const& n);
+		virtual void Visit(node::ExpOperator const& n);
+		virtual void Visit(node::LogOperator const& n);
+
+		// the trig operators
+		virtual void Visit(node::SinOperator const& n);
+		virtual void Visit(node::ArcSinOperator const& n);
+		virtual void Visit(node::CosOperator const& n);
+		virtual void Visit(node::ArcCosOperator const& n);
+		virtual void Visit(node::TanOperator const& n);
+		virtual void Visit(node::ArcTanOperator const& n);
+
+	private:
+
+		/**
+		\brief Get the expansion of a node, expanding it first if it hasn't been encountered yet.
+
+		\throws std::runtime_error if the node is of a type the expander doesn't know, or is not polynomial.
+		*/
+		Monomials const& ExpansionOf(std::shared_ptr<node::Node> const& n);
+
+		/**
+		\brief The node itself is a coefficient.
+		*/
+		template<typename NodeT>
+		void DealWithNumber(NodeT const& n)
+		{
+			expansions_[n.shared_from_this()] = Constant(std::const_pointer_cast<NodeT>(n.shared_from_this()));
+		}
+
+		/**
+		\brief Unary operators other than negation are polynomial only when their operand is constant, and then the node itself is a coefficient.
+		*/
+		template<typename NodeT>
+		void DealWithConstantOnly(NodeT const& n)
+		{
+			if (!IsConstant(ExpansionOf(n.Operand())))
+				NotPolynomial(n);
+			DealWithNumber(n);
+		}
+
+		[[noreturn]] void NotPolynomial(node::Node const& n) const;
+
+		Monomials Constant(std::shared_ptr<node::Node> const& c) const;
+		bool IsConstant(Monomials const& p) const;
+
+		void AddTo(Monomials & p, Monomials const& q, bool add) const;
+		Monomials Multiply(Monomials const& p, Monomials const& q) const;
+		Monomials Power(Monomials const& p, int exponent) const;
+
+		std::shared_ptr<node::Node> Product(std::shared_ptr<node::Node> const& a, std::shared_ptr<node::Node> const& b) const;
+
+		size_t num_inputs_ = 0;
+		std::shared_ptr<node::Node> one_; ///< The coefficient of monomials made from variables, skipped when multiplying coefficients.
+		std::map<std::shared_ptr<const node::Node>, Monomials> expansions_; ///< The expansion of each node encountered.
+	};
+
+} // namespace bertini
@@ -0,0 +1,264 @@
+//This file is part of Bertini 2.
+//
+//slp_batch.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//slp_batch.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with slp_batch.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+/**
+\file slp_batch.hpp
+
+\brief Provides bertini::SLPBatch, for evaluating a straight-line program at many points at once, in double precision.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/system/straight_line_program.hpp"
+
+
+// tells the compiler the lanes of a loop are independent, so it vectorizes without checking whether the arrays overlap.  put it before a loop over lanes in which each lane reads its operands before writing its result, so an output which is also an input is fine.
+#if defined(__clang__)
+	#define BERTINI_INDEPENDENT_LANES _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+	#define BERTINI_INDEPENDENT_LANES _Pragma("GCC ivdep")
+#else
+	#define BERTINI_INDEPENDENT_LANES
+#endif
+
+
+namespace bertini {
+
+	/**
+	\brief Memory for evaluating a straight-line program at a batch of points at once, in double precision.
+
+	The memory is laid out as structure of arrays: for every location of the program's memory, the real parts of its values at all the points, one after the other, and likewise the imaginary parts.  Eval runs each instruction of the program across all the points -- the lanes -- before moving on to the next, so that the arithmetic on each location is a loop over contiguous doubles, with no dependence between lanes.  The compiler turns these loops into vector instructions, AVX2 or AVX-512 if you compile for a processor with them (e.g. `-march=native`).  Addition, subtraction, multiplication, division, and the fused operations of the packed program are done this way.  The other functions are done lane by lane, with std::complex.
+
+	Division is the textbook formula, without the rescaling std::complex does to avoid overflow, so it overflows for numbers of magnitude beyond about 1e154.
+
+	The number of lanes is rounded up to a multiple of the widest vector width, 8 doubles.  The extra lanes are computed but ignored.
+
+	```
+	SLPBatch batch(slp, num_points);
+	for (unsigned k=0; k<num_points; ++k)
+		batch.SetPoint(k, points[k], t);
+	batch.Eval();
+	auto f = batch.GetFuncVals(3); // the function values at the fourth point
+	```
+
+	A batch is tied to the program it was made for, which must outlive it, and not change while it exists.  Batches are independent of each other, and of the program's own memory, so several threads may each evaluate their own batch of the same program.
+	*/
+	class SLPBatch
+	{
+	public:
+
+		/**
+		\brief The lanes are padded to a multiple of this, the number of doubles in an AVX-512 vector.
+		*/
+		static constexpr unsigned LaneMultiple = 8;
+
+		/**
+		\brief Make memory for evaluating a program at a number of points.
+
+		The numbers of the program are copied into every lane.  The variables are all zero until set.
+		*/
+		SLPBatch(StraightLineProgram const& slp, unsigned num_points);
+
+
+		/**
+		\brief The number of points in the batch.
+		*/
+		unsigned NumPoints() const
+		{
+			return num_points_;
+		}
+
+
+		/**
+		\brief Set the values of the variables at one point of the batch.
+
+		\throws std::runtime_error if the number of values is not the number of variables of the program.
+		*/
+		void SetPoint(unsigned k, Vec<dbl> const& variable_values);
+
+		/**
+		\brief Set the values of the variables, and of the path variable, at one point of the batch.
+
+		\throws std::runtime_error if the program has no path variable.
+		*/
+		void SetPoint(unsigned k, Vec<dbl> const& variable_values, dbl const& time);
+
+		/**
+		\brief Set the values of the variables at all the points, one point per column.
+		*/
+		void SetPoints(Mat<dbl> const& variable_values);
+
+		/**
+		\brief Set the values of the variables at all the points, one point per column, all at the same time.
+		*/
+		void SetPoints(Mat<dbl> const& variable_values, dbl const& time);
+
+
+		/**
+		\brief Evaluate the program at all points of the batch.
+		*/
+		void Eval();
+
+
+		/**
+		\brief The number of lanes, which is the number of points rounded up to a multiple of LaneMultiple.
+		*/
+		unsigned NumLanes() const
+		{
+			return stride_;
+		}
+
+		/**
+		\brief The real parts of the values at a location of memory, one per lane.  For computing with the results without copying them out point by point.
+		*/
+		double const* RealLanes(size_t loc) const
+		{
+			return real_.data() + loc*stride_;
+		}
+
+		/**
+		\brief The imaginary parts of the values at a location of memory, one per lane.
+		*/
+		double const* ImagLanes(size_t loc) const
+		{
+			return imag_.data() + loc*stride_;
+		}
+
+		/**
+		\brief The location in memory of the value of a function.  Patches follow the functions.
+		*/
+		size_t FunctionLocation(unsigned ii) const
+		{
+			return slp_.output_locations_.Functions + ii;
+		}
+
+		/**
+		\brief The location in memory of an entry of the Jacobian.
+		*/
+		size_t JacobianLocation(unsigned ii, unsigned jj) const
+		{
+			return slp_.output_locations_.Jacobian + ii + jj*slp_.NumTotalFunctions();
+		}
+
+		/**
+		\brief The location in memory of the time derivative of a function.
+		*/
+		size_t TimeDerivLocation(unsigned ii) const
+		{
+			return slp_.output_locations_.TimeDeriv + ii;
+		}
+
+
+		/**
+		\brief Copy the values of the functions at one point into an existing vector, of length at least NumTotalFunctions.  Patches follow the functions.
+		*/
+		template<typename Derived>
+		void GetFuncValsInPlace(unsigned k, Eigen::MatrixBase<Derived> & result) const
+		{
+			for (unsigned ii = 0; ii < slp_.NumTotalFunctions(); ++ii)
+				result(ii) = Value(slp_.output_locations_.Functions + ii, k);
+		}
+
+		/**
+		\brief Copy the Jacobian at one point into an existing matrix, of size NumTotalFunctions by NumVariables.
+		*/
+		template<typename Derived>
+		void GetJacobianInPlace(unsigned k, Eigen::MatrixBase<Derived> & result) const
+		{
+			const auto num_rows = slp_.NumTotalFunctions();
+			for (unsigned jj = 0; jj < slp_.NumVariables(); ++jj)
+				for (unsigned ii = 0; ii < num_rows; ++ii)
+					result(ii,jj) = Value(slp_.output_locations_.Jacobian + ii + jj*num_rows, k);
+		}
+
+		/**
+		\brief Copy the time derivatives at one point into an existing vector, of length at least NumTotalFunctions.
+
+		\throws std::runtime_error if the program has no path variable.
+		*/
+		template<typename Derived>
+		void GetTimeDerivInPlace(unsigned k, Eigen::MatrixBase<Derived> & result) const
+		{
+			if (!slp_.HavePathVariable())
+				throw std::runtime_error("getting time derivatives from a straight-line program without a path variable");
+
+			for (unsigned ii = 0; ii < slp_.NumTotalFunctions(); ++ii)
+				result(ii) = Value(slp_.output_locations_.TimeDeriv + ii, k);
+		}
+
+		/**
+		\brief The values of the functions at one point.
+		*/
+		Vec<dbl> GetFuncVals(unsigned k) const;
+
+		/**
+		\brief The Jacobian at one point.
+		*/
+		Mat<dbl> GetJacobian(unsigned k) const;
+
+		/**
+		\brief The time derivatives at one point.
+		*/
+		Vec<dbl> GetTimeDeriv(unsigned k) const;
+
+		/**
+		\brief The values of the functions at all the points, one vector per point.
+		*/
+		std::vector<Vec<dbl>> GetFuncVals() const;
+
+		/**
+		\brief The Jacobians at all the points, one matrix per point.
+		*/
+		std::vector<Mat<dbl>> GetJacobians() const;
+
+
+	private:
+
+		/**
+		\brief The value at a location of memory, in a lane.
+		*/
+		dbl Value(size_t loc, unsigned k) const
+		{
+			return dbl(real_[loc*stride_ + k], imag_[loc*stride_ + k]);
+		}
+
+		void SetValue(size_t loc, unsigned k, dbl const& x)
+		{
+			real_[loc*stride_ + k] = x.real();
+			imag_[loc*stride_ + k] = x.imag();
+		}
+
+
+		StraightLineProgram const& slp_; ///< The program evaluated.
+		unsigned num_points_; ///< The number of points in the batch.
+		unsigned stride_; ///< The number of lanes, which is num_points_ rounded up to a multiple of LaneMultiple.
+
+		std::vector<double, Eigen::aligned_allocator<double>> real_; ///< The real parts of memory, lane fastest.
+		std::vector<double, Eigen::aligned_allocator<double>> imag_; ///< The imaginary parts of memory, lane fastest.
+	};
+
+} // namespace bertini
@@ -0,0 +1,267 @@
+//This file is part of Bertini 2.
+//
+//bertini2/system/sparse_jacobian.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/system/sparse_jacobian.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/system/sparse_jacobian.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+/**
+\file bertini2/system/sparse_jacobian.hpp
+
+\brief Provides the sparsity pattern of the Jacobian of a system, and LU factorizations of Jacobians stored sparsely.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+
+#include "bertini2/mpfr_complex.hpp"
+#include "bertini2/mpfr_extensions.hpp"
+#include "bertini2/eigen_extensions.hpp"
+
+namespace bertini {
+
+	/**
+	\brief Which entries of a Jacobian matrix can be non-zero.
+
+	Stored by column, as Eigen's compressed sparse matrices are, so the values of a matrix made by MakeMatrix are in the same order as the entries here: column by column, and by row within each column.
+	*/
+	class JacobianPattern
+	{
+	public:
+
+		JacobianPattern() = default;
+
+		/**
+		\param num_rows The number of rows of the Jacobian.
+		\param rows_of_columns For each column, the rows of its entries which can be non-zero, in increasing order.
+		*/
+		JacobianPattern(int num_rows, std::vector<std::vector<int>> const& rows_of_columns) :
+			num_rows_(num_rows), column_starts_(1, 0)
+		{
+			for (auto const& rows : rows_of_columns)
+			{
+				row_indices_.insert(row_indices_.end(), rows.begin(), rows.end());
+				column_starts_.push_back(static_cast<int>(row_indices_.size()));
+			}
+		}
+
+		int Rows() const
+		{
+			return num_rows_;
+		}
+
+		int Cols() const
+		{
+			return static_cast<int>(column_starts_.size()) - 1;
+		}
+
+		/**
+		\brief The number of entries which can be non-zero.
+		*/
+		std::size_t NumNonzeros() const
+		{
+			return row_indices_.size();
+		}
+
+		/**
+		\brief The fraction of the entries which can be non-zero.
+		*/
+		double Density() const
+		{
+			if (Rows()==0 || Cols()==0)
+				return 0;
+			return static_cast<double>(NumNonzeros()) / (static_cast<double>(Rows()) * Cols());
+		}
+
+		/**
+		\brief Whether an entry can be non-zero.
+		*/
+		bool Contains(int row, int col) const
+		{
+			auto begin = row_indices_.begin() + column_starts_[col], end = row_indices_.begin() + column_starts_[col+1];
+			return std::binary_search(begin, end, row);
+		}
+
+		/**
+		\brief Where each column's entries start, and, last, the number of entries.
+		*/
+		std::vector<int> const& ColumnStarts() const
+		{
+			return column_starts_;
+		}
+
+		/**
+		\brief The row of each entry, column by column.
+		*/
+		std::vector<int> const& RowIndices() const
+		{
+			return row_indices_;
+		}
+
+		/**
+		\brief Make a compressed sparse matrix with this pattern, and all its entries zero.
+
+		The zeros are stored, so filling the values in place never changes the pattern.
+		*/
+		template<typename T>
+		Eigen::SparseMatrix<T> MakeMatrix() const
+		{
+			Eigen::SparseMatrix<T> J(Rows(), Cols());
+			std::vector<int> nonzeros_per_column(Cols());
+			for (int jj = 0; jj < Cols(); ++jj)
+				nonzeros_per_column[jj] = column_starts_[jj+1] - column_starts_[jj];
+			J.reserve(nonzeros_per_column);
+
+			for (int jj = 0; jj < Cols(); ++jj)
+				for (int kk = column_starts_[jj]; kk < column_starts_[jj+1]; ++kk)
+					J.insert(row_indices_[kk], jj) = T(0);
+
+			J.makeCompressed();
+			return J;
+		}
+
+	private:
+		int num_rows_ = 0;
+		std::vector<int> column_starts_{0};
+		std::vector<int> row_indices_;
+	};
+
+
+
+	/**
+	\brief An LU factorization of Jacobians stored sparsely, all having the same pattern.
+
+	The ordering of the columns, and the structure of the factors, are worked out once by Analyze, from the pattern.  Each Factorize then only does the arithmetic, for whatever values were put into Matrix().
+
+	Copies are of the matrix only, and must Analyze again before factoring.
+
+	\tparam T The number type, dbl or mpfr_complex.
+	*/
+	template<typename T>
+	class SparseJacobianLU
+	{
+	public:
+		using MatrixType = Eigen::SparseMatrix<T>;
+		using LUType = Eigen::SparseLU<MatrixType, Eigen::COLAMDOrdering<int>>;
+
+		SparseJacobianLU() : lu_(std::make_unique<LUType>())
+		{}
+
+		SparseJacobianLU(SparseJacobianLU const& other) : J_(other.J_), lu_(std::make_unique<LUType>())
+		{}
+
+		SparseJacobianLU& operator=(SparseJacobianLU const& other)
+		{
+			J_ = other.J_;
+			lu_ = std::make_unique<LUType>();
+			analyzed_ = false;
+			factored_ = false;
+			return *this;
+		}
+
+		/**
+		\brief Work out the ordering and structure of the factorization, for Jacobians with a pattern.  Zeroes the matrix.
+		*/
+		void Analyze(JacobianPattern const& pattern)
+		{
+			J_ = pattern.MakeMatrix<T>();
+			lu_->analyzePattern(J_);
+			analyzed_ = true;
+			factored_ = false;
+		}
+
+		/**
+		\brief Forget the pattern, as when the system changes, so that Analyze must be called again.
+		*/
+		void Forget()
+		{
+			analyzed_ = false;
+			factored_ = false;
+		}
+
+		bool IsAnalyzed() const
+		{
+			return analyzed_;
+		}
+
+		/**
+		\brief The matrix to factor, with the pattern it was analyzed with.  Fill its values in place, as with System::SparseJacobianInPlace.
+		*/
+		MatrixType & Matrix()
+		{
+			return J_;
+		}
+
+		MatrixType const& Matrix() const
+		{
+			return J_;
+		}
+
+		/**
+		\brief Factor the matrix, reusing the analysis.
+
+		\return Whether the factorization succeeded.  It fails for matrices which are singular to working precision.
+		*/
+		bool Factorize()
+		{
+			lu_->factorize(J_);
+			factored_ = lu_->info()==Eigen::Success;
+			return factored_;
+		}
+
+		bool IsFactored() const
+		{
+			return factored_;
+		}
+
+		/**
+		\brief Solve the factored matrix against a vector.
+		*/
+		template<typename Derived>
+		Vec<T> Solve(Eigen::MatrixBase<Derived> const& b) const
+		{
+			return lu_->solve(b);
+		}
+
+		/**
+		\brief Change the precision of the values of the matrix.  Factorizations made after are in the new precision.
+		*/
+		void Precision(unsigned prec)
+		{
+			using bertini::Precision;
+			for (int kk = 0; kk < J_.nonZeros(); ++kk)
+				Precision(J_.valuePtr()[kk], prec);
+			factored_ = false;
+		}
+
+	private:
+		MatrixType J_;
+		std::unique_ptr<LUType> lu_;
+		bool analyzed_ = false;
+		bool factored_ = false;
+	};
+
+} // namespace bertini
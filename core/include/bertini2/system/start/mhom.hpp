@@ -31,6 +31,11 @@
 
 #pragma once
 
+#include <map>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
 #include "bertini2/system/start_base.hpp"
 #include "bertini2/system/start/utility.hpp"
 
@@ -43,7 +48,9 @@ namespace bertini
 		/**
 		\brief The $m$-homogeneous start system for Numerical Algebraic Geometry
 
-		
+		The valid partitions of the degree matrix are never enumerated.  Instead, the number of ways to complete a partial partition is counted as needed, and remembered, so that any start point index maps straight to its partition and its choice of linear factors, in the same order as enumerating the partitions from left to right would give.
+
+		Each start point is found by solving a linear system which is block diagonal, one block for each variable group, and the solution of each block is remembered, because start points which choose the same linear factors for the functions assigned to a group share it.  Because of these caches, start points of one MHomogeneous must not be made from more than one thread at a time.
 		*/
 		class MHomogeneous : public StartSystem
 		{
@@ -66,21 +73,25 @@ namespace bertini
 			void CreateDegreeMatrix(System const& s);
 
 			/**
-			\brief Creates all valid partitions for multi-homogeneous start system to create start points.
+			Get the number of start points for this m-homogeneous start system.  This is the Bezout bound for the target system.  Provided here for your convenience.
 			*/
-			void GenerateValidPartitions(System const& s);
+			unsigned long long NumStartPoints() const override;
+
+			unsigned long long NumStartPointsForPartition(Vec<int> partition) const;
 
 			/**
-			\brief Helper function that is used to find valid partitions in the degree matrix.
+			\brief The number of valid partitions of the degree matrix.
 			*/
-			int ChooseColumnInRow(System const& s,Vec<int>& variable_group_counter, int row, int column);
+			unsigned long long NumPartitions() const;
 
 			/**
-			Get the number of start points for this m-homogeneous start system.  This is the Bezout bound for the target system.  Provided here for your convenience.
-			*/
-			unsigned long long NumStartPoints() const override;
+			\brief Get a valid partition of the degree matrix, by its index in left-to-right order.
 
-			unsigned long long NumStartPointsForPartition(Vec<int> partition) const;
+			A partition assigns to each function the variable group whose linear factors it contributes.
+
+			\throws std::out_of_range if the index is not less than NumPartitions().
+			*/
+			Vec<int> Partition(unsigned long long index) const;
 
 			MHomogeneous& operator*=(Nd const& n);
 
@@ -90,11 +101,6 @@ namespace bertini
 			 \brief Degree matrix holding degrees for all functions in terms of all variable groups
 			 */
 			Mat<int> degree_matrix_; // stores degrees of all functions in all homogeneous variable groups.
-			
-			/**
-			 \brief Partitions used for creating start points in the multi-homogeneous start system.
-			 */
-			std::deque< Vec<int> > valid_partitions_;
 
 
 		private:
@@ -118,10 +124,36 @@ namespace bertini
 			*/
 			template<typename T>
 			void GenerateStartPointT(Vec<T>& start_point, unsigned long long index) const;
-			
-			
 
-			
+			/**
+			\brief The number of times each variable group is to be chosen in a partition, which is its size.
+			*/
+			std::vector<int> GroupSizes() const;
+
+			/**
+			\brief The number of ways to complete a partial partition, and the number of start points they have.
+
+			\param remaining The number of times each variable group may still be chosen.  Restored before returning.
+			\param row The first function not yet assigned a variable group.
+			\return The number of completions of the partition, and the sum over them of the products of the degrees chosen for the rest of the functions.
+			*/
+			std::pair<unsigned long long, unsigned long long> CompletionCounts(std::vector<int> & remaining, int row) const;
+
+			/**
+			\brief Find the partition of a start point, and which linear factor it chooses for each function.
+
+			\throws std::out_of_range if the index is not less than NumStartPoints().
+			*/
+			void LocateStartPoint(unsigned long long index, Vec<int> & partition, std::vector<size_t> & subscript) const;
+
+			/**
+			\brief The values of the variables in a group, for a partition and choice of linear factors.
+
+			Solved for once, and remembered for the other start points sharing it.
+			*/
+			template<typename T>
+			Vec<T> const& BlockSolution(int group, Vec<int> const& partition, std::vector<size_t> const& subscript) const;
+
 			std::vector<unsigned long long> degrees_; ///< stores the degrees of the functions.
 			std::vector< VariableGroup > var_groups_;
 			Mat<std::shared_ptr<node::LinearProduct>> linprod_matrix_; ///< All the linear products for each entry in the degree matrix.
@@ -129,6 +161,15 @@ namespace bertini
 
 			mutable Vec<mpfr_complex> temp_v_mp_;
 
+			/// The counts of completions of partial partitions, keyed by the number of times each variable group may still be chosen, which determines how many functions are assigned already.
+			mutable std::map<std::vector<int>, std::pair<unsigned long long, unsigned long long>> completion_counts_;
+
+			/// The solutions of the blocks of the linear systems for start points, keyed by the variable group, and then each function assigned to it followed by its choice of linear factor.
+			mutable std::tuple< std::map<std::vector<size_t>, Vec<dbl>>, std::map<std::vector<size_t>, Vec<mpfr_complex>> > block_solutions_;
+			mutable unsigned block_solutions_precision_ = 0; ///< The precision of the multiple precision block solutions.
+
+			static constexpr std::size_t MaxCachedBlocks = 1<<16; ///< The most block solutions remembered, in each precision, before forgetting them all.
+
 			friend class boost::serialization::access;
 
 			template <typename Archive>
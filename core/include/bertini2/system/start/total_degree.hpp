@@ -47,7 +47,7 @@ namespace bertini
 
 		Note that the corresponding target system MUST be square -- have the same number of functions and variables.  The start system cannot be constructed otherwise, particularly because it is written to throw at the moment if not square.
 
-		The start points are accesses by index (unsigned long long), instead of being generated all at once.
+		The start points are accesses by index (unsigned long long), instead of being generated all at once.  Contiguous ranges of them can also be had with StartPoints(first, count), which computes the roots of each start function once, rather than for every point.
 		*/
 		class TotalDegree : public StartSystem
 		{
@@ -127,6 +127,36 @@ namespace bertini
 			*/
 			Vec<mpfr_complex> GenerateStartPoint(mpfr_complex,unsigned long long index) const override;
 
+			/**
+			Fill a block with its start points, in double precision.
+
+			Called by the base StartSystem's StartPoints(first, count) method.
+			*/
+			void GenerateStartPoints(StartPointBlock<dbl> & block) const override;
+
+			/**
+			Fill a block with its start points, in current default precision.
+
+			Called by the base StartSystem's StartPoints(first, count) method.
+			*/
+			void GenerateStartPoints(StartPointBlock<mpfr_complex> & block) const override;
+
+			/**
+			A local version of GenerateStartPoints that can be templated
+			*/
+			template<typename T>
+			void GenerateStartPointsT(StartPointBlock<T> & block) const;
+
+			/**
+			All the roots of a start function, in double precision, in order of the angle they are rotated by.
+			*/
+			std::vector<dbl> StartFunctionRoots(dbl, size_t index) const;
+
+			/**
+			All the roots of a start function, in current default precision, in order of the angle they are rotated by.
+			*/
+			std::vector<mpfr_complex> StartFunctionRoots(mpfr_complex, size_t index) const;
+
 			std::vector<std::shared_ptr<node::Rational> > random_values_; ///< stores the random values for the start functions.  x^d-r, where r is stored in this vector.
 			std::vector<unsigned long long> degrees_; ///< stores the degrees of the functions.
 
@@ -31,6 +31,8 @@
 
 #pragma once
 
+#include <stdexcept>
+
 #include "bertini2/system/system.hpp"
 
 
@@ -38,6 +40,78 @@ namespace bertini
 {
 	namespace start_system{
 
+		/**
+		\brief A contiguous range of start points of a start system, stored coordinate by coordinate.
+
+		The points are the rows of a matrix, and matrices are stored column by column, so each coordinate of all the points is contiguous in memory.  A block is made once with StartSystem::StartPoints, and can then be shared by everything needing the start points, rather than each asking the start system to make them again.
+
+		\tparam T The number type of the points.
+		*/
+		template<typename T>
+		class StartPointBlock
+		{
+		public:
+
+			/**
+			\param first The index of the first start point in the block.
+			\param count The number of start points in the block.
+			*/
+			StartPointBlock(unsigned long long first = 0, unsigned long long count = 0) : first_(first), count_(count)
+			{}
+
+			/**
+			\brief The index of the first start point in the block.
+			*/
+			unsigned long long First() const
+			{
+				return first_;
+			}
+
+			/**
+			\brief The number of start points in the block.
+			*/
+			unsigned long long Size() const
+			{
+				return count_;
+			}
+
+			bool Contains(unsigned long long index) const
+			{
+				return index >= first_ && index - first_ < count_;
+			}
+
+			/**
+			\brief Get a start point, by its index in the start system.
+
+			\throws std::out_of_range if the point is not in the block.
+			*/
+			Vec<T> Point(unsigned long long index) const
+			{
+				if (!Contains(index))
+					throw std::out_of_range("start point " + std::to_string(index) + " is not in the block");
+				return coordinates_.row(index - first_).transpose();
+			}
+
+			/**
+			\brief The coordinates of the points, one row per point.
+			*/
+			Mat<T> const& Coordinates() const
+			{
+				return coordinates_;
+			}
+
+			Mat<T> & Coordinates()
+			{
+				return coordinates_;
+			}
+
+		private:
+			unsigned long long first_;
+			unsigned long long count_;
+			Mat<T> coordinates_;
+		};
+
+
 		/**
 		\brief Abstract base class for other start systems.
 
@@ -59,12 +133,60 @@ namespace bertini
 				return GenerateStartPoint(T(),index);
 			}
 
+			/**
+			\brief Get a contiguous range of start points at once.
+
+			Start systems which can make many points more cheaply than one at a time override GenerateStartPoints, and the rest make them one at a time.
+
+			\param first The index of the first start point.
+			\param count The number of start points.
+			\throws std::out_of_range if the range goes past the last start point.
+			*/
+			template<typename T>
+			StartPointBlock<T> StartPoints(unsigned long long first, unsigned long long count) const
+			{
+				if (first > NumStartPoints() || count > NumStartPoints() - first)
+					throw std::out_of_range("asking for start points past the last one");
+
+				StartPointBlock<T> block(first, count);
+				GenerateStartPoints(block);
+				return block;
+			}
+
 			virtual ~StartSystem() = default;
 			
 		private:
 			virtual Vec<dbl> GenerateStartPoint(dbl,unsigned long long index) const = 0;
 			virtual Vec<mpfr_complex> GenerateStartPoint(mpfr_complex,unsigned long long index) const = 0;
 
+			/**
+			Fill a block with its start points, in double precision.
+			*/
+			virtual void GenerateStartPoints(StartPointBlock<dbl> & block) const
+			{
+				GenerateStartPointsOneByOne(block);
+			}
+
+			/**
+			Fill a block with its start points, in current default precision.
+			*/
+			virtual void GenerateStartPoints(StartPointBlock<mpfr_complex> & block) const
+			{
+				GenerateStartPointsOneByOne(block);
+			}
+
+			template<typename T>
+			void GenerateStartPointsOneByOne(StartPointBlock<T> & block) const
+			{
+				for (unsigned long long ii = 0; ii < block.Size(); ++ii)
+				{
+					Vec<T> point = GenerateStartPoint(T(), block.First()+ii);
+					if (ii==0)
+						block.Coordinates().resize(block.Size(), point.size());
+					block.Coordinates().row(ii) = point.transpose();
+				}
+			}
+
 			friend class boost::serialization::access;
 
 			template <typename Archive>
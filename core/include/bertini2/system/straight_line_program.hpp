@@ -35,15 +35,21 @@
 
 #pragma once
 
+#include <algorithm>
 #include <assert.h>
+#include <cstdint>
 #include <vector>
 #include <map>
+#include <memory>
+#include <mutex>
 
 #include "bertini2/mpfr_complex.hpp"
 #include "bertini2/mpfr_extensions.hpp"
 #include "bertini2/eigen_extensions.hpp"
 #include "bertini2/function_tree/forward_declares.hpp"
+#include "bertini2/function_tree/eval_context.hpp"
 #include "bertini2/detail/visitor.hpp"
+#include "bertini2/system/compiled_slp.hpp"
 
 // code copied from Bertini1's file include/bertini.h
 
@@ -135,6 +141,7 @@ typedef struct {
 namespace bertini {
 
 	class SLPCompiler;
+	class SLPBatch;
 	class System; // a forward declaration, solving the circular inclusion problem
 
 
@@ -154,11 +161,12 @@ namespace bertini {
 		Acos=     1 << 12,
 		Atan=     1 << 13,
 		Assign=   1 << 14,
+		Sqrt=     1 << 15,
 	};
 
 	const int BinaryOperations = Add|Subtract | Multiply|Divide | Power;
 	const int TrigOperations   = Sin|Cos|Tan | Asin|Acos|Atan;
-	const int UnaryOperations  = Exp|Log | Negate | Assign | TrigOperations;
+	const int UnaryOperations  = Exp|Log | Negate | Assign | Sqrt | TrigOperations;
 
 	constexpr bool IsUnary(Operation op)
 	{
@@ -170,6 +178,96 @@ namespace bertini {
 		return op & BinaryOperations;
 	}
 
+
+	// computed goto is a GNU extension, also supported by clang and the intel compiler
+	#if defined(__GNUC__) && !defined(BERTINI_SLP_NO_COMPUTED_GOTO)
+		#define BERTINI_SLP_COMPUTED_GOTO
+	#endif
+
+
+	/**
+	 \brief The operations of the packed form of a SLP, with their effect on memory `m`, for the instruction `i`.
+
+	 These are the operations of the Operation enum, plus fused operations the SLP makes from common sequences of them when packing.  The list is expanded by the macro OP into both the enum of packed operations, and into the interpreter.
+	 */
+	#define BERTINI_SLP_PACKED_OPERATIONS(OP) \
+		OP(Add,          m[i->out] = m[i->in1] + m[i->in2]) \
+		OP(Subtract,     m[i->out] = m[i->in1] - m[i->in2]) \
+		OP(Multiply,     m[i->out] = m[i->in1] * m[i->in2]) \
+		OP(Divide,       m[i->out] = m[i->in1] / m[i->in2]) \
+		OP(Power,        m[i->out] = pow(m[i->in1], m[i->in2])) \
+		OP(Assign,       m[i->out] = m[i->in1]) \
+		OP(Negate,       m[i->out] = -m[i->in1]) \
+		OP(Sqrt,         m[i->out] = sqrt(m[i->in1])) \
+		OP(Exp,          m[i->out] = exp(m[i->in1])) \
+		OP(Log,          m[i->out] = log(m[i->in1])) \
+		OP(Sin,          m[i->out] = sin(m[i->in1])) \
+		OP(Cos,          m[i->out] = cos(m[i->in1])) \
+		OP(Tan,          m[i->out] = tan(m[i->in1])) \
+		OP(Asin,         m[i->out] = asin(m[i->in1])) \
+		OP(Acos,         m[i->out] = acos(m[i->in1])) \
+		OP(Atan,         m[i->out] = atan(m[i->in1])) \
+		OP(MultiplyAdd,  m[i->out] = m[i->in1] * m[i->in2] + m[i->in3]) \
+		OP(Square,       m[i->out] = m[i->in1] * m[i->in1]) \
+		OP(IntegerPower, m[i->out] = IntegerPower(m[i->in1], static_cast<std::int32_t>(i->in2)))
+
+
+	/**
+	 \brief The operations of the packed form of a SLP.
+
+	 \see PackedInstruction
+	 */
+	enum class PackedOperation : std::uint32_t {
+		#define BERTINI_SLP_ENUMERATE(name, ...) name,
+		BERTINI_SLP_PACKED_OPERATIONS(BERTINI_SLP_ENUMERATE)
+		#undef BERTINI_SLP_ENUMERATE
+		End ///< Marks the end of a packed program.
+	};
+
+
+	/**
+	 \brief One instruction of the packed form of a SLP.
+
+	 Every instruction has the same width, so the interpreter steps through them without needing to look up their arity, and the memory locations are 32-bit.  Unused operands are 0.
+
+	 * For MultiplyAdd, `out = in1*in2 + in3`.
+	 * For IntegerPower, `in2` is the exponent, as a signed integer, not a memory location.
+	 */
+	struct PackedInstruction
+	{
+		PackedOperation op;
+		std::uint32_t in1;
+		std::uint32_t in2;
+		std::uint32_t in3;
+		std::uint32_t out;
+	};
+
+
+	/**
+	 \brief Raise a number to an integer power, by repeated squaring.
+
+	 Unlike the complex pow of the standard library, this is exact up to roundoff in the multiplications, and cheap for small powers.
+	 */
+	template<typename T>
+	T IntegerPower(T const& x, std::int32_t k)
+	{
+		if (k<0)
+			return T(1)/IntegerPower(x,-k);
+		if (k==0)
+			return T(1);
+
+		T result(x), base(x);
+		for (auto e = k-1; e>0; e >>= 1)
+		{
+			if (e & 1)
+				result *= base;
+			if (e > 1)
+				base *= base;
+		}
+		return result;
+	}
+
+
 	/**
 	 \class StraightLineProgram
 
@@ -184,12 +282,18 @@ namespace bertini {
 
 	 Maybe you don't need to know this, but in construction the SLP uses a helper class, the SLPCompiler
 
-	 Patches are just functions in this framework.  The variables appear at the front of the memory, then functions, then derivatives.  This should make copying data out easy, because it's all in one place.
+	 Patches are just functions in this framework.  The variables appear at the front of the memory, then the path variable, then functions (the system's, followed by the patches), then derivatives.  This should make copying data out easy, because it's all in one place.
 
 	 In contrast to Bertini1 SLP's, we don't put all the numbers at the front -- they just get scattered through the SLP's memory.
+
+	 One call to Eval computes the functions, the Jacobian, and the time derivative all together, sharing all intermediate results between them.  Read them out afterwards using GetFuncVals, GetJacobian, and GetTimeDeriv.
+
+	 If an EvalContext is active on the calling thread, the SLP evaluates in memory held by the context instead of its own, so that one SLP can be used by several threads at once.
 	 */
 	class StraightLineProgram{
 		friend SLPCompiler;
+		friend SLPCodeGenerator;
+		friend SLPBatch;
 
 	private:
 		using Nd = std::shared_ptr<const node::Node>;
@@ -225,15 +329,48 @@ namespace bertini {
 		 */
 		struct NumberOf{
 			size_t Functions{0};
+			size_t Patches{0};
 			size_t Variables{0};
 			size_t Jacobian{0};
 			size_t TimeDeriv{0};
 		};
 
+		/**
+		 \struct OptimizationReport
+
+		 The sizes of a SLP before and after its optimization by the SLPCompiler, and what each step of the optimization removed.
+		 */
+		struct OptimizationReport{
+			size_t InstructionsBefore{0};
+			size_t InstructionsAfter{0};
+			size_t MemoryBefore{0};
+			size_t MemoryAfter{0};
+			size_t NumbersBefore{0};
+			size_t NumbersAfter{0};
+
+			size_t CommonSubexpressions{0}; ///< Instructions removed because an identical one was computed earlier.
+			size_t FoldedConstants{0}; ///< Instructions removed because all their operands were numbers.
+			size_t DeadInstructions{0}; ///< Instructions removed because nothing used their result.
+			size_t ForwardedOutputs{0}; ///< Copies into the outputs removed, by writing the result into the output directly.
+
+			friend std::ostream& operator <<(std::ostream& out, OptimizationReport const& r)
+			{
+				out << "instructions: " << r.InstructionsBefore << " -> " << r.InstructionsAfter << "\n";
+				out << "memory: " << r.MemoryBefore << " -> " << r.MemoryAfter << "\n";
+				out << "numbers: " << r.NumbersBefore << " -> " << r.NumbersAfter << "\n";
+				out << "removed " << r.CommonSubexpressions << " common subexpressions, " << r.FoldedConstants << " constant instructions, " << r.DeadInstructions << " dead instructions, and " << r.ForwardedOutputs << " copies to outputs\n";
+				return out;
+			}
+		};
+
 		/**
 		The constructor -- how to make a SLP from a System.
+
+		\param sys The system to compile.
+		\param optimize Whether to optimize the program after compiling it.  See SLPCompiler.
+		\param differentiate Whether to compile the derivatives of the system into the program.  If not, the program computes only the functions and patches, and no derivative trees are needed to make it; the Jacobian and time derivative are computed by differentiating the program itself in forward mode, with EvalForwardMode.
 		*/
-		StraightLineProgram(System const & sys);
+		StraightLineProgram(System const & sys, bool optimize = true, bool differentiate = true);
 
 		StraightLineProgram() = default;
 
@@ -275,16 +412,192 @@ namespace bertini {
 
 
 		/**
-		\brief loops through the instructions in memory and evaluates each operation
+		\brief Evaluate, unless the most recent evaluation in this number type was at exactly these variable values.
 
-		\tparam NumT numeric type
+		The outputs of a SLP depend only on its inputs, so the functions, Jacobian and time derivative can all be read out after one evaluation at a point.
+
+		\param variable_values The values of the variables.
+		*/
+		template<typename Derived>
+		void EvalIfChanged(Eigen::MatrixBase<Derived> const& variable_values) const
+		{
+			using NumT = typename Derived::Scalar;
+			if (!Memory<NumT>().is_evaluated || !HasVariableValues(variable_values))
+				Eval(variable_values);
+		}
+
+		/**
+		\brief Evaluate, unless the most recent evaluation in this number type was at exactly these variable and path variable values.
 
-		uses a switch to find different operations from memory to make sure its performing the correct evaluations
+		\param variable_values The values of the variables.
+		\param time The value of the path variable.
+		*/
+		template<typename Derived, typename ComplexT>
+		void EvalIfChanged(Eigen::MatrixBase<Derived> const& variable_values, ComplexT const& time) const
+		{
+			using NumT = typename Derived::Scalar;
+			static_assert(std::is_same<NumT, ComplexT>::value, "scalar types must be the same");
+
+			if (!Memory<NumT>().is_evaluated || !HasVariableValues(variable_values) || !HasPathVariable(time))
+				Eval(variable_values, time);
+		}
+
+
+		/**
+		\brief Evaluate the program, at the values of the inputs already in memory.
 
+		\tparam NumT numeric type
+
+		Runs the compiled form of the program, if using one (see UseCompiled), and otherwise the packed form.  Where the compiler supports it (see BERTINI_SLP_COMPUTED_GOTO), each operation jumps straight to the code for the next one, through a table of label addresses, instead of returning to the top of a loop and switching on the operation.  This gives the processor's branch predictor one indirect jump per operation to learn, instead of one for the whole program.
 		 */
 		template<typename NumT>
 		void Eval() const{
-			auto& memory =  std::get<std::vector<NumT>>(memory_);
+			if (packed_instructions_.empty())
+				throw std::runtime_error("evaluating a straight-line program which was never compiled");
+
+			auto& program_memory = Memory<NumT>();
+			auto m = program_memory.values.data();
+
+			program_memory.tangents_evaluated = false;
+
+			if (compiled_)
+			{
+				compiled_->Eval(m);
+				program_memory.is_evaluated = true;
+				return;
+			}
+
+			auto i = packed_instructions_.data();
+
+		#ifdef BERTINI_SLP_COMPUTED_GOTO
+			static void* const dispatch[] = {
+				#define BERTINI_SLP_LABEL_ADDRESS(name, ...) &&slp_##name,
+				BERTINI_SLP_PACKED_OPERATIONS(BERTINI_SLP_LABEL_ADDRESS)
+				#undef BERTINI_SLP_LABEL_ADDRESS
+				&&slp_End
+			};
+
+			goto *dispatch[static_cast<std::uint32_t>(i->op)];
+
+			#define BERTINI_SLP_THREADED_CASE(name, ...) \
+				slp_##name: \
+					__VA_ARGS__; \
+					++i; \
+					goto *dispatch[static_cast<std::uint32_t>(i->op)];
+			BERTINI_SLP_PACKED_OPERATIONS(BERTINI_SLP_THREADED_CASE)
+			#undef BERTINI_SLP_THREADED_CASE
+
+			slp_End:
+		#else
+			for (; i->op != PackedOperation::End; ++i)
+			{
+				switch (i->op)
+				{
+					#define BERTINI_SLP_SWITCH_CASE(name, ...) \
+						case PackedOperation::name: \
+							__VA_ARGS__; \
+							break;
+					BERTINI_SLP_PACKED_OPERATIONS(BERTINI_SLP_SWITCH_CASE)
+					#undef BERTINI_SLP_SWITCH_CASE
+					case PackedOperation::End:
+						break;
+				}
+			}
+		#endif
+
+			program_memory.is_evaluated = true;
+		}
+
+
+		/**
+		\brief Evaluate the functions, and their derivatives with respect to all the variables and time at once, by differentiating the program in forward mode, at the values of the inputs already in memory.
+
+		\tparam NumT numeric type
+
+		Every location in memory carries, along with its value, a tangent: the vector of derivatives of its value with respect to each variable, and the path variable, if any.  The tangents of the variables and time are unit vectors, and those of numbers are 0.  Each instruction computes its tangent from those of its operands by the chain rule, right after its value, so one sweep through the program gives the functions, the Jacobian, and the time derivative, with no derivative trees ever built.
+
+		The tangents take NumVariables()+1 numbers for each location of memory, and each instruction costs about as many operations as there are variables.  Always interprets the packed program, even when using compiled code for Eval.
+
+		\throws std::runtime_error if the program was compiled with its derivatives.  Those are computed by Eval.
+		 */
+		template<typename NumT>
+		void EvalForwardMode() const{
+			if (!forward_mode_)
+				throw std::runtime_error("evaluating a straight-line program in forward mode, but it was compiled with its derivatives");
+			if (packed_instructions_.empty())
+				throw std::runtime_error("evaluating a straight-line program which was never compiled");
+
+			auto& program_memory = Memory<NumT>();
+			if (program_memory.tangents.size() != program_memory.values.size()*NumTangents())
+				InitializeTangents(program_memory);
+
+			auto m = program_memory.values.data();
+			auto d = program_memory.tangents.data();
+			for (auto i = packed_instructions_.data(); i->op != PackedOperation::End; ++i)
+				ForwardModeStep(*i, m, d);
+
+			program_memory.is_evaluated = true;
+			program_memory.tangents_evaluated = true;
+		}
+
+
+		/**
+		\brief Evaluate in forward mode, unless the most recent evaluation in forward mode in this number type was at exactly these variable values.
+
+		\param variable_values The values of the variables.
+		*/
+		template<typename Derived>
+		void EvalForwardModeIfChanged(Eigen::MatrixBase<Derived> const& variable_values) const
+		{
+			using NumT = typename Derived::Scalar;
+			if (!Memory<NumT>().tangents_evaluated || !HasVariableValues(variable_values))
+			{
+				CopyVariableValues(variable_values);
+				EvalForwardMode<NumT>();
+			}
+		}
+
+		/**
+		\brief Evaluate in forward mode, unless the most recent evaluation in forward mode in this number type was at exactly these variable and path variable values.
+
+		\param variable_values The values of the variables.
+		\param time The value of the path variable.
+		*/
+		template<typename Derived, typename ComplexT>
+		void EvalForwardModeIfChanged(Eigen::MatrixBase<Derived> const& variable_values, ComplexT const& time) const
+		{
+			using NumT = typename Derived::Scalar;
+			static_assert(std::is_same<NumT, ComplexT>::value, "scalar types must be the same");
+
+			if (!Memory<NumT>().tangents_evaluated || !HasVariableValues(variable_values) || !HasPathVariable(time))
+			{
+				CopyVariableValues(variable_values);
+				CopyPathVariable(time);
+				EvalForwardMode<NumT>();
+			}
+		}
+
+
+		/**
+		\brief Whether the derivatives of this program are computed by EvalForwardMode, rather than compiled into it and computed by Eval.
+		*/
+		bool DifferentiatesInForwardMode() const
+		{
+			return forward_mode_;
+		}
+
+
+		/**
+		\brief Evaluate the program by interpreting the unpacked instructions, one operation at a time.
+
+		\tparam NumT numeric type
+
+		This is the straightforward interpreter, a switch inside a loop over the instructions, without the fused operations.  It computes the same values as Eval, and is kept for comparison.
+		 */
+		template<typename NumT>
+		void EvalUnpacked() const{
+			auto& program_memory = Memory<NumT>();
+			auto& memory = program_memory.values;
 			for (int ii = 0; ii<instructions_.size();/*the increment is done at end of loop depending on arity */) {
 				//in the unary case the loop will increment by 3
 				//binary: by 4
@@ -319,6 +632,10 @@ namespace bertini {
 						memory[this->instructions_[ii+2]] = -(memory[instructions_[ii+1]]);
 						break;
 
+					case Sqrt:
+						memory[this->instructions_[ii+2]] = sqrt(memory[instructions_[ii+1]]);
+						break;
+
 					case Log:
 						memory[this->instructions_[ii+2]] = log(memory[instructions_[ii+1]]);
 						break;
@@ -363,6 +680,8 @@ namespace bertini {
 					ii = ii+4;
 				}
 			}
+
+			program_memory.is_evaluated = true;
 		}
 
 
@@ -374,18 +693,15 @@ namespace bertini {
 
 		\param result The vector you're going to store the values into
 
-		the function will automatically resize your vector for you to be the correct size
+		the function will automatically resize your vector for you to be the correct size.  The values of the patches, if any, follow those of the system's functions.
 
 		 */
 		template<typename NumT>
 		void GetFuncVals(Vec<NumT> & result) const{
-			auto& memory =  std::get<std::vector<NumT>>(memory_);
 			// 1. make container, size correctly.
-			result.resize(number_of_.Functions);
+			result.resize(NumTotalFunctions());
 			// 2. copy content
-			for (int ii = 0; ii < number_of_.Functions; ++ii) {
-				result(ii) = memory[ii + output_locations_.Functions];
-			}
+			GetFuncValsInPlace(result);
 		}
 
 		/**
@@ -401,15 +717,10 @@ namespace bertini {
 
 		template<typename NumT>
 		void GetJacobian(Mat<NumT> & result) const{
-			auto& memory =  std::get<std::vector<NumT>>(memory_);
 			// 1. make container, size correctly.
-			result.resize(number_of_.Functions, number_of_.Variables);
+			result.resize(NumTotalFunctions(), number_of_.Variables);
 			// 2. copy content
-			for (int jj =0; jj < number_of_.Variables; ++jj) {
-				for (int ii = 0; ii < number_of_.Functions; ++ii) {
-					result(ii, jj) = memory[ii+jj*number_of_.Functions + output_locations_.Jacobian];
-				}
-			}
+			GetJacobianInPlace(result);
 		}
 
 		/**
@@ -425,13 +736,10 @@ namespace bertini {
 
 		template<typename NumT>
 		void GetTimeDeriv(Vec<NumT> & result) const{
-			auto& memory =  std::get<std::vector<NumT>>(memory_);
 			// 1. make container, size correctly.
-			result.resize(number_of_.Functions);
+			result.resize(NumTotalFunctions());
 			// 2. copy content
-			for (int ii = 0; ii < number_of_.Functions; ++ii) {
-				result(ii) = memory[ii + output_locations_.TimeDeriv];
-			}
+			GetTimeDerivInPlace(result);
 		}
 
 		/**
@@ -472,10 +780,156 @@ namespace bertini {
 		}
 
 
+		/**
+		\brief Copy the computed values of the functions into an existing vector, which must be of length at least NumTotalFunctions.
+		*/
+		template<typename Derived>
+		void GetFuncValsInPlace(Eigen::MatrixBase<Derived> & result) const{
+			using NumT = typename Derived::Scalar;
+			const auto& memory = Memory<NumT>().values;
+			for (size_t ii = 0; ii < NumTotalFunctions(); ++ii) {
+				result(ii) = memory[ii + output_locations_.Functions];
+			}
+		}
+
+		/**
+		\brief Copy the computed values of the Jacobian into an existing matrix, which must be NumTotalFunctions by NumVariables.
+		*/
+		template<typename Derived>
+		void GetJacobianInPlace(Eigen::MatrixBase<Derived> & result) const{
+			using NumT = typename Derived::Scalar;
+			const auto num_rows = NumTotalFunctions();
+
+			if (forward_mode_)
+			{
+				const auto& tangents = Memory<NumT>().tangents;
+				const auto width = NumTangents();
+				for (size_t jj = 0; jj < number_of_.Variables; ++jj)
+					for (size_t ii = 0; ii < num_rows; ++ii)
+						result(ii, jj) = tangents[(ii + output_locations_.Functions)*width + jj];
+				return;
+			}
+
+			const auto& memory = Memory<NumT>().values;
+			for (size_t jj = 0; jj < number_of_.Variables; ++jj) {
+				for (size_t ii = 0; ii < num_rows; ++ii) {
+					result(ii, jj) = memory[ii+jj*num_rows + output_locations_.Jacobian];
+				}
+			}
+		}
+
+		/**
+		\brief Copy the computed values of the time derivatives into an existing vector, which must be of length at least NumTotalFunctions.
+
+		\throws std::runtime_error if the SLP doesn't have a path variable.
+		*/
+		template<typename Derived>
+		void GetTimeDerivInPlace(Eigen::MatrixBase<Derived> & result) const{
+			if (!this->HavePathVariable())
+				throw std::runtime_error("getting time derivatives from a straight-line program without a path variable");
+
+			using NumT = typename Derived::Scalar;
+
+			if (forward_mode_)
+			{
+				const auto& tangents = Memory<NumT>().tangents;
+				const auto width = NumTangents();
+				for (size_t ii = 0; ii < NumTotalFunctions(); ++ii)
+					result(ii) = tangents[(ii + output_locations_.Functions)*width + number_of_.Variables];
+				return;
+			}
+
+			const auto& memory = Memory<NumT>().values;
+			for (size_t ii = 0; ii < NumTotalFunctions(); ++ii) {
+				result(ii) = memory[ii + output_locations_.TimeDeriv];
+			}
+		}
+
+
+		/**
+		\brief The number of functions of the system, not including patches.
+		*/
 		inline unsigned NumFunctions() const{ return number_of_.Functions;}
 
+		/**
+		\brief The number of patches.  Their values follow those of the functions.
+		*/
+		inline unsigned NumPatches() const{ return number_of_.Patches;}
+
+		/**
+		\brief The number of functions, including patches.
+		*/
+		inline unsigned NumTotalFunctions() const{ return number_of_.Functions + number_of_.Patches;}
+
 		inline unsigned NumVariables() const{ return number_of_.Variables;}
 
+		/**
+		\brief The number of instructions in the program.
+		*/
+		size_t NumInstructions() const;
+
+		/**
+		\brief The number of instructions in the packed form of the program, after fusing operations.
+		*/
+		size_t NumPackedInstructions() const
+		{
+			return packed_instructions_.empty() ? 0 : packed_instructions_.size()-1;
+		}
+
+		/**
+		\brief The number of numbers the program uses.
+		*/
+		size_t NumNumbers() const
+		{
+			return true_values_of_numbers_.size();
+		}
+
+		/**
+		\brief A hash of the structure of the program: its layout, its packed instructions, and where its numbers are, but not their values.
+
+		Programs with the same fingerprint can be evaluated by the same code.  This is how programs are matched to the evaluators generated for them by the SLPCodeGenerator.
+		*/
+		std::uint64_t Fingerprint() const;
+
+		/**
+		\brief Evaluate with code compiled ahead of time for this program, instead of interpreting it.
+
+		\throws std::runtime_error if the compiled program was generated for a program with a different fingerprint.
+		*/
+		void UseCompiled(CompiledSLP const& compiled);
+
+		/**
+		\brief Go back to interpreting the program, after UseCompiled.
+		*/
+		void UseInterpreter()
+		{
+			compiled_ = nullptr;
+		}
+
+		/**
+		\brief Whether Eval runs code compiled ahead of time, rather than interpreting.
+		*/
+		bool IsCompiled() const
+		{
+			return compiled_ != nullptr;
+		}
+
+		/**
+		\brief What optimization did to this program, if it was optimized.
+		*/
+		OptimizationReport const& GetOptimizationReport() const
+		{
+			return optimization_report_;
+		}
+
+		/**
+		\brief The number of memory locations used by the program, for inputs, numbers, intermediate results, and outputs.
+		*/
+		size_t MemorySize() const
+		{
+			return std::get<ProgramMemory<dbl_complex>>(memory_).values.size();
+		}
+
 
 		/**
 		\brief Get the current precision of the SLP.
@@ -491,7 +945,7 @@ namespace bertini {
 		/**
 		\brief change the precision of the SLP.
 
-		Downsamples from the true values.
+		Downsamples from the true values.  The multiple precision memory is kept for every precision the program has been used at, with the numbers already rounded into it, so changing back to a precision used before is a swap, and only the values of the variables and time are carried over.  The numbers are rounded from the true values only the first time a precision is used, and the rounded numbers are shared with copies of this program.
 
 		\param new_precision The new number of digits
 		*/
@@ -503,8 +957,7 @@ namespace bertini {
 		 \return Well, does it?
 		 */
 		bool HavePathVariable() const {
-			throw std::runtime_error("calling unimplemented function HavePathVariable");
-			return false;
+			return has_path_variable_;
 		}
 
 		/**
@@ -515,6 +968,30 @@ namespace bertini {
 
 	private:
 
+		/**
+		 \brief Get the memory in which to evaluate.
+
+		 This is the SLP's own memory, unless an EvalContext is active on this thread, in which case it is the memory in the context.  Memory in a context is seeded from the SLP's own when first used, or when made for another program.
+		 */
+		template<typename NumT>
+		ProgramMemory<NumT>& Memory() const{
+			auto& own = std::get<ProgramMemory<NumT>>(this->memory_);
+			if (auto ctx = EvalContext::Active())
+			{
+				auto& mem = ctx->Memory<NumT>();
+				if (mem.owner != this || mem.values.size() != own.values.size())
+				{
+					mem.values = own.values;
+					mem.is_evaluated = false;
+					mem.tangents.clear();
+					mem.tangents_evaluated = false;
+					mem.owner = this;
+				}
+				return mem;
+			}
+			return own;
+		}
+
 		/**
 		 \brief Copy the values of the variables from the passed in vector to memory
 
@@ -523,11 +1000,14 @@ namespace bertini {
 		template<typename Derived>
 		void CopyVariableValues(Eigen::MatrixBase<Derived> const& variable_values) const{
 			using NumT = typename Derived::Scalar;
-			auto& memory =  std::get<std::vector<NumT>>(memory_); // unpack for local reference
+			auto& memory =  Memory<NumT>().values; // unpack for local reference
+
+			if (variable_values.size() != number_of_.Variables)
+				throw std::runtime_error("number of variable values passed to straight-line program doesn't match its number of variables");
 
 			for (int ii = 0; ii < number_of_.Variables; ++ii) {
 				//assign  to memory
-				memory[ii + output_locations_.Variables] = variable_values(ii);
+				memory[ii + input_locations_.Variables] = variable_values(ii);
 			}
 		}
 
@@ -543,7 +1023,240 @@ namespace bertini {
 		void CopyPathVariable(ComplexT const& time) const{
 			if (!this->HavePathVariable())
 				throw std::runtime_error("calling Eval with path variable, but system doesn't have one.");
-			// then actually copy the path variable into where it goes in memory
+
+			Memory<ComplexT>().values[input_locations_.Time] = time;
+		}
+
+		/**
+		 \brief Check whether the variable values in memory are these.
+		 */
+		template<typename Derived>
+		bool HasVariableValues(Eigen::MatrixBase<Derived> const& variable_values) const{
+			using NumT = typename Derived::Scalar;
+			const auto& memory =  Memory<NumT>().values;
+
+			if (variable_values.size() != number_of_.Variables)
+				return false;
+
+			for (int ii = 0; ii < number_of_.Variables; ++ii)
+				if (memory[ii + input_locations_.Variables] != variable_values(ii))
+					return false;
+			return true;
+		}
+
+		/**
+		 \brief Check whether the path variable value in memory is this.
+		 */
+		template<typename ComplexT>
+		bool HasPathVariable(ComplexT const& time) const{
+			return this->HavePathVariable() && Memory<ComplexT>().values[input_locations_.Time] == time;
+		}
+
+		/**
+		 \brief The length of the tangent of each location in forward mode: the number of variables, plus one for the path variable, if any.
+		 */
+		size_t NumTangents() const
+		{
+			return number_of_.Variables + (has_path_variable_ ? 1 : 0);
+		}
+
+		/**
+		 \brief Make the tangents for forward mode: unit vectors for the variables and time, and 0 everywhere else.  The instructions overwrite the tangents of their results, so the rest stay 0.
+		 */
+		template<typename NumT>
+		void InitializeTangents(ProgramMemory<NumT> & program_memory) const
+		{
+			const auto width = NumTangents();
+			program_memory.tangents.assign(program_memory.values.size()*width, NumT(0));
+			for (size_t ii = 0; ii < number_of_.Variables; ++ii)
+				program_memory.tangents[(input_locations_.Variables + ii)*width + ii] = NumT(1);
+			if (has_path_variable_)
+				program_memory.tangents[input_locations_.Time*width + number_of_.Variables] = NumT(1);
+		}
+
+		/**
+		 \brief Do one packed instruction in forward mode, computing the value and the tangent of its result.
+
+		 The result is computed before it is stored, and each entry of its tangent is computed from the same entries of the tangents of its operands, so a result may overwrite one of its operands.
+
+		 \param i The instruction.
+		 \param m The values in memory.
+		 \param d The tangents in memory, NumTangents() numbers per location.
+		 */
+		template<typename NumT>
+		void ForwardModeStep(PackedInstruction const& i, NumT* m, NumT* d) const
+		{
+			const auto width = NumTangents();
+			NumT* d_out = d + i.out*width;
+			NumT const* d1 = d + i.in1*width;
+
+			// the tangent of a unary operation is its derivative at the operand, times the tangent of the operand
+			auto chain = [&](NumT const& derivative){
+				for (size_t k = 0; k < width; ++k)
+					d_out[k] = derivative*d1[k];
+			};
+
+			switch (i.op)
+			{
+				case PackedOperation::Add:
+				{
+					NumT const* d2 = d + i.in2*width;
+					for (size_t k = 0; k < width; ++k)
+						d_out[k] = d1[k] + d2[k];
+					m[i.out] = m[i.in1] + m[i.in2];
+					break;
+				}
+				case PackedOperation::Subtract:
+				{
+					NumT const* d2 = d + i.in2*width;
+					for (size_t k = 0; k < width; ++k)
+						d_out[k] = d1[k] - d2[k];
+					m[i.out] = m[i.in1] - m[i.in2];
+					break;
+				}
+				case PackedOperation::Multiply:
+				{
+					NumT const* d2 = d + i.in2*width;
+					NumT r = m[i.in1] * m[i.in2];
+					for (size_t k = 0; k < width; ++k)
+						d_out[k] = m[i.in2]*d1[k] + m[i.in1]*d2[k];
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::Divide:
+				{
+					NumT const* d2 = d + i.in2*width;
+					NumT r = m[i.in1] / m[i.in2];
+					NumT inverse = NumT(1) / m[i.in2];
+					for (size_t k = 0; k < width; ++k)
+						d_out[k] = (d1[k] - r*d2[k])*inverse;
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::Power:
+				{
+					NumT const* d2 = d + i.in2*width;
+					NumT r = pow(m[i.in1], m[i.in2]);
+					NumT d_base = m[i.in2]*pow(m[i.in1], m[i.in2] - NumT(1));
+
+					// the exponent is nearly always a number, and then the logarithm of the base, which may be 0, isn't needed
+					bool constant_exponent = std::all_of(d2, d2+width, [](NumT const& x){ return x==NumT(0); });
+					if (constant_exponent)
+						chain(d_base);
+					else
+					{
+						NumT d_exponent = r*log(m[i.in1]);
+						for (size_t k = 0; k < width; ++k)
+							d_out[k] = d_base*d1[k] + d_exponent*d2[k];
+					}
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::Assign:
+				{
+					if (d_out != d1)
+						std::copy(d1, d1+width, d_out);
+					m[i.out] = m[i.in1];
+					break;
+				}
+				case PackedOperation::Negate:
+				{
+					for (size_t k = 0; k < width; ++k)
+						d_out[k] = -d1[k];
+					m[i.out] = -m[i.in1];
+					break;
+				}
+				case PackedOperation::Sqrt:
+				{
+					NumT r = sqrt(m[i.in1]);
+					chain(NumT(1)/(NumT(2)*r));
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::Exp:
+				{
+					NumT r = exp(m[i.in1]);
+					chain(r);
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::Log:
+				{
+					NumT r = log(m[i.in1]);
+					chain(NumT(1)/m[i.in1]);
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::Sin:
+				{
+					NumT r = sin(m[i.in1]);
+					chain(cos(m[i.in1]));
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::Cos:
+				{
+					NumT r = cos(m[i.in1]);
+					chain(-sin(m[i.in1]));
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::Tan:
+				{
+					NumT r = tan(m[i.in1]);
+					chain(NumT(1) + r*r);
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::Asin:
+				{
+					NumT r = asin(m[i.in1]);
+					chain(NumT(1)/sqrt(NumT(1) - m[i.in1]*m[i.in1]));
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::Acos:
+				{
+					NumT r = acos(m[i.in1]);
+					chain(-NumT(1)/sqrt(NumT(1) - m[i.in1]*m[i.in1]));
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::Atan:
+				{
+					NumT r = atan(m[i.in1]);
+					chain(NumT(1)/(NumT(1) + m[i.in1]*m[i.in1]));
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::MultiplyAdd:
+				{
+					NumT const* d2 = d + i.in2*width;
+					NumT const* d3 = d + i.in3*width;
+					NumT r = m[i.in1] * m[i.in2] + m[i.in3];
+					for (size_t k = 0; k < width; ++k)
+						d_out[k] = m[i.in2]*d1[k] + m[i.in1]*d2[k] + d3[k];
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::Square:
+				{
+					NumT r = m[i.in1] * m[i.in1];
+					chain(NumT(2)*m[i.in1]);
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::IntegerPower:
+				{
+					const auto k = static_cast<std::int32_t>(i.in2);
+					NumT r = IntegerPower(m[i.in1], k);
+					chain(k==0 ? NumT(0) : NumT(NumT(k)*IntegerPower(m[i.in1], k-1)));
+					m[i.out] = r;
+					break;
+				}
+				case PackedOperation::End:
+					break;
+			}
 		}
 
 		/**
@@ -573,25 +1286,60 @@ namespace bertini {
 
 		template<typename NumT>
 		auto& GetMemory() const{
-			return std::get<std::vector<NumT>>(this->memory_);
+			return std::get<ProgramMemory<NumT>>(this->memory_).values;
 		}
 
 
 		template<typename NumT>
 		void CopyNumbersIntoMemory() const;
 
+		/**
+		 \brief The numbers of the program, in the order of true_values_of_numbers_, rounded to a precision.  Rounded from the true values the first time they are asked for at that precision.
+		 */
+		std::shared_ptr<const std::vector<mpfr_complex>> NumbersAtPrecision(unsigned precision) const;
+
+		/**
+		 \brief The numbers of a program rounded to each precision it has been used at, shared by copies of the program.
+		 */
+		struct NumberCache
+		{
+			std::mutex mutex;
+			std::map<unsigned, std::shared_ptr<const std::vector<mpfr_complex>>> values;
+		};
+
+		/**
+		 \brief Make the packed form of the program, which is what Eval runs, from the instructions.
+
+		 Fuses a multiplication followed by an addition of its result into a MultiplyAdd, when nothing else uses the product.  Turns powers with integer exponents into IntegerPower, or Square.  Must be called after the numbers are in memory, and after any change to the instructions.
+
+		 \throws std::runtime_error if the memory is too large to address with 32 bits.
+		 */
+		void Pack();
+
+		/**
+		 \brief One past the last location of the outputs.  The outputs start at the functions, and are one block.
+		 */
+		size_t EndOfOutputs() const;
 
-		unsigned precision_ = 0; //< The current working number of digits
+
+		mutable unsigned precision_ = 0; //< The current working number of digits
 		bool has_path_variable_ = false; //< Does this SLP have a path variable?
+		bool forward_mode_ = false; //< Are the derivatives computed by EvalForwardMode, rather than compiled into the program?
 
 		NumberOf number_of_;  //< Quantities of things
 		OutputLocations output_locations_; //< Where to find outputs, like functions and derivatives
 		InputLocations input_locations_; //< Where to find inputs, like variables and time
 
-		mutable std::tuple< std::vector<dbl_complex>, std::vector<mpfr_complex> > memory_; //< The memory of the object.  Numbers and variables, plus temp results and output locations.  It's all one block.  That's why it's called a SLP!
+		mutable std::tuple< ProgramMemory<dbl_complex>, ProgramMemory<mpfr_complex> > memory_; //< The memory of the object.  Numbers and variables, plus temp results and output locations.  It's all one block.  That's why it's called a SLP!
 
 		std::vector<size_t> instructions_; //< The instructions.  The opcodes are  stored as size_t's, as well as the locations of operands and results.
+		std::vector<PackedInstruction> packed_instructions_; //< The packed form of the instructions, ending with PackedOperation::End.  This is what Eval runs.
 		std::vector< std::pair<Nd,size_t> > true_values_of_numbers_; //< the size_t is where in memory to downsample to.
+		std::shared_ptr<NumberCache> numbers_at_precision_ = std::make_shared<NumberCache>(); //< The numbers rounded to each precision used so far.
+		mutable std::map<unsigned, ProgramMemory<mpfr_complex>> parked_memory_; //< The multiple precision memory and tangents at each precision used so far, other than the current one, kept so changing precision is a swap.  Only their values and tangents are used.
+
+		OptimizationReport optimization_report_; //< What the SLPCompiler's optimization did, if anything.
+		CompiledSLP const* compiled_ = nullptr; //< Code compiled ahead of time for this program, which Eval runs instead of interpreting, if set.
 	};
 
 
@@ -601,15 +1349,19 @@ namespace bertini {
 			public Visitor<node::Integer>,
 			public Visitor<node::Float>,
 			public Visitor<node::Rational>,
+			public Visitor<node::special_number::Pi>,
+			public Visitor<node::special_number::E>,
 			public Visitor<node::Function>,
 			public Visitor<node::Jacobian>,
 			public Visitor<node::Differential>,
 
 			// arithmetic
 			public Visitor<node::SumOperator>,
+			public Visitor<node::NegateOperator>,
 			public Visitor<node::MultOperator>,
 			public Visitor<node::IntegerPowerOperator>,
 			public Visitor<node::PowerOperator>,
+			public Visitor<node::SqrtOperator>,
 			public Visitor<node::ExpOperator>,
 			public Visitor<node::LogOperator>,
 
@@ -638,6 +1390,14 @@ namespace bertini {
 
 		public:
 
+			/**
+			 \param optimize Whether to optimize the compiled programs.  See Optimize.
+			 \param differentiate Whether to compile the derivatives of systems into the programs, or only their functions and patches, to be differentiated in forward mode.  See StraightLineProgram::EvalForwardMode.
+			 */
+			explicit
+			SLPCompiler(bool optimize = true, bool differentiate = true) : optimize_(optimize), differentiate_(differentiate)
+			{}
+
 			SLP Compile(System const& sys);
 
 			// symbols and roots
@@ -645,15 +1405,19 @@ namespace bertini {
 			virtual void Visit(node::Integer const& n);
 			virtual void Visit(node::Float const& n);
 			virtual void Visit(node::Rational const& n);
+			virtual void Visit(node::special_number::Pi const& n);
+			virtual void Visit(node::special_number::E const& n);
 			virtual void Visit(node::Function const& n);
 			virtual void Visit(node::Jacobian const& n);
 			virtual void Visit(node::Differential const& n);
 
 			// arithmetic
 			virtual void Visit(node::SumOperator const& n);
+			virtual void Visit(node::NegateOperator const& n);
 			virtual void Visit(node::MultOperator const& n);
 			virtual void Visit(node::IntegerPowerOperator const& n);
 			virtual void Visit(node::PowerOperator const& n);
+			virtual void Visit(node::SqrtOperator const& n);
 			virtual void Visit(node::ExpOperator const& n);
 			virtual void Visit(node::LogOperator const& n);
 
@@ -679,11 +1443,55 @@ namespace bertini {
 						this->locations_encountered_symbols_[nd] = next_available_mem_++; // add to found symbols in the compiler, increment counter.
 			}
 
+			/**
+			 \brief Get the location in memory of the result of a node, compiling the node first if it hasn't been encountered yet.
+
+			 \throws std::runtime_error if the node is of a type the compiler doesn't know.
+			 */
+			size_t LocationOf(std::shared_ptr<node::Node> const& n);
+
+			/**
+			 \brief Put an integer into memory, and get its location.
+			 */
+			size_t LocationOfInteger(int value);
+
+			/**
+			 \brief Compile a unary operation, the result of which is the value of the node n.
+			 */
+			template<typename NodeT>
+			void DealWithUnary(NodeT const& n, Operation op){
+				auto location_operand = LocationOf(n.Operand());
+				this->locations_encountered_symbols_[n.shared_from_this()] =  next_available_mem_;
+				slp_under_construction_.AddInstruction(op,location_operand, next_available_mem_++);
+			}
+
+			/**
+			 \brief Compile the patch of a system, if it has one, as additional functions.
+			 */
+			void CompilePatch(System const& sys);
+
+			/**
+			 \brief Optimize the compiled program.
+
+			 Compiling visits each node of the system once, but different nodes often compute the same thing.  Differentiation in particular produces the same monomials and numbers over and over across the entries of the Jacobian.  This pass, run over the compiled instructions,
+
+			 1. gives each computed value a key, made of its operation and the keys of its operands, with the operands of sums and products sorted.  Numbers get keys by value when integer.  An instruction whose key was already computed is removed (hash-consing);
+			 2. folds instructions operating only on numbers into new numbers, which are kept as expressions of the old ones so that they are exact at any precision.  Outputs which are constant become numbers, and so are never recomputed;
+			 3. removes instructions whose results are not used by any output, and writes results copied into an output directly into it;
+			 4. allocates the intermediate results into as few memory locations as possible, reusing a location once its value is no longer needed.
+
+			 The counts before and after are recorded in the SLP's OptimizationReport.
+			 */
+			void Optimize();
+
 			/**
 			 \brief Reset the compiler to compile another SLP from another system.
 			 */
 			void Clear();
 
+			bool optimize_; //< Whether to optimize compiled programs.
+			bool differentiate_; //< Whether to compile the derivatives into the programs.
+			size_t end_of_outputs_ = 0; //< One past the last memory location of the outputs.  The inputs and outputs come before.
 			size_t next_available_mem_ = 0; //< Where should the next thing in memory go?
 			std::map<Nd, size_t> locations_encountered_symbols_; //< A registry of pointers-to-nodes and location in memory on where to find *their results*
 			SLP slp_under_construction_; //< the under-construction SLP.  will be returned at end of `compile`
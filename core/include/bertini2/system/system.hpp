@@ -41,6 +41,7 @@
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/vector.hpp>
 #include <boost/serialization/deque.hpp>
+#include <boost/serialization/version.hpp>
 #include <boost/type_index.hpp>
 
 #include "bertini2/mpfr_complex.hpp"
@@ -49,7 +50,11 @@
 
 
 #include "bertini2/function_tree.hpp"
+#include "bertini2/function_tree/eval_context.hpp"
 #include "bertini2/system/patch.hpp"
+#include "bertini2/system/polynomial_system.hpp"
+#include "bertini2/system/sparse_jacobian.hpp"
+#include "bertini2/system/straight_line_program.hpp"
 
 
 #include <boost/archive/binary_oarchive.hpp>
@@ -63,9 +68,9 @@ namespace bertini {
 	
 	enum class JacobianEvalMethod
 	{
-		JacobianNode,
-		Derivatives
-		//StraightLineProgram not yet....
+		JacobianNode, ///< Differentiate each function into a Jacobian node, which is evaluated once per variable.
+		Derivatives, ///< Differentiate each function with respect to each variable, and time, into trees of their own.
+		ForwardMode ///< Build no derivative trees.  Compile the functions alone into a StraightLineProgram, and differentiate it in forward mode with respect to all the variables and time at once, computing the functions, Jacobian and time derivative in one sweep.  See StraightLineProgram::EvalForwardMode.
 	};
 
 	/**
@@ -73,6 +78,23 @@ namespace bertini {
 	*/
 	JacobianEvalMethod DefaultJacobianEvalMethod();
 
+
+	/**
+	\brief How a system evaluates its functions, Jacobian, and time derivatives.
+	*/
+	enum class EvalMethod
+	{
+		FunctionTree, ///< Evaluate the nodes of the function tree, and of the derivatives, each separately.
+		StraightLineProgram, ///< Evaluate a StraightLineProgram compiled from the system, computing functions, Jacobian and time derivatives in one pass.
+		CompiledStraightLineProgram, ///< Like StraightLineProgram, but running C++ generated for the program ahead of time by the SLPCodeGenerator, instead of interpreting it.
+		Polynomial ///< Evaluate a PolynomialSystem expanded from the system, its functions as flat arrays of monomials, and their derivatives from the exponents.  For polynomial systems only.
+	};
+
+	/**
+	\brief Gets the default evaluation method for systems.
+	*/
+	EvalMethod DefaultEvalMethod();
+
 	/**
 	\brief Get the default value for whether a system should autosimplify.
 	*/
@@ -137,6 +159,8 @@ namespace bertini {
 		/**
 		Change the precision of the entire system's functions, subfunctions, and all other nodes.
 
+		When evaluating with a straight-line program, only the variables, patch and program change precision right away, and the rest of the function tree is brought to the new precision the next time it is evaluated.  The program keeps its memory at every precision it has been used at, so adaptive precision tracking moving back and forth between a few precisions doesn't walk the tree or re-round the numbers at each change.
+
 		\param new_precision The new precision, in digits, to work in.  This only affects the mpfr_complex types, not double.  To use low-precision (doubles), use that number type in the templated functions.
 		*/
 		void precision(unsigned new_precision) const;
@@ -185,6 +209,8 @@ namespace bertini {
 						iter->Reset();
 					break;
 				}
+				case JacobianEvalMethod::ForwardMode:
+					break; // nothing is stored between evaluations but in the straight-line program, which knows its inputs
 			}
 		}
 
@@ -204,6 +230,8 @@ namespace bertini {
 						iter->Reset();
 					break;
 				}
+				case JacobianEvalMethod::ForwardMode:
+					break;
 			}
 		}
 
@@ -212,6 +240,9 @@ namespace bertini {
 		*/
 		void Reset() const
 		{
+			if (EvalContext::Active())
+				return; // evaluating through a context doesn't touch the tree
+
 			ResetFunctions();
 			ResetJacobian();
 			ResetTimeDerivatives();
@@ -235,6 +266,24 @@ namespace bertini {
 				throw std::runtime_error(ss.str());
 			}
 
+			if (UsesPolynomialSystem())
+			{
+				EvalPolynomialSystem<T>(false);
+				GetPolynomialSystem().GetFuncValsInPlace(function_values);
+				if (IsPatched())
+					patch_.EvalInPlace(function_values, CurrentVariableValues<T>());
+				return;
+			}
+
+			if (UsesStraightLineProgram())
+			{
+				EvalStraightLineProgram<T>();
+				GetStraightLineProgram().GetFuncValsInPlace(function_values);
+				return;
+			}
+
+			SyncTreePrecision();
+
 			unsigned counter(0);
 			for (auto iter=functions_.begin(); iter!=functions_.end(); iter++, counter++) {
 				(*iter)->EvalInPlace<T>(function_values(counter));
@@ -242,7 +291,7 @@ namespace bertini {
 
 			if (IsPatched())
 				patch_.EvalInPlace(function_values,
-									std::get<Vec<T> >(current_variable_values_));
+									CurrentVariableValues<T>());
 									// .segment(NumFunctions(),NumTotalVariableGroups())
 			
 		}
@@ -417,6 +466,24 @@ namespace bertini {
 			{
 				throw std::runtime_error("trying to evaluate jacobian of system in place, but input J doesn't have right number of columns or rows");
 			}
+
+			if (UsesPolynomialSystem())
+			{
+				EvalPolynomialSystem<T>(true);
+				GetPolynomialSystem().GetJacobianInPlace(J);
+				if (IsPatched())
+					patch_.JacobianInPlace(J,CurrentVariableValues<T>());
+				return;
+			}
+
+			if (UsesStraightLineProgram())
+			{
+				EvalStraightLineProgramDerivatives<T>();
+				GetStraightLineProgram().GetJacobianInPlace(J);
+				return;
+			}
+
+			SyncTreePrecision();
 			
 			const auto& vars = Variables();
 
@@ -439,10 +506,12 @@ namespace bertini {
 							space_derivatives_[ii+jj*NumFunctions()]->EvalInPlace<T>(J(ii,jj));
 					break;
 				}
+				case JacobianEvalMethod::ForwardMode:
+					break; // evaluated through the straight-line program, above
 			}
 			
 			if (IsPatched())
-				patch_.JacobianInPlace(J,std::get<Vec<T> >(current_variable_values_));
+				patch_.JacobianInPlace(J,CurrentVariableValues<T>());
 			
 		}
 
@@ -453,6 +522,82 @@ namespace bertini {
 		
 
 
+		/**
+		\brief Which entries of the Jacobian matrix can be non-zero, including the rows of the patch.
+
+		An entry for a function and a variable can be non-zero if the function depends on the variable at all, which is found when differentiating, and the entries of the patch are those of the variables in each group.  Use it to make matrices for SparseJacobianInPlace, as with JacobianPattern::MakeMatrix.
+		*/
+		JacobianPattern JacobianSparsity() const;
+
+
+		/**
+		\brief Whether SparseJacobianInPlace can evaluate the Jacobian of this system, entry by entry.
+
+		True when the Jacobian is evaluated from the function tree.  Straight-line programs and polynomial systems evaluate the Jacobian whole, so for them, evaluate it densely with JacobianInPlace.
+		*/
+		bool EvaluatesJacobianSparsely() const
+		{
+			return !UsesStraightLineProgram() && !UsesPolynomialSystem();
+		}
+
+
+		/**
+		 \brief Evaluate the Jacobian matrix of the system, using the previous space and time values, in place, into a sparse matrix.
+
+		 Only the entries which can be non-zero are evaluated, so for systems whose functions each depend on only a few of the variables, this is much less work than JacobianInPlace.
+
+		 \param J A compressed matrix with the pattern from JacobianSparsity.
+		 \throws std::runtime_error if the matrix doesn't have the pattern, or if the system evaluates with a straight-line program or polynomial system.  See EvaluatesJacobianSparsely.
+		*/
+		template<typename T>
+		void SparseJacobianInPlace(Eigen::SparseMatrix<T> & J) const
+		{
+			if (!EvaluatesJacobianSparsely())
+				throw std::runtime_error("trying to evaluate sparse jacobian of system, but it evaluates with a straight-line program or polynomial system, which evaluate the jacobian whole");
+
+			if (!is_differentiated_)
+				Differentiate();
+			if (!HasJacobianSparsity())
+				ComputeJacobianSparsity();
+
+			if (J.rows() != NumTotalFunctions() || J.cols() != NumVariables() || !J.isCompressed()
+			    || static_cast<size_t>(J.nonZeros()) != NumJacobianNonzeros())
+				throw std::runtime_error("trying to evaluate sparse jacobian of system in place, but input J doesn't have the pattern of the jacobian");
+
+			T* values = J.valuePtr();
+			const auto num_functions = NumFunctions();
+
+			SyncTreePrecision();
+
+			const auto& vars = Variables();
+
+			// the function rows come first in each column, and then the patch row, if any
+			const auto& patch_groups = patch_group_of_variables_;
+			int kk = 0;
+			for (int jj = 0; jj < NumVariables(); ++jj)
+			{
+				for (auto ii : jacobian_rows_of_columns_[jj])
+				{
+					switch (jacobian_eval_method_)
+					{
+						case JacobianEvalMethod::JacobianNode:
+							jacobian_[ii]->EvalJInPlace<T>(values[kk], vars[jj]);
+							break;
+						case JacobianEvalMethod::Derivatives:
+							space_derivatives_[ii+jj*num_functions]->EvalInPlace<T>(values[kk]);
+							break;
+						case JacobianEvalMethod::ForwardMode:
+							break; // evaluated through the straight-line program, which is refused above
+					}
+					++kk;
+				}
+
+				if (IsPatched())
+					values[kk++] = patch_.Coefficients<T>(patch_groups[jj].first)(patch_groups[jj].second);
+			}
+		}
+
+
 		/**
 		Evaluate the Jacobian matrix of the system, using the previous space and time values.
 
@@ -704,6 +849,24 @@ namespace bertini {
 			if (!HavePathVariable())
 				throw std::runtime_error("computing time derivative of system with no path variable defined");
 
+			if (UsesPolynomialSystem())
+			{
+				EvalPolynomialSystem<T>(true);
+				GetPolynomialSystem().GetTimeDerivInPlace(ds_dt);
+				if (IsPatched())
+					for (int ii = 0; ii < NumTotalVariableGroups(); ++ii)
+						ds_dt(ii+NumFunctions()) = T(0);
+				return;
+			}
+
+			if (UsesStraightLineProgram())
+			{
+				EvalStraightLineProgramDerivatives<T>();
+				GetStraightLineProgram().GetTimeDerivInPlace(ds_dt);
+				return;
+			}
+
+			SyncTreePrecision();
 
 			if (!is_differentiated_)
 				Differentiate();
@@ -722,6 +885,8 @@ namespace bertini {
 						time_derivatives_[ii]->EvalInPlace<T>(ds_dt(ii));
 					break;
 				}
+				case JacobianEvalMethod::ForwardMode:
+					break; // evaluated through the straight-line program, above
 			}
 
 			// the patch doesn't move with time.  derivatives 0.
@@ -755,6 +920,233 @@ namespace bertini {
 			return ds_dt;
 		}
 		
+
+
+
+		//////////////////
+		//
+		//  The evaluation method
+		//
+		//////////////////
+
+
+		/**
+		\brief Set how the system evaluates its functions, Jacobian, and time derivatives.
+
+		With EvalMethod::StraightLineProgram, the system is compiled into a StraightLineProgram the first time it is evaluated, and the program is evaluated instead of the function tree.  The program computes the functions, patches, Jacobian and time derivative all in one pass, so whichever of them is asked for first at a point pays for all of them, and the rest are read out for free.  This suits trackers, which need all three at every point.
+
+		With EvalMethod::CompiledStraightLineProgram, the program is evaluated by code generated for it ahead of time by the SLPCodeGenerator, compiled, and registered with the CompiledSLPRegistry, either by being linked in or loaded with CompiledSLPRegistry::Load.  The generated code must be for a program of the same structure as this system's, though its numbers may differ.
+
+		With EvalMethod::Polynomial, the functions of the system are expanded into a PolynomialSystem the first time it is evaluated, and the derivatives are computed from the exponents of its monomials, so no derivatives are made, whatever the JacobianEvalMethod.  Only for systems which are polynomial in their variables and path variable.
+
+		The results are the same either way, up to roundoff.
+
+		\param method The method to use.
+		*/
+		void SetEvalMethod(EvalMethod method)
+		{
+			if (method==eval_method_)
+				return;
+
+			// the derivatives are made differently with and without a polynomial system
+			if (method==EvalMethod::Polynomial || eval_method_==EvalMethod::Polynomial)
+				is_differentiated_ = false;
+
+			slp_.reset();
+			poly_.reset();
+			eval_method_ = method;
+		}
+
+		/**
+		\brief Get the method the system uses for evaluation.
+		*/
+		EvalMethod GetEvalMethod() const
+		{
+			return eval_method_;
+		}
+
+		/**
+		\brief Set how the system computes its Jacobian and time derivative.
+
+		With JacobianEvalMethod::ForwardMode, no derivative trees are built.  Instead, the functions and patches alone are compiled into a StraightLineProgram, whatever the EvalMethod, and the program is differentiated in forward mode whenever the Jacobian or time derivative is asked for.  Setting up is then only compiling the functions, rather than differentiating every function with respect to every variable, which for large systems is by far the cheaper.  Evaluating costs about as many operations per instruction as there are variables.
+
+		The system is differentiated again, by the new method, when next evaluated.
+
+		\param method The method to use.
+		*/
+		void SetJacobianEvalMethod(JacobianEvalMethod method)
+		{
+			if (method==jacobian_eval_method_)
+				return;
+
+			jacobian_eval_method_ = method;
+			is_differentiated_ = false;
+			slp_.reset();
+		}
+
+		/**
+		\brief Get the method the system uses for computing its Jacobian and time derivative.
+		*/
+		JacobianEvalMethod GetJacobianEvalMethod() const
+		{
+			return jacobian_eval_method_;
+		}
+
+		/**
+		\brief Get the straight-line program compiled from this system, compiling it if necessary.
+
+		The program is recompiled after anything changing the structure of the system, such as adding functions or patching.  With EvalMethod::CompiledStraightLineProgram, the program uses the registered compiled code with its fingerprint.
+
+		\throws std::runtime_error if evaluating with EvalMethod::CompiledStraightLineProgram, and no compiled code for the program is registered.
+		*/
+		StraightLineProgram const& GetStraightLineProgram() const;
+
+		/**
+		\brief Get the polynomial system expanded from this system, expanding it if necessary.
+
+		The expansion is redone after anything changing the functions of the system.
+
+		\throws std::runtime_error if the system is not polynomial.
+		*/
+		PolynomialSystem const& GetPolynomialSystem() const;
+
+
+
+
+		//////////////////
+		//
+		//  Evaluation through an EvalContext -- for evaluating one system from several threads at once.
+		//
+		//////////////////
+
+
+		/**
+		\brief Make a new context for evaluating this system.
+
+		Also does the lazy setup of the system, differentiating it, ordering its variables, and compiling the straight-line program or expanding the polynomial system through which contexts evaluate, so that evaluation through contexts need not modify the system.  Hence this should be called before sharing the system between threads.
+
+		Evaluating through a context always goes through the polynomial system, if the system evaluates with one, and otherwise through the straight-line program, even for systems evaluating their function trees, so values agree with evaluating without a context to roundoff.
+
+		\see EvalContext
+		*/
+		EvalContext NewEvalContext() const;
+
+
+		/**
+		\brief Evaluate the system in place, using an EvalContext.
+
+		Takes the same arguments as the corresponding EvalInPlace without a context, and behaves the same, except that all values are stored in the context instead of the system, and it evaluates through the straight-line program or polynomial system.  Calls with different contexts may run concurrently, as long as nothing else modifies the system meanwhile.
+
+		\param ctx The context in which to evaluate.  Must not be in use by another thread.
+		\param function_values The function values, computed.
+		\param args The values of the variables, and of the path variable if defined.  If omitted, the values previously set through this context are used.
+		*/
+		template<typename Derived, typename ...ArgsT>
+		void EvalInPlace(EvalContext & ctx, Eigen::MatrixBase<Derived> & function_values, ArgsT const& ...args) const
+		{
+			EvalContext::Scope scope(ctx);
+			ctx.SyncPrecision(precision());
+			EvalInPlace(function_values, args...);
+		}
+
+		/**
+		\brief Evaluate the system using an EvalContext, provided the system has no path variable defined.
+		*/
+		template<typename T>
+		Vec<T> Eval(EvalContext & ctx, const Vec<T> & variable_values) const
+		{
+			Vec<T> function_values(NumTotalFunctions());
+			EvalInPlace(ctx, function_values, variable_values);
+			return function_values;
+		}
+
+		/**
+		\brief Evaluate the system using an EvalContext, provided a path variable is defined for the system.
+		*/
+		template<typename T>
+		Vec<T> Eval(EvalContext & ctx, const Vec<T> & variable_values, const T & path_variable_value) const
+		{
+			Vec<T> function_values(NumTotalFunctions());
+			EvalInPlace(ctx, function_values, variable_values, path_variable_value);
+			return function_values;
+		}
+
+
+		/**
+		\brief Evaluate the Jacobian of the system in place, using an EvalContext.
+
+		\see EvalInPlace(EvalContext&, Eigen::MatrixBase<Derived>&, ArgsT const&...)
+		*/
+		template<typename Derived, typename ...ArgsT>
+		void JacobianInPlace(EvalContext & ctx, Eigen::MatrixBase<Derived> & J, ArgsT const& ...args) const
+		{
+			EvalContext::Scope scope(ctx);
+			ctx.SyncPrecision(precision());
+			JacobianInPlace(J, args...);
+		}
+
+		/**
+		\brief Evaluate the Jacobian of the system using an EvalContext, provided the system has no path variable defined.
+		*/
+		template<typename T>
+		Mat<T> Jacobian(EvalContext & ctx, const Vec<T> & variable_values) const
+		{
+			Mat<T> J(NumTotalFunctions(), NumVariables());
+			JacobianInPlace(ctx, J, variable_values);
+			return J;
+		}
+
+		/**
+		\brief Evaluate the Jacobian of the system using an EvalContext, provided a path variable is defined for the system.
+		*/
+		template<typename T>
+		Mat<T> Jacobian(EvalContext & ctx, const Vec<T> & variable_values, const T & path_variable_value) const
+		{
+			Mat<T> J(NumTotalFunctions(), NumVariables());
+			JacobianInPlace(ctx, J, variable_values, path_variable_value);
+			return J;
+		}
+
+
+		/**
+		\brief Compute the time-derivative of the system in place, using an EvalContext.
+
+		\see EvalInPlace(EvalContext&, Eigen::MatrixBase<Derived>&, ArgsT const&...)
+		*/
+		template<typename Derived, typename ...ArgsT>
+		void TimeDerivativeInPlace(EvalContext & ctx, Eigen::MatrixBase<Derived> & ds_dt, ArgsT const& ...args) const
+		{
+			EvalContext::Scope scope(ctx);
+			ctx.SyncPrecision(precision());
+			TimeDerivativeInPlace(ds_dt, args...);
+		}
+
+		/**
+		\brief Compute the time-derivative of the system using an EvalContext.
+		*/
+		template<typename T>
+		Vec<T> TimeDerivative(EvalContext & ctx, const Vec<T> & variable_values, const T & path_variable_value) const
+		{
+			Vec<T> ds_dt(NumTotalFunctions());
+			TimeDerivativeInPlace(ctx, ds_dt, variable_values, path_variable_value);
+			return ds_dt;
+		}
+
+
+		/**
+		\brief Set the values of the variables in a context, and reset the values of the system stored there.
+
+		\see SetAndReset
+		*/
+		template<typename T, typename ...ArgsT>
+		void SetAndReset(EvalContext & ctx, Vec<T> const& new_space, ArgsT const& ...new_time) const
+		{
+			EvalContext::Scope scope(ctx);
+			ctx.SyncPrecision(precision());
+			SetAndReset(new_space, new_time...);
+		}
+
+
 		/**
 		Homogenize the system, adding new homogenizing variables for each VariableGroup defined for the system.
 
@@ -901,13 +1293,17 @@ namespace bertini {
 					throw std::runtime_error("internally, precision of variables (" + std::to_string(vars[0]->node::NamedSymbol::precision()) + ") in SetVariables must match the precision of the system (" + std::to_string(this->precision()) + ").");
 			#endif
 
-			auto counter = 0;
+			// evaluating through a context doesn't touch the tree, so leaves its variables alone
+			if (!EvalContext::Active())
+			{
+				auto counter = 0;
 
-			for (auto iter=vars.begin(); iter!=vars.end(); iter++, counter++) {
-				(*iter)->set_current_value(new_values(counter));
+				for (auto iter=vars.begin(); iter!=vars.end(); iter++, counter++) {
+					(*iter)->set_current_value(new_values(counter));
+				}
 			}
 
-			std::get<Vec<T> >(current_variable_values_) = new_values;
+			CurrentVariableValues<T>() = new_values;
 		}
 
 
@@ -926,7 +1322,10 @@ namespace bertini {
 			if (!have_path_variable_)
 				throw std::runtime_error("trying to set the value of the path variable, but one is not defined for this system");
 
-			path_variable_->set_current_value(new_value);
+			if (auto ctx = EvalContext::Active())
+				ctx->PathVariableValue<T>() = new_value;
+			else
+				path_variable_->set_current_value(new_value);
 		}
 
 
@@ -1589,6 +1988,25 @@ namespace bertini {
 		void DifferentiateUsingDerivatives() const;
 		void DifferentiateUsingJacobianNode() const;
 
+		/**
+		 Finds which variables each function depends on, and the patch equation of each variable, and stores them internally, for the sparsity pattern of the Jacobian.  Each function is walked once.
+		*/
+		void ComputeJacobianSparsity() const;
+
+		/**
+		 Whether the sparsity pattern of the Jacobian has been found for the current functions, variables and patch.
+		*/
+		bool HasJacobianSparsity() const
+		{
+			return jacobian_rows_of_columns_.size() == NumVariables()
+			    && patch_group_of_variables_.size() == (IsPatched() ? NumVariables() : 0);
+		}
+
+		/**
+		 The number of entries of the Jacobian which can be non-zero, including those of the patch.
+		*/
+		size_t NumJacobianNonzeros() const;
+
 		/**
 		 Puts together the ordering of variables, and stores it internally.
 		*/
@@ -1623,15 +2041,126 @@ namespace bertini {
 
 		mutable bool is_differentiated_ = false; ///< indicator for whether the jacobian tree has been populated.
 
+		mutable std::vector< std::vector<int> > jacobian_rows_of_columns_; ///< For each variable, the functions which depend on it, in increasing order.  Found when first needed, after differentiating.
+
+		mutable std::vector< std::pair<unsigned, unsigned> > patch_group_of_variables_; ///< For each variable, the index of its patch equation, and its index in that equation.  Empty if not patched.  Found with jacobian_rows_of_columns_.
+
 
 		std::vector< VariableGroupType > time_order_of_variable_groups_;
 
 		mutable std::tuple< Vec<dbl>, Vec<mpfr_complex> > current_variable_values_;
 
+		/**
+		\brief The most recently set variable values, from the EvalContext active on this thread if there is one.
+		*/
+		template<typename T>
+		Vec<T>& CurrentVariableValues() const
+		{
+			if (auto ctx = EvalContext::Active())
+				return ctx->VariableValues<T>();
+			return std::get<Vec<T> >(current_variable_values_);
+		}
+
+		/**
+		\brief The most recently set value of the path variable, from the EvalContext active on this thread if there is one.
+		*/
+		template<typename T>
+		T CurrentPathVariableValue() const
+		{
+			if (auto ctx = EvalContext::Active())
+				return ctx->PathVariableValue<T>();
+			return path_variable_->Eval<T>();
+		}
+
+		/**
+		\brief Change the precision of the function tree: the functions, subfunctions, parameters and derivatives.
+		*/
+		void TreePrecision(unsigned new_precision) const;
+
+		/**
+		\brief Bring the function tree to the precision of the system, if changes of precision were put off while evaluating with a straight-line program.
+		*/
+		void SyncTreePrecision() const
+		{
+			if (tree_precision_ != precision_)
+				TreePrecision(precision_);
+		}
+
+		/**
+		\brief Whether the system evaluates through a straight-line program, interpreted or compiled.  Systems differentiated in forward mode always do, and so does evaluation through an EvalContext, the nodes of the tree not being evaluated through contexts.
+		*/
+		bool UsesStraightLineProgram() const
+		{
+			return !UsesPolynomialSystem() && (eval_method_!=EvalMethod::FunctionTree || jacobian_eval_method_==JacobianEvalMethod::ForwardMode || EvalContext::Active());
+		}
+
+		/**
+		\brief Whether the system evaluates through a polynomial system expanded from it, whatever its JacobianEvalMethod.
+		*/
+		bool UsesPolynomialSystem() const
+		{
+			return eval_method_==EvalMethod::Polynomial;
+		}
+
+		/**
+		\brief Evaluate the polynomial system at the most recently set variable (and time) values, unless it was already evaluated there.
+
+		\param derivatives Whether to evaluate the derivatives too, or only the functions.
+		*/
+		template<typename T>
+		void EvalPolynomialSystem(bool derivatives) const
+		{
+			const auto& poly = GetPolynomialSystem();
+			if (derivatives)
+			{
+				if (HavePathVariable())
+					poly.EvalIfChanged(CurrentVariableValues<T>(), CurrentPathVariableValue<T>());
+				else
+					poly.EvalIfChanged(CurrentVariableValues<T>());
+			}
+			else
+			{
+				if (HavePathVariable())
+					poly.EvalFunctionsIfChanged(CurrentVariableValues<T>(), CurrentPathVariableValue<T>());
+				else
+					poly.EvalFunctionsIfChanged(CurrentVariableValues<T>());
+			}
+		}
+
+		/**
+		\brief Evaluate the straight-line program at the most recently set variable (and time) values, unless it was already evaluated there.
+		*/
+		template<typename T>
+		void EvalStraightLineProgram() const
+		{
+			const auto& slp = GetStraightLineProgram();
+			if (HavePathVariable())
+				slp.EvalIfChanged(CurrentVariableValues<T>(), CurrentPathVariableValue<T>());
+			else
+				slp.EvalIfChanged(CurrentVariableValues<T>());
+		}
+
+		/**
+		\brief Evaluate the straight-line program at the most recently set variable (and time) values, including its derivatives, unless it was already evaluated there.  For programs differentiated in forward mode, this is a forward mode evaluation.
+		*/
+		template<typename T>
+		void EvalStraightLineProgramDerivatives() const
+		{
+			const auto& slp = GetStraightLineProgram();
+			if (!slp.DifferentiatesInForwardMode())
+				return EvalStraightLineProgram<T>();
+
+			if (HavePathVariable())
+				slp.EvalForwardModeIfChanged(CurrentVariableValues<T>(), CurrentPathVariableValue<T>());
+			else
+				slp.EvalForwardModeIfChanged(CurrentVariableValues<T>());
+		}
+
 		mutable VariableGroup variable_ordering_; ///< The assembled ordering of the variables in the system.
 		mutable bool have_ordering_ = false;
 
 		mutable unsigned precision_; ///< the current working precision of the system 
+		mutable unsigned tree_precision_ = DefaultPrecision(); ///< the precision of the function tree, which lags precision_ while evaluating with a straight-line program
 
 		bool assume_uniform_precision_ = false; ///< a bit, setting whether we can assume the system is in uniform precision.  if you are doing things that will allow pieces of the system to drift in terms of precision, then you should not assume this.  \see AssumeUniformPrecision
 
@@ -1639,11 +2168,18 @@ namespace bertini {
 
 		bool auto_simplify_ = DefaultAutoSimplify();
 
+		EvalMethod eval_method_ = DefaultEvalMethod(); ///< Whether to evaluate the function tree, or a straight-line program compiled from it.
+		mutable std::shared_ptr<StraightLineProgram> slp_; ///< The straight-line program compiled from this system, if evaluating with one.  Compiled lazily.
+		mutable std::shared_ptr<PolynomialSystem> poly_; ///< The polynomial system expanded from this system, if evaluating with one.  Expanded lazily.
+
 		friend class boost::serialization::access;
 
 		template <typename Archive>
 		void serialize(Archive& ar, const unsigned version) {
 
+			if (Archive::is_saving::value)
+				SyncTreePrecision(); // the tree is saved at the precision of the system
+
 			ar & ungrouped_variables_;
 			ar & variable_groups_;
 			ar & hom_variable_groups_;
@@ -1671,11 +2207,24 @@ namespace bertini {
 			ar & time_derivatives_;
 			
 			ar & precision_;
+			tree_precision_ = precision_;
 			ar & is_patched_;
 			ar & patch_;
 
 			ar & assume_uniform_precision_;
 			ar & jacobian_eval_method_;
+
+			// the evaluation method is saved from version 1 on.  systems from older archives evaluate their function trees, as they did then
+			if (version > 0)
+				ar & eval_method_;
+			else if (Archive::is_loading::value)
+				eval_method_ = EvalMethod::FunctionTree;
+
+			if (Archive::is_loading::value)
+			{
+				slp_.reset();
+				poly_.reset();
+			}
 		}
 
 	};
@@ -1708,6 +2257,9 @@ namespace bertini {
 	void Simplify(System & sys);
 }
 
+// version 1 added the evaluation method
+BOOST_CLASS_VERSION(bertini::System, 1)
+
 
 
 
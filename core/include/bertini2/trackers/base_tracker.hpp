@@ -176,6 +176,7 @@ namespace bertini{
 			{
 				SetPredictor(new_predictor_choice);
 				corrector_->Settings(newton);
+				predictor_->SparseJacobian(newton.sparse_jacobian);
 				
 				SetTrackingTolerance(tracking_tolerance);
 
@@ -357,6 +358,18 @@ namespace bertini{
 			}
 
 
+			/**
+			\brief Give this tracker its own copies of the predictor and corrector.
+
+			Copies of a tracker share the predictor and corrector of the original, and hence their temporaries.  That's fine for trackers used one after the other, but not for trackers used concurrently.  Call this on a copy before using it on a different thread from the original, and then associate it to its own system with SetSystem.
+			*/
+			void SeparatePredictorCorrector()
+			{
+				predictor_ = std::make_shared< predict::ExplicitRKPredictor >(*predictor_);
+				corrector_ = std::make_shared< correct::NewtonCorrector >(*corrector_);
+			}
+
+
 			/**
 			\brief get a const reference to the system.
 			*/
@@ -385,6 +398,29 @@ namespace bertini{
 				return num_failed_steps_taken_ + num_successful_steps_taken_;
 			}
 
+			/**
+			\brief The work done since the counts were last reset, by precision.
+
+			Unlike the step counters, these accumulate across paths: function and Jacobian evaluations and LU factorizations made by the predictor and corrector, and the steps taken and changes of precision made by the tracker.  Trackers copied from this one without SeparatePredictorCorrector share its predictor and corrector, and so their counts of evaluations.
+			*/
+			TrackingCounts Counts() const
+			{
+				auto counts = counts_;
+				counts += predictor_->Counts();
+				counts += corrector_->Counts();
+				return counts;
+			}
+
+			/**
+			\brief Set all the counts returned by Counts() to zero.
+			*/
+			void ResetCounts() const
+			{
+				counts_.Reset();
+				predictor_->ResetCounts();
+				corrector_->ResetCounts();
+			}
+
 			/**
 			\brief Set how large the stepsize should be.
 
@@ -518,6 +554,7 @@ namespace bertini{
 			*/
 			void IncrementBaseCountersSuccess() const
 			{
+				++counts_.At(CurrentPrecision()).successful_steps;
 				num_successful_steps_taken_++; 
 				num_consecutive_successful_steps_++;
 				current_time_ += delta_t_;
@@ -535,6 +572,7 @@ namespace bertini{
 			*/
 			void IncrementBaseCountersFail() const
 			{
+				++counts_.At(CurrentPrecision()).failed_steps;
 				num_consecutive_successful_steps_=0;
 				num_failed_steps_taken_++;
 				num_consecutive_failed_steps_++;
@@ -567,6 +605,7 @@ namespace bertini{
 			mutable unsigned num_consecutive_successful_steps_; ///< The number of CONSECUTIVE successful steps taken in a row.
 			mutable unsigned num_consecutive_failed_steps_; ///< The number of CONSECUTIVE failed steps taken in a row. 
 			mutable unsigned num_failed_steps_taken_; ///< The total number of failed steps taken.
+			mutable TrackingCounts counts_; ///< Steps and changes of precision, by precision, since ResetCounts().  Not reset with each path.
 
 			
 			// configuration for tracking
@@ -636,6 +675,14 @@ namespace bertini{
 				return this->norm_delta_z_;
 			}
 
+			/**
+			\brief The code returned by the most recent step, successful or not.
+			*/
+			SuccessCode LatestStepSuccessCode() const
+			{
+				return this->step_success_code_;
+			}
+
 			void SetInfiniteTruncation(bool b)
 			{
 				infinite_path_truncation_ = b;
@@ -97,6 +97,8 @@ namespace tracking{
 	{
 		unsigned max_num_newton_iterations = 2; //MaxNewtonIts
 		unsigned min_num_newton_iterations = 1;
+		bool mixed_precision = false; ///< In multiple precision with adaptive precision, factor the Jacobian in double precision and reuse the factorization while the Newton steps contract, computing only the residuals in the working precision.  A factorization is made in the working precision when AMP Criterion A says double precision is not enough for the Jacobian.
+		bool sparse_jacobian = false; ///< Evaluate the Jacobian only at the entries which can be non-zero, and factor it with a sparse LU, whose ordering is worked out once per system.  Worthwhile for large systems whose functions each involve only a few of the variables.  Systems evaluating with a straight-line program or polynomial system evaluate the Jacobian whole, so are corrected densely regardless.
 	};
 
 
@@ -0,0 +1,124 @@
+//This file is part of Bertini 2.
+//
+//trackers/counts.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//trackers/counts.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with trackers/counts.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+
+/**
+\file include/bertini2/trackers/counts.hpp
+
+\brief Counts of the work done while tracking, by precision.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+
+namespace bertini {
+
+	namespace tracking{
+
+		/**
+		\brief Counts of the work done while tracking, at one precision.
+		*/
+		struct PrecisionCounts
+		{
+			std::size_t function_evaluations = 0; ///< Evaluations of the homotopy.
+			std::size_t jacobian_evaluations = 0; ///< Evaluations of the Jacobian with respect to the space variables.
+			std::size_t time_derivative_evaluations = 0; ///< Evaluations of the derivative with respect to the path variable.
+			std::size_t lu_factorizations = 0;
+			std::size_t successful_steps = 0;
+			std::size_t failed_steps = 0;
+			std::size_t precision_increases = 0; ///< Changes from this precision to a higher one.
+			std::size_t precision_decreases = 0; ///< Changes from this precision to a lower one.
+
+			PrecisionCounts& operator+=(PrecisionCounts const& other)
+			{
+				function_evaluations += other.function_evaluations;
+				jacobian_evaluations += other.jacobian_evaluations;
+				time_derivative_evaluations += other.time_derivative_evaluations;
+				lu_factorizations += other.lu_factorizations;
+				successful_steps += other.successful_steps;
+				failed_steps += other.failed_steps;
+				precision_increases += other.precision_increases;
+				precision_decreases += other.precision_decreases;
+				return *this;
+			}
+		};
+
+
+		/**
+		\brief Counts of the work done while tracking, split by the precision it was done in.
+
+		Double precision is counted as DoublePrecision() digits.  Trackers, predictors and correctors each keep their own, and trackers add up all three in Counts().
+		*/
+		class TrackingCounts
+		{
+		public:
+
+			/**
+			\brief The counts at a precision, in digits, made if there are none yet.
+			*/
+			PrecisionCounts& At(unsigned precision)
+			{
+				return counts_[precision];
+			}
+
+			/**
+			\brief The counts at each precision used so far.
+			*/
+			std::map<unsigned, PrecisionCounts> const& ByPrecision() const
+			{
+				return counts_;
+			}
+
+			/**
+			\brief The counts at all precisions, added up.
+			*/
+			PrecisionCounts Total() const
+			{
+				PrecisionCounts total;
+				for (auto const& c : counts_)
+					total += c.second;
+				return total;
+			}
+
+			void Reset()
+			{
+				counts_.clear();
+			}
+
+			TrackingCounts& operator+=(TrackingCounts const& other)
+			{
+				for (auto const& c : other.counts_)
+					counts_[c.first] += c.second;
+				return *this;
+			}
+
+		private:
+			std::map<unsigned, PrecisionCounts> counts_;
+		};
+
+	} //re: namespace tracking
+
+}// re: namespace bertini
@@ -73,7 +73,7 @@ namespace bertini {
 	*/
 	template<class ObservedT, typename NumT>
 	class SuccessfulPredict : public TrackingEvent<ObservedT>
-	{ BOOST_TYPE_INDEX_REGISTER_CLASS
+	{ BOOST_TYPE_INDEX_REGISTER_CLASS BERTINI_REGISTER_EVENT_TYPE(TrackingEvent<ObservedT>)
 	public:
 		/**
 		\brief The constructor for a SuccessfulPredict Event.
@@ -103,7 +103,7 @@ namespace bertini {
 	*/
 	template<class ObservedT, typename NumT>
 	class SuccessfulCorrect : public TrackingEvent<ObservedT>
-	{ BOOST_TYPE_INDEX_REGISTER_CLASS
+	{ BOOST_TYPE_INDEX_REGISTER_CLASS BERTINI_REGISTER_EVENT_TYPE(TrackingEvent<ObservedT>)
 	public:
 		/**
 		\brief The constructor for a SuccessfulCorrect Event.
@@ -139,7 +139,7 @@ namespace bertini {
 
 	template<class ObservedT>
 	class PrecisionChanged : public PrecisionEvent<ObservedT>
-	{ BOOST_TYPE_INDEX_REGISTER_CLASS
+	{ BOOST_TYPE_INDEX_REGISTER_CLASS BERTINI_REGISTER_EVENT_TYPE(PrecisionEvent<ObservedT>)
 	public:
 		/**
 		\brief The constructor for a PrecisionChanged Event.
@@ -176,7 +176,7 @@ namespace bertini {
 	*/
 	template<class ObservedT>
 	class PrecisionIncreased : public PrecisionChanged<ObservedT>
-	{ BOOST_TYPE_INDEX_REGISTER_CLASS
+	{ BOOST_TYPE_INDEX_REGISTER_CLASS BERTINI_REGISTER_EVENT_TYPE(PrecisionChanged<ObservedT>)
 	public:
 		/**
 		\brief The constructor for a PrecisionIncreased Event.
@@ -197,7 +197,7 @@ namespace bertini {
 	*/
 	template<class ObservedT>
 	class PrecisionDecreased : public PrecisionChanged<ObservedT>
-	{ BOOST_TYPE_INDEX_REGISTER_CLASS
+	{ BOOST_TYPE_INDEX_REGISTER_CLASS BERTINI_REGISTER_EVENT_TYPE(PrecisionChanged<ObservedT>)
 	public:
 		/**
 		\brief The constructor for a PrecisionDecreased Event.
@@ -295,7 +295,7 @@ namespace bertini {
 	*/
 	template<class ObservedT, typename NumT>
 	class Initializing : public TrackingEvent<ObservedT>
-	{ BOOST_TYPE_INDEX_REGISTER_CLASS
+	{ BOOST_TYPE_INDEX_REGISTER_CLASS BERTINI_REGISTER_EVENT_TYPE(TrackingEvent<ObservedT>)
 	public:
 
 		/**
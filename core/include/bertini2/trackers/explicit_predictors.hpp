@@ -33,8 +33,10 @@
 #define BERTINI_EXPLICIT_PREDICTORS_HPP
 
 #include "bertini2/trackers/amp_criteria.hpp"
+#include "bertini2/trackers/counts.hpp"
 
 #include "bertini2/system/system.hpp"
+#include "bertini2/system/sparse_jacobian.hpp"
 #include "bertini2/mpfr_extensions.hpp"
 #include <Eigen/LU>
 
@@ -163,6 +165,12 @@ namespace bertini{
 					{
 						return n.GetLU_d();
 					}
+
+					template<typename N>
+					static Eigen::PartialPivLU<Mat<dbl>>& RunTemp(N & n)
+					{
+						return n.GetLUTemp_d();
+					}
 				};
 
 				template<>
@@ -173,6 +181,12 @@ namespace bertini{
 					{
 						return n.GetLU_mp();
 					}
+
+					template<typename N>
+					static Eigen::PartialPivLU<Mat<mpfr_complex>>& RunTemp(N & n)
+					{
+						return n.GetLUTemp_mp();
+					}
 				};
 			}
 			
@@ -366,6 +380,27 @@ namespace bertini{
 					std::get< Vec<dbl> >(dh_dt_temp_).resize(numTotalFunctions_);
 					std::get< Vec<mpfr_complex> >(dh_dt_temp_).resize(numTotalFunctions_);
 
+					std::get< Vec<dbl> >(stage_temp_).resize(numTotalFunctions_);
+					std::get< Vec<mpfr_complex> >(stage_temp_).resize(numTotalFunctions_);
+					std::get< Vec<dbl> >(stage_space_).resize(numVariables_);
+					std::get< Vec<mpfr_complex> >(stage_space_).resize(numVariables_);
+					std::get< Vec<dbl> >(norm_temp_).resize(numVariables_);
+					std::get< Vec<mpfr_complex> >(norm_temp_).resize(numVariables_);
+
+					// drawn once per system, rather than every step, for estimating the norm of the inverse of the Jacobian.  kept for a system of the same size, so that copies of a tracker, made to track on clones of its system on other threads, estimate as the original does, and draw nothing from the shared generators
+					if (std::get< Vec<dbl> >(random_units_).size()!=numVariables_)
+					{
+						std::get< Vec<dbl> >(random_units_) = RandomOfUnits<dbl>(numVariables_);
+						std::get< Vec<mpfr_complex> >(random_units_) = RandomOfUnits<mpfr_complex>(numVariables_);
+					}
+
+					LU_temp_d_ = Eigen::PartialPivLU<Mat<dbl>>(numVariables_);
+					LU_temp_mp_.clear();
+
+					// the pattern of the Jacobian is analyzed again when next used
+					std::get< SparseJacobianLU<dbl> >(sparse_LU_).Forget();
+					std::get< SparseJacobianLU<mpfr_complex> >(sparse_LU_).Forget();
+
 					ResizeK();
 				}
 				
@@ -385,6 +420,19 @@ namespace bertini{
 					return current_precision_;
 				}
 
+				/**
+				\brief The evaluations and factorizations made while predicting, by precision, since the counts were last reset.
+				*/
+				TrackingCounts const& Counts() const
+				{
+					return counts_;
+				}
+
+				void ResetCounts()
+				{
+					counts_.Reset();
+				}
+
 				/** 
 				 /brief Change the precision of the predictor variables and reassign the Butcher table variables.
 				 
@@ -399,6 +447,13 @@ namespace bertini{
 					Precision(std::get< Mat<mpfr_complex> >(dh_dx_0_),new_precision);
 					Precision(std::get< Mat<mpfr_complex> >(dh_dx_temp_),new_precision);
 
+					Precision(std::get< Vec<mpfr_complex> >(stage_temp_),new_precision);
+					Precision(std::get< Vec<mpfr_complex> >(stage_space_),new_precision);
+					Precision(std::get< Vec<mpfr_complex> >(norm_temp_),new_precision);
+					Precision(std::get< Vec<mpfr_complex> >(random_units_),new_precision);
+					Precision(std::get< mpfr_complex >(stage_time_),new_precision);
+					std::get< SparseJacobianLU<mpfr_complex> >(sparse_LU_).Precision(new_precision);
+
 					Precision(std::get< Mat<mpfr_float> >(a_),new_precision);
 					Precision(std::get< Vec<mpfr_float> >(b_),new_precision);
 					Precision(std::get< Vec<mpfr_float> >(b_minus_bstar_),new_precision);
@@ -429,6 +484,8 @@ namespace bertini{
 					assert(Precision(dhdttemp)==current_precision_);
 					assert(Precision(dhdx0)==current_precision_);
 					assert(Precision(dhdxtemp)==current_precision_);
+					assert(Precision(std::get< Vec<mpfr_complex> >(stage_space_))==current_precision_);
+					assert(Precision(std::get< Vec<mpfr_complex> >(random_units_))==current_precision_);
 
 					assert(Precision(a)==current_precision_);
 					assert(Precision(b)==current_precision_);
@@ -459,7 +516,7 @@ namespace bertini{
 				template<typename ComplexType>
 				SuccessCode Predict(Vec<ComplexType> & next_space,
 									System const& S,
-									const Vec<ComplexType>& current_space, ComplexType current_time,
+									const Vec<ComplexType>& current_space, ComplexType const& current_time,
 									ComplexType const& delta_t,
 									NumErrorT & condition_number_estimate,
 									unsigned & num_steps_since_last_condition_number_computation,
@@ -505,7 +562,7 @@ namespace bertini{
 									NumErrorT & norm_J,
 									NumErrorT & norm_J_inverse,
 									System const& S,
-									const Vec<ComplexType>& current_space, ComplexType current_time,
+									const Vec<ComplexType>& current_space, ComplexType const& current_time,
 									ComplexType const& delta_t,
 									NumErrorT & condition_number_estimate,
 									unsigned & num_steps_since_last_condition_number_computation,
@@ -574,7 +631,7 @@ namespace bertini{
 									NumErrorT & norm_J,
 									NumErrorT & norm_J_inverse,
 									System const& S,
-									const Vec<ComplexType>& current_space, ComplexType current_time,
+									const Vec<ComplexType>& current_space, ComplexType const& current_time,
 									ComplexType const& delta_t,
 									NumErrorT & condition_number_estimate,
 									unsigned & num_steps_since_last_condition_number_computation,
@@ -629,6 +686,22 @@ namespace bertini{
 					return p_;
 				}
 				
+				/**
+				\brief Set whether to evaluate the Jacobian only at the entries which can be non-zero, and factor it with a sparse LU, as with NewtonConfig::sparse_jacobian.
+				*/
+				void SparseJacobian(bool sparse)
+				{
+					sparse_jacobian_ = sparse;
+				}
+
+				/**
+				\brief Get whether the Jacobian is evaluated and factored sparsely.
+				*/
+				bool SparseJacobian() const
+				{
+					return sparse_jacobian_;
+				}
+				
 				/**
 				\brief Get whether the current prediction method provides an error estimate.
 
@@ -669,6 +742,32 @@ namespace bertini{
 					return LU_mp_[current_precision_];
 				}
 
+				template <typename T>
+				Eigen::PartialPivLU<Mat<T>>& GetLUTemp()
+				{
+					return LUSelector<T>::RunTemp(*this);
+				}
+
+				/**
+				\brief The counts for the precision of a computation in ComplexType.
+				*/
+				template <typename ComplexType>
+				PrecisionCounts& CountsAt()
+				{
+					return counts_.At(std::is_same<ComplexType,dbl>::value ? DoublePrecision() : current_precision_);
+				}
+
+				Eigen::PartialPivLU<Mat<dbl>>& GetLUTemp_d()
+				{
+					return LU_temp_d_;
+				}
+
+				Eigen::PartialPivLU<Mat<mpfr_complex>>& GetLUTemp_mp()
+				{
+					assert(current_precision_==DefaultPrecision());
+					return LU_temp_mp_[current_precision_];
+				}
+
 				/**
 				 \brief Performs a full prediction step from current_time to current_time + delta_t
 				 
@@ -701,28 +800,35 @@ namespace bertini{
 					Mat<RealType>& aref = std::get< Mat<RealType> >(a_);
 					Vec<RealType>& bref = std::get< Vec<RealType> >(b_);
 					Vec<RealType>& cref = std::get< Vec<RealType> >(c_);
-					Kref.fill(ComplexType(0));
-					Vec<ComplexType> temp(S.NumTotalFunctions());
+					Vec<ComplexType>& temp = std::get< Vec<ComplexType> >(stage_temp_);
+					Vec<ComplexType>& stage_space = std::get< Vec<ComplexType> >(stage_space_);
+					ComplexType& stage_time = std::get< ComplexType >(stage_time_);
+					Kref.setZero();
 					
 					if(EvalRHS(S, current_space, current_time, Kref, 0) != SuccessCode::Success)
 					{
 						return SuccessCode::MatrixSolveFailureFirstPartOfPrediction;
 					}
 					
+					// the stages are formed in the workspace, so no vectors are made during a step
 					for(int ii = 1; ii < s_; ++ii)
 					{
-						temp.setZero();
-						for(int jj = 0; jj < ii; ++jj)
+						temp = aref(ii,0)*Kref.col(0);
+						for(int jj = 1; jj < ii; ++jj)
 							temp += aref(ii,jj)*Kref.col(jj);
 
-						// Vec<ComplexType> wfp = 
-						if(EvalRHS<ComplexType>(S, current_space + delta_t*temp, current_time + cref(ii)*delta_t, Kref, ii) != SuccessCode::Success)
+						stage_space = current_space + delta_t*temp;
+						stage_time = delta_t;
+						stage_time *= cref(ii);
+						stage_time += current_time;
+
+						if(EvalRHS<ComplexType>(S, stage_space, stage_time, Kref, ii) != SuccessCode::Success)
 							return SuccessCode::MatrixSolveFailure;
 					}
 					
 					
-					temp.setZero();
-					for(int ii = 0; ii < s_; ++ii)
+					temp = bref(0)*Kref.col(0);
+					for(int ii = 1; ii < s_; ++ii)
 						temp += bref(ii)*Kref.col(ii);
 										
 					next_space = current_space + delta_t*temp;
@@ -735,15 +841,22 @@ namespace bertini{
 				void SetNormsCond(NumErrorT & norm_J, NumErrorT & norm_J_inverse, NumErrorT & condition_number_estimate, unsigned num_steps_since_last_condition_number_computation, unsigned frequency_of_CN_estimation)
 				{
 					// Calculate condition number and update if needed
-					Eigen::PartialPivLU<Mat<ComplexType>>& LUref = GetLU<ComplexType>();
-					Mat<ComplexType>& dhdxref = std::get< Mat<ComplexType> >(dh_dx_0_);
+					if (sparse_jacobian_)
+					{
+						norm_J = sparse_norm_J_;
+						norm_J_inverse = sparse_norm_J_inverse_;
+					}
+					else
+					{
+						Eigen::PartialPivLU<Mat<ComplexType>>& LUref = GetLU<ComplexType>();
+						Mat<ComplexType>& dhdxref = std::get< Mat<ComplexType> >(dh_dx_0_);
 
-					// TODO this random vector should not be made fresh every time.  especiallyif the numeric type is mpfr_complex!
-					Vec<ComplexType> randy = RandomOfUnits<ComplexType>(numVariables_);
-					Vec<ComplexType> temp_soln = LUref.solve(randy);
-					
-					norm_J = NumErrorT(dhdxref.norm());
-					norm_J_inverse = NumErrorT(temp_soln.norm());
+						Vec<ComplexType>& temp_soln = std::get< Vec<ComplexType> >(norm_temp_);
+						temp_soln = LUref.solve(std::get< Vec<ComplexType> >(random_units_));
+						
+						norm_J = NumErrorT(dhdxref.norm());
+						norm_J_inverse = NumErrorT(temp_soln.norm());
+					}
 					
 					if (num_steps_since_last_condition_number_computation >= frequency_of_CN_estimation)
 					{
@@ -773,11 +886,10 @@ namespace bertini{
 					Mat<ComplexType>& Kref = std::get< Mat<ComplexType> >(K_);
 					Vec<RealType>& b_minus_bstar_ref = std::get< Vec<RealType> >(b_minus_bstar_);
 					
-					auto numFuncs = Kref.rows();
-					Vec<ComplexType> err(numFuncs);
+					Vec<ComplexType>& err = std::get< Vec<ComplexType> >(stage_temp_);
 					
-					err.setZero();
-					for(int ii = 0; ii < s_; ++ii)
+					err = b_minus_bstar_ref(0)*Kref.col(0);
+					for(int ii = 1; ii < s_; ++ii)
 					{
 						err += (b_minus_bstar_ref(ii))*Kref.col(ii);
 					}
@@ -828,6 +940,56 @@ namespace bertini{
 				
 				
 				
+				/**
+				 \brief Evaluates the RHS of the Davidenko differential equation at a particular time and space, with the Jacobian evaluated and factored sparsely.
+
+				 The pattern of the Jacobian is analyzed the first time it is evaluated for a system.  Every stage refactors the same matrix, which after the step holds the Jacobian of the last stage, so the norms for the AMP criteria are computed from the stage 0 factorization before the other stages overwrite it, and reported by SetNormsCond.
+				 */
+				template<typename ComplexType>
+				SuccessCode EvalRHSSparse(System const& S,
+									const Vec<ComplexType>& space, const ComplexType& time, Mat<ComplexType> & K, unsigned stage)
+				{
+					SparseJacobianLU<ComplexType>& LU = std::get< SparseJacobianLU<ComplexType> >(sparse_LU_);
+					auto& counts = CountsAt<ComplexType>();
+
+					S.SetAndReset<ComplexType>(space, time);
+					if (!LU.IsAnalyzed())
+						LU.Analyze(S.JacobianSparsity());
+					S.SparseJacobianInPlace(LU.Matrix());
+					++counts.jacobian_evaluations;
+					++counts.lu_factorizations;
+
+					if (!LU.Factorize())
+						return stage==0 ? SuccessCode::MatrixSolveFailureFirstPartOfPrediction : SuccessCode::MatrixSolveFailure;
+
+					if (stage==0)
+						SparseNorms<ComplexType>();
+
+					Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
+					S.TimeDerivativeInPlace(dhdtref);
+					++counts.time_derivative_evaluations;
+					K.col(stage) = LU.Solve(dhdtref);
+					K.col(stage) = -K.col(stage);
+
+					return SuccessCode::Success;
+				}
+
+
+				/**
+				 \brief Compute the norms of the Jacobian and its inverse from the stage 0 sparse factorization, for SetNormsCond.
+				 */
+				template<typename ComplexType>
+				void SparseNorms()
+				{
+					SparseJacobianLU<ComplexType>& LU = std::get< SparseJacobianLU<ComplexType> >(sparse_LU_);
+					Vec<ComplexType>& temp_soln = std::get< Vec<ComplexType> >(norm_temp_);
+
+					temp_soln = LU.Solve(std::get< Vec<ComplexType> >(random_units_));
+					sparse_norm_J_ = NumErrorT(LU.Matrix().norm());
+					sparse_norm_J_inverse_ = NumErrorT(temp_soln.norm());
+				}
+
+
 				/**
 				 \brief Evaluates the RHS of the Davidenko differential equation at a particular time and space
 				 
@@ -848,6 +1010,9 @@ namespace bertini{
 					if (std::is_same<ComplexType, mpfr_complex>::value)
 						PrecisionSanityCheck();
 
+					if (sparse_jacobian_)
+						return EvalRHSSparse(S, space, time, K, stage);
+
 					if(stage == 0)
 					{
 						Eigen::PartialPivLU<Mat<ComplexType>>& LUref = GetLU<ComplexType>();
@@ -862,9 +1027,12 @@ namespace bertini{
 							assert(Precision(dhdxref)==current_precision_);
 							assert(Precision(K)==current_precision_);
 						}
+						auto& counts = CountsAt<ComplexType>();
 						S.SetAndReset<ComplexType>(space, time);
 						S.JacobianInPlace(dhdxref);
-						LUref = dhdxref.lu();
+						LUref.compute(dhdxref);
+						++counts.jacobian_evaluations;
+						++counts.lu_factorizations;
 						if (!std::is_same<ComplexType,dbl>::value)
 						{
 							assert(Precision(dhdxref)==current_precision_);
@@ -876,25 +1044,33 @@ namespace bertini{
 						
 						Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
 						S.TimeDerivativeInPlace(dhdtref);
-						K.col(stage) = LUref.solve(-dhdtref);
+						++counts.time_derivative_evaluations;
+						K.col(stage) = LUref.solve(dhdtref);
+						K.col(stage) = -K.col(stage);
 						
 						return SuccessCode::Success;
 						
 					}
 					else
 					{
+						auto& counts = CountsAt<ComplexType>();
 						S.SetAndReset<ComplexType>(space, time);
 
 						Mat<ComplexType>& dhdxtempref = std::get< Mat<ComplexType> >(dh_dx_temp_);
 						S.JacobianInPlace(dhdxtempref);
-						auto LU = dhdxtempref.lu();
+						Eigen::PartialPivLU<Mat<ComplexType>>& LU = GetLUTemp<ComplexType>();
+						LU.compute(dhdxtempref);
+						++counts.jacobian_evaluations;
+						++counts.lu_factorizations;
 						
 						if (LUPartialPivotDecompositionSuccessful(LU.matrixLU())!=MatrixSuccessCode::Success)
 							return SuccessCode::MatrixSolveFailure;
 						
 						Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
 						S.TimeDerivativeInPlace(dhdtref);
-						K.col(stage) = LU.solve(-dhdtref);
+						++counts.time_derivative_evaluations;
+						K.col(stage) = LU.solve(dhdtref);
+						K.col(stage) = -K.col(stage);
 						
 						return SuccessCode::Success;
 					}
@@ -1036,6 +1212,20 @@ namespace bertini{
 
 				mutable Eigen::PartialPivLU<Mat<dbl>> LU_d_;
 				mutable std::map<unsigned,Eigen::PartialPivLU<Mat<mpfr_complex>>> LU_mp_;
+				mutable Eigen::PartialPivLU<Mat<dbl>> LU_temp_d_; // LU for the stages after the first, reused across steps
+				mutable std::map<unsigned,Eigen::PartialPivLU<Mat<mpfr_complex>>> LU_temp_mp_;
+
+				bool sparse_jacobian_ = false; // Whether to evaluate and factor the Jacobian sparsely
+				mutable std::tuple< SparseJacobianLU<dbl>, SparseJacobianLU<mpfr_complex> > sparse_LU_; // The Jacobian of each stage and its LU factorization, stored sparsely
+				NumErrorT sparse_norm_J_ = 0; // Norms of the stage 0 Jacobian and its inverse, computed before the later stages refactor
+				NumErrorT sparse_norm_J_inverse_ = 0;
+
+				// workspace for a step, sized in ChangeSystem and set to the working precision in ChangePrecision, so that steps don't allocate vectors
+				mutable std::tuple< Vec<dbl>, Vec<mpfr_complex> > stage_temp_;  // Linear combinations of the stage variables
+				mutable std::tuple< Vec<dbl>, Vec<mpfr_complex> > stage_space_;  // Space point at which a stage is evaluated
+				mutable std::tuple< dbl, mpfr_complex > stage_time_;  // Time at which a stage is evaluated
+				mutable std::tuple< Vec<dbl>, Vec<mpfr_complex> > random_units_;  // Right hand side for estimating the norm of the inverse of the Jacobian
+				mutable std::tuple< Vec<dbl>, Vec<mpfr_complex> > norm_temp_;  // Solution for estimating the norm of the inverse of the Jacobian
 				
 				
 				// Butcher Table (notation from https://en.wikipedia.org/wiki/List_of_Runge%E2%80%93Kutta_methods )
@@ -1047,6 +1237,8 @@ namespace bertini{
 				
 				mutable bool uses_embedded_;
 				mutable unsigned current_precision_;
+
+				TrackingCounts counts_; ///< evaluations and factorizations, by precision.
 				
 				
 				
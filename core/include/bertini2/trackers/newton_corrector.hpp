@@ -9,9 +9,13 @@
 #ifndef BERTINI_NEWTON_CORRECTOR_HPP
 #define BERTINI_NEWTON_CORRECTOR_HPP
 
+#include <limits>
+
 #include "bertini2/trackers/amp_criteria.hpp"
 #include "bertini2/trackers/config.hpp"
+#include "bertini2/trackers/counts.hpp"
 #include "bertini2/system/system.hpp"
+#include "bertini2/system/sparse_jacobian.hpp"
 
 
 namespace bertini{
@@ -84,8 +88,11 @@ namespace bertini{
 					Precision(std::get< Vec<mpfr_complex> >(f_temp_), new_precision);
 					Precision(std::get< Vec<mpfr_complex> >(step_temp_), new_precision);
 					Precision(std::get< Mat<mpfr_complex> >(J_temp_), new_precision);
+					Precision(std::get< Vec<mpfr_complex> >(random_units_), new_precision);
+					Precision(std::get< Vec<mpfr_complex> >(norm_temp_), new_precision);
 
 					std::get< Eigen::PartialPivLU<Mat<mpfr_complex>> >(LU_) = Eigen::PartialPivLU<Mat<mpfr_complex>>(numTotalFunctions_);
+					std::get< SparseJacobianLU<mpfr_complex> >(sparse_LU_).Precision(new_precision);
 
 					current_precision_ = new_precision;				
 				}
@@ -95,6 +102,21 @@ namespace bertini{
 				{
 					return current_precision_;
 				}
+
+				/**
+				\brief The evaluations and factorizations made while correcting, by precision, since the counts were last reset.
+
+				With mixed precision correcting, factorizations of the Jacobian rounded to double are counted at double precision, and the evaluations at the working precision.
+				*/
+				TrackingCounts const& Counts() const
+				{
+					return counts_;
+				}
+
+				void ResetCounts()
+				{
+					counts_.Reset();
+				}
 				
 				/**
 				 \brief Change the system(number of total functions) that the predictor uses.
@@ -112,6 +134,22 @@ namespace bertini{
 					std::get< Vec<mpfr_complex> >(f_temp_).resize(numTotalFunctions_);
 					std::get< Vec<dbl> >(step_temp_).resize(numTotalFunctions_);
 					std::get< Vec<mpfr_complex> >(step_temp_).resize(numTotalFunctions_);
+					std::get< Vec<dbl> >(norm_temp_).resize(numVariables_);
+					std::get< Vec<mpfr_complex> >(norm_temp_).resize(numVariables_);
+
+					// drawn once per system, rather than every iteration, for estimating the norm of the inverse of the Jacobian.  kept for a system of the same size, so that copies of a tracker, made to track on clones of its system on other threads, estimate as the original does, and draw nothing from the shared generators
+					if (std::get< Vec<dbl> >(random_units_).size()!=numVariables_)
+					{
+						std::get< Vec<dbl> >(random_units_) = RandomOfUnits<dbl>(numVariables_);
+						std::get< Vec<mpfr_complex> >(random_units_) = RandomOfUnits<mpfr_complex>(numVariables_);
+					}
+
+					std::get< Eigen::PartialPivLU<Mat<dbl>> >(LU_) = Eigen::PartialPivLU<Mat<dbl>>(numTotalFunctions_);
+					std::get< Eigen::PartialPivLU<Mat<mpfr_complex>> >(LU_) = Eigen::PartialPivLU<Mat<mpfr_complex>>(numTotalFunctions_);
+
+					// the pattern of the Jacobian is analyzed again when next used
+					std::get< SparseJacobianLU<dbl> >(sparse_LU_).Forget();
+					std::get< SparseJacobianLU<mpfr_complex> >(sparse_LU_).Forget();
 				}
 
 				
@@ -210,25 +248,29 @@ namespace bertini{
 
 					Vec<ComplexType>& step_ref = std::get< Vec<ComplexType> >(step_temp_);
 					
+					bool refactor = true;
+					NumErrorT previous_norm_delta_z = std::numeric_limits<NumErrorT>::infinity();
+
 					next_space = current_space;
 					for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
 					{
 						//Update the newton iterate by one iteration
-						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time);
+						auto success_code = EvalRefinementStep(step_ref, S, next_space, current_time, refactor, AMP_config);
 						if(success_code != SuccessCode::Success)
 							return success_code;
 						
 						next_space += step_ref;
 						
-						Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
-						Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
-						
-						if ( (step_ref.template lpNorm<Eigen::Infinity>() < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
+						NumErrorT norm_delta_z(step_ref.template lpNorm<Eigen::Infinity>());
+						if ( (norm_delta_z < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
 							return SuccessCode::Success;
+
+						refactor = !Contracting(norm_delta_z, previous_norm_delta_z);
+						previous_norm_delta_z = norm_delta_z;
 						
-						NumErrorT norm_J_inverse(LU_ref.solve(RandomOfUnits<ComplexType>(S.NumVariables())).norm());
+						NumErrorT norm_J_inverse = NormJInverseEstimate<ComplexType>();
 
-						if (!amp::CriterionB<ComplexType>(NumErrorT(J_temp_ref.norm()), norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, NumErrorT(step_ref.template lpNorm<Eigen::Infinity>()), AMP_config))
+						if (!amp::CriterionB<ComplexType>(JacobianNorm<ComplexType>(), norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, norm_delta_z, AMP_config))
 							return SuccessCode::HigherPrecisionNecessary;
 						
 						if (!amp::CriterionC<ComplexType>(norm_J_inverse, next_space, tracking_tolerance, AMP_config))
@@ -285,23 +327,24 @@ namespace bertini{
 					
 					Vec<ComplexType>& step_ref = std::get< Vec<ComplexType> >(step_temp_);
 					
+					bool refactor = true;
+					NumErrorT previous_norm_delta_z = std::numeric_limits<NumErrorT>::infinity();
+
 					next_space = current_space;
 					for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
 					{
 						//Update the newton iterate by one iteration
-						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time);
+						auto success_code = EvalRefinementStep(step_ref, S, next_space, current_time, refactor, AMP_config);
 						if(success_code != SuccessCode::Success)
 							return success_code;
 						
 						next_space += step_ref;
 						
-						Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
-						Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
-						
-						
 						norm_delta_z = NumErrorT(step_ref.template lpNorm<Eigen::Infinity>());
-						norm_J = NumErrorT(J_temp_ref.norm());
-						norm_J_inverse = NumErrorT(LU_ref.solve(RandomOfUnits<ComplexType>(S.NumVariables())).norm());
+						refactor = !Contracting(norm_delta_z, previous_norm_delta_z);
+						previous_norm_delta_z = norm_delta_z;
+						norm_J = JacobianNorm<ComplexType>();
+						norm_J_inverse = NormJInverseEstimate<ComplexType>();
 						condition_number_estimate = NumErrorT(norm_J*norm_J_inverse);
 												
 						if ( (norm_delta_z < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
@@ -325,6 +368,17 @@ namespace bertini{
 				// Private Data Methods
 				//
 				////////////////////
+
+
+				/**
+				\brief The counts for the precision of a computation in ComplexType.
+				*/
+				template <typename ComplexType>
+				PrecisionCounts& CountsAt()
+				{
+					return counts_.At(std::is_same<ComplexType,dbl>::value ? DoublePrecision() : current_precision_);
+				}
+
 				
 				
 				/**
@@ -343,23 +397,244 @@ namespace bertini{
 											  const Eigen::MatrixBase<Derived>& current_space, const ComplexType& current_time)
 				{
 					Vec<ComplexType>& f_temp_ref = std::get< Vec<ComplexType> >(f_temp_);
-					Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
-					
-					Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
 
 					S.SetAndReset<ComplexType>(current_space, current_time);
 					S.EvalInPlace(f_temp_ref);
-					S.JacobianInPlace(J_temp_ref);
-					LU_ref = J_temp_ref.lu();
+					EvalJacobian<ComplexType>(S);
+					factored_in_double_ = false;
+
+					auto& counts = CountsAt<ComplexType>();
+					++counts.function_evaluations;
+					++counts.jacobian_evaluations;
+					++counts.lu_factorizations;
 					
-					if (LUPartialPivotDecompositionSuccessful(LU_ref.matrixLU())!=MatrixSuccessCode::Success)
+					if (!FactorJacobian<ComplexType>())
 						return SuccessCode::MatrixSolveFailure;
 					
-					newton_step = LU_ref.solve(-f_temp_ref);
+					newton_step = SolveJacobian<ComplexType>(f_temp_ref);
+					newton_step = -newton_step;
 					
 					return SuccessCode::Success;
 					
 				}
+
+
+				/**
+				 \brief Compute a Newton step for adaptive precision correcting, in double precision.  There is nothing to mix, so this is a plain Newton step.
+				 */
+				SuccessCode EvalRefinementStep(Vec<dbl> & newton_step,
+											  const System& S,
+											  Vec<dbl> const& current_space, dbl const& current_time,
+											  bool refactor, AdaptiveMultiplePrecisionConfig const& AMP_config)
+				{
+					return EvalIterationStep(newton_step, S, current_space, current_time);
+				}
+
+
+				/**
+				 \brief Compute a Newton step for adaptive precision correcting, in multiple precision.
+
+				 Unless mixed precision is turned on in the NewtonConfig, this is a plain Newton step, factoring the Jacobian in the working precision.
+
+				 With mixed precision, this is a step of iterative refinement: the residual is computed in the working precision, and solved for with a factorization of the Jacobian in double precision.  The factorization is made when asked to refactor, and is otherwise reused from the previous step, so later steps evaluate only the functions.  Each step gains about as many digits as double precision has, less the log of the condition number, so if AMP Criterion A says that is too few, the Jacobian is factored in the working precision instead.
+
+				 \param newton_step The computed step.
+				 \param S The system being corrected on.
+				 \param current_space The current Newton iterate.
+				 \param current_time The current time.
+				 \param refactor Whether to factor the Jacobian afresh at this iterate.  The factorization from the previous step is reused otherwise, if it was made in double precision.
+				 \param AMP_config The settings for adaptive multiple precision.
+				 */
+				SuccessCode EvalRefinementStep(Vec<mpfr_complex> & newton_step,
+											  const System& S,
+											  Vec<mpfr_complex> const& current_space, mpfr_complex const& current_time,
+											  bool refactor, AdaptiveMultiplePrecisionConfig const& AMP_config)
+				{
+					if (!newton_config_.mixed_precision || (!refactor && !factored_in_double_))
+						return EvalIterationStep(newton_step, S, current_space, current_time);
+
+					Vec<mpfr_complex>& f_temp_ref = std::get< Vec<mpfr_complex> >(f_temp_);
+					Vec<dbl>& f_double = std::get< Vec<dbl> >(f_temp_);
+					Vec<dbl>& step_double = std::get< Vec<dbl> >(step_temp_);
+
+					S.SetAndReset<mpfr_complex>(current_space, current_time);
+					S.EvalInPlace(f_temp_ref);
+					++CountsAt<mpfr_complex>().function_evaluations;
+
+					if (refactor)
+					{
+						EvalJacobian<mpfr_complex>(S);
+						RoundJacobianToDouble(S);
+
+						++CountsAt<mpfr_complex>().jacobian_evaluations;
+						++CountsAt<dbl>().lu_factorizations;
+						factored_in_double_ = FactorJacobian<dbl>()
+						                      && amp::CriterionA<dbl>(JacobianNorm<dbl>(), NormJInverseEstimateFrom<dbl>(), AMP_config);
+
+						if (!factored_in_double_)
+						{
+							// double precision isn't enough for this Jacobian, so factor the one already evaluated in the working precision
+							++CountsAt<mpfr_complex>().lu_factorizations;
+							if (!FactorJacobian<mpfr_complex>())
+								return SuccessCode::MatrixSolveFailure;
+
+							newton_step = SolveJacobian<mpfr_complex>(f_temp_ref);
+							newton_step = -newton_step;
+							return SuccessCode::Success;
+						}
+					}
+
+					// the residual is scaled before rounding to double, so a tiny one doesn't underflow
+					mpfr_float scale = f_temp_ref.template lpNorm<Eigen::Infinity>();
+					if (scale==0)
+					{
+						newton_step.setZero();
+						return SuccessCode::Success;
+					}
+
+					mpfr_complex scaled;
+					for (int ii = 0; ii < f_temp_ref.size(); ++ii)
+					{
+						scaled = f_temp_ref(ii);
+						scaled /= scale;
+						f_double(ii) = static_cast<dbl>(scaled);
+					}
+
+					step_double = SolveJacobian<dbl>(f_double);
+
+					scale = -scale;
+					for (int ii = 0; ii < step_double.size(); ++ii)
+					{
+						newton_step(ii) = mpfr_complex(step_double(ii).real(), step_double(ii).imag());
+						newton_step(ii) *= scale;
+					}
+
+					return SuccessCode::Success;
+				}
+
+
+				/**
+				 \brief Evaluate the Jacobian of the system at the point it was last set to, into the dense matrix, or, when correcting with sparse Jacobians, into the matrix of the sparse factorization.
+
+				 The pattern of the sparse Jacobian is analyzed the first time it is evaluated for a system, and then reused for every factorization.  Systems evaluating with a straight-line program or polynomial system evaluate the Jacobian whole, so for them it is evaluated and factored densely, whatever the settings.
+				 */
+				template<typename ComplexType>
+				void EvalJacobian(const System& S)
+				{
+					sparse_jacobian_ = newton_config_.sparse_jacobian && S.EvaluatesJacobianSparsely();
+					if (sparse_jacobian_)
+					{
+						SparseJacobianLU<ComplexType>& sparse_LU_ref = std::get< SparseJacobianLU<ComplexType> >(sparse_LU_);
+						if (!sparse_LU_ref.IsAnalyzed())
+							sparse_LU_ref.Analyze(S.JacobianSparsity());
+						S.SparseJacobianInPlace(sparse_LU_ref.Matrix());
+					}
+					else
+						S.JacobianInPlace(std::get< Mat<ComplexType> >(J_temp_));
+				}
+
+
+				/**
+				 \brief Round the Jacobian last evaluated in multiple precision to double precision, for mixed precision correcting.
+				 */
+				void RoundJacobianToDouble(const System& S)
+				{
+					if (sparse_jacobian_)
+					{
+						SparseJacobianLU<dbl>& sparse_LU_double = std::get< SparseJacobianLU<dbl> >(sparse_LU_);
+						if (!sparse_LU_double.IsAnalyzed())
+							sparse_LU_double.Analyze(S.JacobianSparsity());
+
+						// both matrices have the pattern of the Jacobian, so their values are in the same order
+						const auto& J_temp_ref = std::get< SparseJacobianLU<mpfr_complex> >(sparse_LU_).Matrix();
+						auto& J_double = sparse_LU_double.Matrix();
+						for (int kk = 0; kk < J_temp_ref.nonZeros(); ++kk)
+							J_double.valuePtr()[kk] = static_cast<dbl>(J_temp_ref.valuePtr()[kk]);
+						return;
+					}
+
+					Mat<mpfr_complex>& J_temp_ref = std::get< Mat<mpfr_complex> >(J_temp_);
+					Mat<dbl>& J_double = std::get< Mat<dbl> >(J_temp_);
+					for (int jj = 0; jj < J_temp_ref.cols(); ++jj)
+						for (int ii = 0; ii < J_temp_ref.rows(); ++ii)
+							J_double(ii,jj) = static_cast<dbl>(J_temp_ref(ii,jj));
+				}
+
+
+				/**
+				 \brief Factor the Jacobian last evaluated in a precision.
+
+				 \return Whether the factorization succeeded.
+				 */
+				template<typename ComplexType>
+				bool FactorJacobian()
+				{
+					if (sparse_jacobian_)
+						return std::get< SparseJacobianLU<ComplexType> >(sparse_LU_).Factorize();
+
+					Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
+					LU_ref.compute(std::get< Mat<ComplexType> >(J_temp_));
+					return LUPartialPivotDecompositionSuccessful(LU_ref.matrixLU())==MatrixSuccessCode::Success;
+				}
+
+
+				/**
+				 \brief Solve against the latest factorization of the Jacobian in a precision.
+				 */
+				template<typename ComplexType>
+				Vec<ComplexType> SolveJacobian(Vec<ComplexType> const& b)
+				{
+					if (sparse_jacobian_)
+						return std::get< SparseJacobianLU<ComplexType> >(sparse_LU_).Solve(b);
+					return std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_).solve(b);
+				}
+
+
+				/**
+				 \brief The norm of the Jacobian last evaluated in a precision.
+				 */
+				template<typename ComplexType>
+				NumErrorT JacobianNorm()
+				{
+					if (sparse_jacobian_)
+						return NumErrorT(std::get< SparseJacobianLU<ComplexType> >(sparse_LU_).Matrix().norm());
+					return NumErrorT(std::get< Mat<ComplexType> >(J_temp_).norm());
+				}
+
+
+				/**
+				 \brief Whether the Newton steps are shrinking fast enough to keep reusing a factorization of the Jacobian made at an earlier iterate.
+				 */
+				static
+				bool Contracting(NumErrorT const& norm_delta_z, NumErrorT const& previous_norm_delta_z)
+				{
+					return norm_delta_z <= previous_norm_delta_z/2;
+				}
+
+
+				/**
+				 \brief Estimate the norm of the inverse of the Jacobian at the last Newton iterate, from its LU factorization, by solving against the random vector of units kept for the purpose.
+				 */
+				template<typename ComplexType>
+				NumErrorT NormJInverseEstimate()
+				{
+					if (factored_in_double_)
+						return NormJInverseEstimateFrom<dbl>();
+					return NormJInverseEstimateFrom<ComplexType>();
+				}
+
+
+				/**
+				 \brief Estimate the norm of the inverse of the Jacobian from its factorization in a particular precision.
+				 */
+				template<typename ComplexType>
+				NumErrorT NormJInverseEstimateFrom()
+				{
+					Vec<ComplexType>& norm_temp_ref = std::get< Vec<ComplexType> >(norm_temp_);
+
+					norm_temp_ref = SolveJacobian<ComplexType>(std::get< Vec<ComplexType> >(random_units_));
+					return NumErrorT(norm_temp_ref.norm());
+				}
 				
 
 				
@@ -375,13 +650,20 @@ namespace bertini{
 				std::tuple< Vec<dbl>, Vec<mpfr_complex> > f_temp_; // Variable to hold temporary evaluation of the system
 				std::tuple< Vec<dbl>, Vec<mpfr_complex> > step_temp_; // Variable to hold temporary evaluation of the newton step
 				std::tuple< Mat<dbl>, Mat<mpfr_complex> > J_temp_; // Variable to hold temporary evaluation of the Jacobian
+				std::tuple< Vec<dbl>, Vec<mpfr_complex> > random_units_; // Right hand side for estimating the norm of the inverse of the Jacobian, drawn once per system
+				std::tuple< Vec<dbl>, Vec<mpfr_complex> > norm_temp_; // Variable to hold the solution for estimating the norm of the inverse of the Jacobian
 				
 				std::tuple< Eigen::PartialPivLU<Mat<dbl>>, Eigen::PartialPivLU<Mat<mpfr_complex>> > LU_; // The LU factorization from the Newton iterates
+				std::tuple< SparseJacobianLU<dbl>, SparseJacobianLU<mpfr_complex> > sparse_LU_; // The Jacobian and its LU factorization, stored sparsely, when correcting with sparse Jacobians
 				
 				unsigned current_precision_;
+				bool factored_in_double_ = false; // Whether the latest factorization of the Jacobian is the one in double precision, for mixed precision correcting
+				bool sparse_jacobian_ = false; // Whether the Jacobian last evaluated is stored sparsely, in sparse_LU_, which it is when correcting with sparse Jacobians and the system evaluates them entry by entry
 
 				NewtonConfig newton_config_; // Hold the settings of the Newton iteration
 
+				TrackingCounts counts_; // Evaluations and factorizations, by precision
+
 				
 			}; //re: class NewtonCorrector
 			
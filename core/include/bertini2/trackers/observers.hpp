@@ -52,12 +52,12 @@ namespace bertini {
 
 			virtual void Observe(AnyEvent const& e) override
 			{
-				if(auto p = dynamic_cast<const TrackingStarted<EmitterT>*>(&e))
+				if(auto p = EventCast<TrackingStarted<EmitterT>>(e))
 				{
 					precision_increased_ = false;
 					starting_precision_ = p->Get().CurrentPrecision();
 				}
-				else if (auto p = dynamic_cast<const PrecisionChanged<EmitterT>*>(&e))
+				else if (auto p = EventCast<PrecisionChanged<EmitterT>>(e))
 				{
 					auto& t = p->Get();
 					auto next = p->Next();
@@ -72,6 +72,11 @@ namespace bertini {
 				}
 			}
 
+			detail::EventMask Subscriptions() const override
+			{
+				return detail::EventTypeBits<TrackingStarted<EmitterT>, PrecisionChanged<EmitterT>>();
+			}
+
 
 
 
@@ -116,7 +121,7 @@ namespace bertini {
 
 			virtual void Observe(AnyEvent const& e) override
 			{
-				if (auto p = dynamic_cast<const PrecisionChanged<EmitterT>*>(&e))
+				if (auto p = EventCast<PrecisionChanged<EmitterT>>(e))
 				{
 					auto next_precision = p->Next();
 					if (next_precision < min_precision_)
@@ -124,13 +129,18 @@ namespace bertini {
 					if (next_precision > max_precision_)
 						max_precision_ = next_precision;
 				}
-				else if(auto p = dynamic_cast<const TrackingStarted<EmitterT>*>(&e))
+				else if(auto p = EventCast<TrackingStarted<EmitterT>>(e))
 				{
 					min_precision_ = p->Get().CurrentPrecision();
 					max_precision_ = p->Get().CurrentPrecision();
 				}
 			}
 
+			detail::EventMask Subscriptions() const override
+			{
+				return detail::EventTypeBits<TrackingStarted<EmitterT>, PrecisionChanged<EmitterT>>();
+			}
+
 
 
 
@@ -169,13 +179,18 @@ namespace bertini {
 
 			virtual void Observe(AnyEvent const& e) override
 			{
-				const TrackingEvent<EmitterT>* p = dynamic_cast<const TrackingEvent<EmitterT>*>(&e);
+				const TrackingEvent<EmitterT>* p = EventCast<TrackingEvent<EmitterT>>(e);
 				if (p)
 				{
 					precisions_.push_back(p->Get().CurrentPrecision());
 				}
 			}
 
+			detail::EventMask Subscriptions() const override
+			{
+				return detail::EventTypeBits<TrackingEvent<EmitterT>>();
+			}
+
 
 		public:
 			const std::vector<unsigned>& Precisions() const
@@ -201,13 +216,18 @@ namespace bertini {
 
 			virtual void Observe(AnyEvent const& e) override
 			{
-				const EventT<EmitterT>* p = dynamic_cast<const EventT<EmitterT>*>(&e);
+				const EventT<EmitterT>* p = EventCast<EventT<EmitterT>>(e);
 				if (p)
 				{
 					path_.push_back(p->Get().CurrentPoint());
 				}
 			}
 
+			detail::EventMask Subscriptions() const override
+			{
+				return detail::EventTypeBits<EventT<EmitterT>>();
+			}
+
 
 		public:
 			const std::vector<Vec<mpfr_complex> >& Path() const
@@ -236,7 +256,7 @@ namespace bertini {
 			{
 
 
-				if (auto p = dynamic_cast<const Initializing<EmitterT,dbl>*>(&e))
+				if (auto p = EventCast<Initializing<EmitterT,dbl>>(e))
 				{
 					BOOST_LOG_TRIVIAL(severity_level::debug) << std::setprecision(p->Get().GetSystem().precision())
 						<< "initializing in double, tracking path\nfrom\tt = "
@@ -244,17 +264,17 @@ namespace bertini {
 						<< "\n from\tx = \n" << p->StartPoint()
 						<< "\n tracking system " << p->Get().GetSystem() << "\n\n";
 				}
-				else if (auto p = dynamic_cast<const Initializing<EmitterT,mpfr_complex>*>(&e))
+				else if (auto p = EventCast<Initializing<EmitterT,mpfr_complex>>(e))
 				{
 					BOOST_LOG_TRIVIAL(severity_level::debug) << std::setprecision(p->Get().GetSystem().precision())
 						 << "initializing in multiprecision, tracking path\nfrom\tt = " << p->StartTime() << "\nto\tt = " << p->EndTime() << "\n from\tx = \n" << p->StartPoint()
 						<< "\n tracking system " << p->Get().GetSystem() << "\n\n";
 				}
 
-				else if(auto p = dynamic_cast<const TrackingEnded<EmitterT>*>(&e))
+				else if(auto p = EventCast<TrackingEnded<EmitterT>>(e))
 					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracking ended";
 
-				else if (auto p = dynamic_cast<const NewStep<EmitterT>*>(&e))
+				else if (auto p = EventCast<NewStep<EmitterT>>(e))
 				{
 					auto& t = p->Get();
 					BOOST_LOG_TRIVIAL(severity_level::trace) << "Tracker iteration " << t.NumTotalStepsTaken() << "\ncurrent precision: " << t.CurrentPrecision();
@@ -270,20 +290,20 @@ namespace bertini {
 
 
 
-				else if (auto p = dynamic_cast<const SingularStartPoint<EmitterT>*>(&e))
+				else if (auto p = EventCast<SingularStartPoint<EmitterT>>(e))
 					BOOST_LOG_TRIVIAL(severity_level::trace) << "singular start point";
-				else if (auto p = dynamic_cast<const InfinitePathTruncation<EmitterT>*>(&e))
+				else if (auto p = EventCast<InfinitePathTruncation<EmitterT>>(e))
 					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracker iteration indicated going to infinity, truncated path";
 
 
 
 
-				else if (auto p = dynamic_cast<const SuccessfulStep<EmitterT>*>(&e))
+				else if (auto p = EventCast<SuccessfulStep<EmitterT>>(e))
 				{
 					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracker iteration successful\n\n\n";
 				}
 
-				else if (auto p = dynamic_cast<const FailedStep<EmitterT>*>(&e))
+				else if (auto p = EventCast<FailedStep<EmitterT>>(e))
 				{
 					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracker iteration unsuccessful\n\n\n";
 				}
@@ -293,41 +313,41 @@ namespace bertini {
 
 
 
-				else if (auto p = dynamic_cast<const SuccessfulPredict<EmitterT,mpfr_complex>*>(&e))
+				else if (auto p = EventCast<SuccessfulPredict<EmitterT,mpfr_complex>>(e))
 				{
 					BOOST_LOG_TRIVIAL(severity_level::trace) << std::setprecision(Precision(p->ResultingPoint())) << "prediction successful (mpfr_complex), result:\n" << p->ResultingPoint();
 				}
-				else if (auto p = dynamic_cast<const SuccessfulPredict<EmitterT,dbl>*>(&e))
+				else if (auto p = EventCast<SuccessfulPredict<EmitterT,dbl>>(e))
 				{
 					BOOST_LOG_TRIVIAL(severity_level::trace) << std::setprecision(Precision(p->ResultingPoint())) << "prediction successful (dbl), result:\n" << p->ResultingPoint();
 				}
 
-				else if (auto p = dynamic_cast<const SuccessfulCorrect<EmitterT,mpfr_complex>*>(&e))
+				else if (auto p = EventCast<SuccessfulCorrect<EmitterT,mpfr_complex>>(e))
 				{
 					BOOST_LOG_TRIVIAL(severity_level::trace) << std::setprecision(Precision(p->ResultingPoint())) << "correction successful (mpfr_complex), result:\n" << p->ResultingPoint();
 				}
-				else if (auto p = dynamic_cast<const SuccessfulCorrect<EmitterT,dbl>*>(&e))
+				else if (auto p = EventCast<SuccessfulCorrect<EmitterT,dbl>>(e))
 				{
 					BOOST_LOG_TRIVIAL(severity_level::trace) << std::setprecision(Precision(p->ResultingPoint())) << "correction successful (dbl), result:\n" << p->ResultingPoint();
 				}
 
 
-				else if (auto p = dynamic_cast<const PredictorHigherPrecisionNecessary<EmitterT>*>(&e))
+				else if (auto p = EventCast<PredictorHigherPrecisionNecessary<EmitterT>>(e))
 					BOOST_LOG_TRIVIAL(severity_level::trace) << "Predictor, higher precision necessary";
-				else if (auto p = dynamic_cast<const CorrectorHigherPrecisionNecessary<EmitterT>*>(&e))
+				else if (auto p = EventCast<CorrectorHigherPrecisionNecessary<EmitterT>>(e))
 					BOOST_LOG_TRIVIAL(severity_level::trace) << "corrector, higher precision necessary";
 
 
 
-				else if (auto p = dynamic_cast<const CorrectorMatrixSolveFailure<EmitterT>*>(&e))
+				else if (auto p = EventCast<CorrectorMatrixSolveFailure<EmitterT>>(e))
 					BOOST_LOG_TRIVIAL(severity_level::trace) << "corrector, matrix solve failure or failure to converge";
-				else if (auto p = dynamic_cast<const PredictorMatrixSolveFailure<EmitterT>*>(&e))
+				else if (auto p = EventCast<PredictorMatrixSolveFailure<EmitterT>>(e))
 					BOOST_LOG_TRIVIAL(severity_level::trace) << "predictor, matrix solve failure or failure to converge";
-				else if (auto p = dynamic_cast<const FirstStepPredictorMatrixSolveFailure<EmitterT>*>(&e))
+				else if (auto p = EventCast<FirstStepPredictorMatrixSolveFailure<EmitterT>>(e))
 					BOOST_LOG_TRIVIAL(severity_level::trace) << "Predictor, matrix solve failure in initial solve of prediction";
 
 
-				else if (auto p = dynamic_cast<const PrecisionChanged<EmitterT>*>(&e))
+				else if (auto p = EventCast<PrecisionChanged<EmitterT>>(e))
 					BOOST_LOG_TRIVIAL(severity_level::debug) << "changing precision from " << p->Previous() << " to " << p->Next();
 
 				else
@@ -347,10 +367,15 @@ namespace bertini {
 
 			virtual void Observe(AnyEvent const& e) override
 			{
-				if (auto p = dynamic_cast<const FailedStep<EmitterT>*>(&e))
+				if (auto p = EventCast<FailedStep<EmitterT>>(e))
 					std::cout << "observed step failure" << std::endl;
 			}
 
+			detail::EventMask Subscriptions() const override
+			{
+				return detail::EventTypeBits<FailedStep<EmitterT>>();
+			}
+
 			virtual ~StepFailScreenPrinter() = default;
 		};
 
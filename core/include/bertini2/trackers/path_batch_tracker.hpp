@@ -0,0 +1,766 @@
+//This file is part of Bertini 2.
+//
+//path_batch_tracker.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//path_batch_tracker.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with path_batch_tracker.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+
+/**
+\file path_batch_tracker.hpp
+
+\brief Contains the PathBatchTracker type, for tracking many paths at once in double precision, and the BatchedLU it solves with.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "bertini2/trackers/amp_tracker.hpp"
+#include "bertini2/system/slp_batch.hpp"
+
+
+namespace bertini{
+
+	namespace tracking{
+
+
+		/**
+		\brief LU decompositions of a batch of square complex matrices, one per lane, in double precision.
+
+		The matrices are stored as structure of arrays, like the memory of an SLPBatch: for every entry, its real parts in all the lanes, one after the other, and likewise its imaginary parts.  The elimination is done for all lanes at once, so the innermost loops are over lanes, which the compiler vectorizes.  Only the choice of pivot, which differs from lane to lane, is done lane by lane.
+
+		A lane whose matrix is singular to working precision -- having a column with no nonzero candidate for the pivot -- is marked as such, and its factors are garbage but finite.  The other lanes are unaffected.
+
+		```
+		BatchedLU lu(n, num_lanes);
+		// fill lu.Real(i,j)[lane] and lu.Imag(i,j)[lane]
+		lu.Factor();
+		lu.Solve(b_re, b_im); // b_re[i*num_lanes + lane]
+		```
+		*/
+		class BatchedLU
+		{
+		public:
+
+			BatchedLU(unsigned size, unsigned num_lanes) :
+				size_(size),
+				num_lanes_(num_lanes),
+				real_(size_t(size)*size*num_lanes),
+				imag_(size_t(size)*size*num_lanes),
+				permutation_(size_t(size)*num_lanes),
+				singular_(num_lanes),
+				scratch_re_(size),
+				scratch_im_(size)
+			{}
+
+			unsigned Size() const
+			{
+				return size_;
+			}
+
+			unsigned NumLanes() const
+			{
+				return num_lanes_;
+			}
+
+			/**
+			\brief The real parts of entry (ii,jj) of the matrices, one per lane.  Overwritten by the factors.
+			*/
+			double* Real(unsigned ii, unsigned jj)
+			{
+				return real_.data() + (size_t(ii)*size_ + jj)*num_lanes_;
+			}
+
+			/**
+			\brief The imaginary parts of entry (ii,jj) of the matrices, one per lane.
+			*/
+			double* Imag(unsigned ii, unsigned jj)
+			{
+				return imag_.data() + (size_t(ii)*size_ + jj)*num_lanes_;
+			}
+
+			double const* Real(unsigned ii, unsigned jj) const
+			{
+				return real_.data() + (size_t(ii)*size_ + jj)*num_lanes_;
+			}
+
+			double const* Imag(unsigned ii, unsigned jj) const
+			{
+				return imag_.data() + (size_t(ii)*size_ + jj)*num_lanes_;
+			}
+
+
+			/**
+			\brief Factor the matrices in place, with partial pivoting.
+			*/
+			void Factor()
+			{
+				const unsigned n = size_, L = num_lanes_;
+
+				std::fill(singular_.begin(), singular_.end(), false);
+				for (unsigned ii = 0; ii < n; ++ii)
+					for (unsigned lane = 0; lane < L; ++lane)
+						permutation_[ii*L + lane] = ii;
+
+				for (unsigned kk = 0; kk < n; ++kk)
+				{
+					// choose the pivots, lane by lane, swapping it into row kk
+					for (unsigned lane = 0; lane < L; ++lane)
+					{
+						unsigned pivot_row = kk;
+						double biggest = SquaredMagnitude(kk, kk, lane);
+						for (unsigned ii = kk+1; ii < n; ++ii)
+						{
+							const double candidate = SquaredMagnitude(ii, kk, lane);
+							if (candidate > biggest)
+							{
+								biggest = candidate;
+								pivot_row = ii;
+							}
+						}
+
+						if (!(biggest > 0)) // also catches NaN
+						{
+							singular_[lane] = true;
+							Real(kk,kk)[lane] = 1;
+							Imag(kk,kk)[lane] = 0;
+							continue;
+						}
+
+						if (pivot_row != kk)
+						{
+							for (unsigned jj = 0; jj < n; ++jj)
+							{
+								std::swap(Real(kk,jj)[lane], Real(pivot_row,jj)[lane]);
+								std::swap(Imag(kk,jj)[lane], Imag(pivot_row,jj)[lane]);
+							}
+							std::swap(permutation_[kk*L + lane], permutation_[pivot_row*L + lane]);
+						}
+					}
+
+					// eliminate below the pivots, all lanes at once
+					double const* const p_re = Real(kk,kk);
+					double const* const p_im = Imag(kk,kk);
+					for (unsigned ii = kk+1; ii < n; ++ii)
+					{
+						double* const m_re = Real(ii,kk);
+						double* const m_im = Imag(ii,kk);
+
+						// the multiplier, stored where the eliminated entry was
+						BERTINI_INDEPENDENT_LANES
+						for (unsigned lane = 0; lane < L; ++lane)
+						{
+							const double pr = p_re[lane], pi = p_im[lane], ar = m_re[lane], ai = m_im[lane];
+							const double d = 1/(pr*pr + pi*pi);
+							m_re[lane] = (ar*pr + ai*pi)*d;
+							m_im[lane] = (ai*pr - ar*pi)*d;
+						}
+
+						for (unsigned jj = kk+1; jj < n; ++jj)
+						{
+							double const* const u_re = Real(kk,jj);
+							double const* const u_im = Imag(kk,jj);
+							double* const a_re = Real(ii,jj);
+							double* const a_im = Imag(ii,jj);
+
+							BERTINI_INDEPENDENT_LANES
+							for (unsigned lane = 0; lane < L; ++lane)
+							{
+								const double mr = m_re[lane], mi = m_im[lane], ur = u_re[lane], ui = u_im[lane];
+								a_re[lane] -= mr*ur - mi*ui;
+								a_im[lane] -= mr*ui + mi*ur;
+							}
+						}
+					}
+				}
+			}
+
+
+			/**
+			\brief Whether the matrix in a lane was found singular by the most recent Factor.
+			*/
+			bool IsSingular(unsigned lane) const
+			{
+				return singular_[lane];
+			}
+
+
+			/**
+			\brief Solve the factored systems in place, for one right hand side per lane.
+
+			\param b_re The real parts of the right hand sides, entry ii of lane `lane` at `b_re[ii*NumLanes() + lane]`.  Overwritten with the solutions.
+			\param b_im The imaginary parts, likewise.
+			*/
+			void Solve(double* b_re, double* b_im) const
+			{
+				const unsigned n = size_, L = num_lanes_;
+
+				// permute, lane by lane
+				for (unsigned lane = 0; lane < L; ++lane)
+				{
+					for (unsigned ii = 0; ii < n; ++ii)
+					{
+						const auto from = permutation_[ii*L + lane]*L + lane;
+						scratch_re_[ii] = b_re[from];
+						scratch_im_[ii] = b_im[from];
+					}
+					for (unsigned ii = 0; ii < n; ++ii)
+					{
+						b_re[ii*L + lane] = scratch_re_[ii];
+						b_im[ii*L + lane] = scratch_im_[ii];
+					}
+				}
+
+				// forward substitution, with the unit lower triangle
+				for (unsigned ii = 1; ii < n; ++ii)
+				{
+					double* const x_re = b_re + size_t(ii)*L;
+					double* const x_im = b_im + size_t(ii)*L;
+					for (unsigned jj = 0; jj < ii; ++jj)
+					{
+						double const* const l_re = Real(ii,jj);
+						double const* const l_im = Imag(ii,jj);
+						double const* const y_re = b_re + size_t(jj)*L;
+						double const* const y_im = b_im + size_t(jj)*L;
+
+						BERTINI_INDEPENDENT_LANES
+						for (unsigned lane = 0; lane < L; ++lane)
+						{
+							x_re[lane] -= l_re[lane]*y_re[lane] - l_im[lane]*y_im[lane];
+							x_im[lane] -= l_re[lane]*y_im[lane] + l_im[lane]*y_re[lane];
+						}
+					}
+				}
+
+				// back substitution, with the upper triangle
+				for (unsigned ii = n; ii-- > 0; )
+				{
+					double* const x_re = b_re + size_t(ii)*L;
+					double* const x_im = b_im + size_t(ii)*L;
+					for (unsigned jj = ii+1; jj < n; ++jj)
+					{
+						double const* const u_re = Real(ii,jj);
+						double const* const u_im = Imag(ii,jj);
+						double const* const y_re = b_re + size_t(jj)*L;
+						double const* const y_im = b_im + size_t(jj)*L;
+
+						BERTINI_INDEPENDENT_LANES
+						for (unsigned lane = 0; lane < L; ++lane)
+						{
+							x_re[lane] -= u_re[lane]*y_re[lane] - u_im[lane]*y_im[lane];
+							x_im[lane] -= u_re[lane]*y_im[lane] + u_im[lane]*y_re[lane];
+						}
+					}
+
+					double const* const p_re = Real(ii,ii);
+					double const* const p_im = Imag(ii,ii);
+					BERTINI_INDEPENDENT_LANES
+					for (unsigned lane = 0; lane < L; ++lane)
+					{
+						const double pr = p_re[lane], pi = p_im[lane], ar = x_re[lane], ai = x_im[lane];
+						const double d = 1/(pr*pr + pi*pi);
+						x_re[lane] = (ar*pr + ai*pi)*d;
+						x_im[lane] = (ai*pr - ar*pi)*d;
+					}
+				}
+			}
+
+		private:
+
+			double SquaredMagnitude(unsigned ii, unsigned jj, unsigned lane) const
+			{
+				const double r = Real(ii,jj)[lane], i = Imag(ii,jj)[lane];
+				return r*r + i*i;
+			}
+
+			unsigned size_;
+			unsigned num_lanes_;
+			std::vector<double, Eigen::aligned_allocator<double>> real_; ///< The real parts of the matrices, lane fastest.
+			std::vector<double, Eigen::aligned_allocator<double>> imag_; ///< The imaginary parts of the matrices, lane fastest.
+			std::vector<unsigned> permutation_; ///< Row ii of the factored matrix in a lane is row permutation_[ii*L + lane] of the original.
+			std::vector<bool> singular_;
+			mutable std::vector<double> scratch_re_, scratch_im_; ///< For permuting the right hand sides.
+		};
+
+
+
+
+		/**
+		\class PathBatchTracker
+
+		\brief Tracks many paths in lock-step, in double precision, handing the paths which need more to an AMPTracker.
+
+		## Explanation
+
+		Most paths of most homotopies are tracked entirely in double precision, and for those, the work of an AMPTracker is one small linear solve and a few evaluations of the system per step, each too short to make good use of a modern processor.  A PathBatchTracker instead advances a batch of paths together.  The system is evaluated at all of them at once with an SLPBatch, and the linear systems are solved at once with a BatchedLU, so the arithmetic of each step is loops over the paths of the batch, which vectorize.
+
+		Each path keeps its own time, stepsize, and step counts, and the paths take steps of their own sizes.  A path which finishes, successfully or not, is replaced in the batch by the next path yet to be tracked.
+
+		A path is ejected from the batch, and later tracked from where it was ejected by the AMPTracker the batch tracker was made from, when
+
+		* the precision criteria of adaptive multiple precision say double precision is not enough, or
+		* the Jacobian at the start of a step is singular to double precision, or
+		* its stepsize falls below the minimum.
+
+		An ejected path is finished by the AMPTracker under adaptive precision, with everything that entails, so the paths needing more than double precision are tracked exactly as the AMPTracker would track them from the point of ejection.
+
+		The paths tracked entirely in the batch are not tracked as the AMPTracker would track them, though.  The batch tracker predicts with Heun's method whatever the predictor of the AMPTracker, checks only criteria A and C of adaptive precision, having no error estimate from its predictor for criterion B, and adapts its stepsize by the success and fail factors of the stepping settings alone.  So the steps it takes differ from those of the AMPTracker, and what holds is that the endpoints of successful paths agree with those of the AMPTracker to within the tracking tolerance, not that they are the same.
+
+		The batch tracker takes everything from the AMPTracker: the system, which must be square and have a path variable, the tracking tolerance and path truncation threshold, and the stepping, Newton, and adaptive precision settings.  It predicts with Heun's method, and corrects with Newton's method.
+
+		## Example Usage
+
+		```
+		AMPTracker tracker(homotopy);
+		tracker.Setup(Predictor::HeunEuler, 1e-5, 1e5, stepping_settings, newton_settings);
+		tracker.PrecisionSetup(AMP);
+
+		PathBatchTracker batch_tracker(tracker, 32);
+
+		std::vector<Vec<mpfr_complex>> solutions;
+		auto codes = batch_tracker.TrackPaths(solutions, dbl(1), dbl(0), start_points);
+		```
+		*/
+		class PathBatchTracker
+		{
+		public:
+
+			/**
+			\brief Make a batch tracker from an AMPTracker, which it takes its settings from, and uses for the paths needing more than double precision.
+
+			The AMPTracker must outlive the batch tracker.
+
+			\param fallback The tracker to take the settings from, and to track ejected paths with.
+			\param batch_size The number of paths to advance together.
+			*/
+			PathBatchTracker(AMPTracker const& fallback, unsigned batch_size = 32) :
+				fallback_(fallback),
+				batch_size_(batch_size)
+			{
+				if (batch_size==0)
+					throw std::runtime_error("batch size of a path batch tracker must be positive");
+			}
+
+
+			unsigned BatchSize() const
+			{
+				return batch_size_;
+			}
+
+			/**
+			\brief Whether to stop tracking paths going to infinity, whose dehomogenized points exceed the path truncation threshold of the AMPTracker.  On by default.
+			*/
+			void SetInfiniteTruncation(bool b)
+			{
+				infinite_path_truncation_ = b;
+			}
+
+			/**
+			\brief The number of paths the most recent TrackPaths ejected to the AMPTracker.
+			*/
+			unsigned NumEjected() const
+			{
+				return num_ejected_;
+			}
+
+			/**
+			\brief The number of paths the most recent TrackPaths finished in double precision, without the AMPTracker.
+			*/
+			unsigned NumTrackedInDouble() const
+			{
+				return num_tracked_in_double_;
+			}
+
+
+			/**
+			\brief Track paths from start_time to end_time.
+
+			\param[out] solutions_at_endtime The points at the end of the paths, one per start point, at the precision they were finished in.  Entries for paths which failed are unspecified.
+			\param start_time The time at which to start tracking.
+			\param end_time The time to track to.
+			\param start_points The points to start the paths from.
+			\return The success code of each path, as TrackPath of the AMPTracker would return.
+			*/
+			std::vector<SuccessCode> TrackPaths(std::vector<Vec<mpfr_complex>> & solutions_at_endtime,
+			                                    dbl const& start_time, dbl const& end_time,
+			                                    std::vector<Vec<dbl>> const& start_points) const
+			{
+				const System& sys = fallback_.GetSystem();
+				const auto& slp = sys.GetStraightLineProgram();
+
+				if (!slp.HavePathVariable())
+					throw std::runtime_error("tracking paths in a batch requires a system with a path variable");
+				const unsigned n = sys.NumVariables();
+				if (slp.NumTotalFunctions() != n)
+					throw std::runtime_error("tracking paths in a batch requires a square system");
+				for (auto const& p : start_points)
+					if (p.size() != n)
+						throw std::runtime_error("start point size must match the number of variables in the system to be tracked");
+
+				const auto& stepping = fallback_.Get<SteppingConfig>();
+				const auto& newton = fallback_.Get<NewtonConfig>();
+				const auto& amp = fallback_.Get<AdaptiveMultiplePrecisionConfig>();
+
+				const double tracking_tolerance = fallback_.TrackingTolerance();
+				const double truncation_threshold = fallback_.InfiniteTruncationTolerance();
+				const double max_stepsize = double(stepping.max_step_size);
+				const double min_stepsize = double(stepping.min_step_size);
+				const double success_factor = double(stepping.step_size_success_factor);
+				const double fail_factor = double(stepping.step_size_fail_factor);
+				const double initial_stepsize = std::min(double(stepping.initial_step_size), abs(end_time - start_time)/stepping.min_num_steps);
+
+				const unsigned num_paths = start_points.size();
+				std::vector<SuccessCode> codes(num_paths, SuccessCode::NeverStarted);
+				solutions_at_endtime.resize(num_paths);
+				num_ejected_ = num_tracked_in_double_ = 0;
+
+				const auto precision = DefaultPrecision();
+
+
+				// the state of the paths in the lanes of the batch
+				struct Path
+				{
+					bool active = false;
+					unsigned index;
+					Vec<dbl> x;
+					dbl t;
+					dbl delta_t;
+					double stepsize;
+					unsigned num_steps;
+					unsigned num_consecutive_successes;
+					bool taking_step; // still taking the current step, neither failed nor ejected
+				};
+				struct Ejected
+				{
+					unsigned index;
+					Vec<dbl> x;
+					dbl t;
+				};
+
+				const unsigned B = std::min(batch_size_, std::max(num_paths, 1u));
+				SLPBatch batch(slp, B);
+				const unsigned L = batch.NumLanes();
+				BatchedLU lu(n, L);
+
+				std::vector<Path> paths(B);
+				std::vector<Ejected> ejected;
+				unsigned next_path = 0;
+
+				std::vector<double> rhs_re(size_t(n)*L), rhs_im(size_t(n)*L), est_re(size_t(n)*L), est_im(size_t(n)*L);
+				std::vector<Vec<dbl>> k1(B, Vec<dbl>(n)), x_next(B, Vec<dbl>(n));
+				std::vector<double> norm_J(B), norm_J_inverse(B);
+
+
+				// copy the Jacobians from the batch into the LU, computing their norms
+				auto LoadJacobians = [&]()
+				{
+					std::fill(norm_J.begin(), norm_J.end(), 0.);
+					for (unsigned ii = 0; ii < n; ++ii)
+						for (unsigned jj = 0; jj < n; ++jj)
+						{
+							const auto loc = batch.JacobianLocation(ii,jj);
+							std::copy(batch.RealLanes(loc), batch.RealLanes(loc)+L, lu.Real(ii,jj));
+							std::copy(batch.ImagLanes(loc), batch.ImagLanes(loc)+L, lu.Imag(ii,jj));
+							for (unsigned lane = 0; lane < B; ++lane)
+								norm_J[lane] += lu.Real(ii,jj)[lane]*lu.Real(ii,jj)[lane] + lu.Imag(ii,jj)[lane]*lu.Imag(ii,jj)[lane];
+						}
+					for (auto& x : norm_J)
+						x = std::sqrt(x);
+				};
+
+				// set the right hand sides to the negatives of a range of outputs of the batch
+				auto LoadNegated = [&](size_t (SLPBatch::*location)(unsigned) const)
+				{
+					for (unsigned ii = 0; ii < n; ++ii)
+					{
+						const auto loc = (batch.*location)(ii);
+						double const* const re = batch.RealLanes(loc);
+						double const* const im = batch.ImagLanes(loc);
+						BERTINI_INDEPENDENT_LANES
+						for (unsigned lane = 0; lane < L; ++lane)
+						{
+							rhs_re[ii*L + lane] = -re[lane];
+							rhs_im[ii*L + lane] = -im[lane];
+						}
+					}
+				};
+
+				auto Solution = [&](unsigned lane)
+				{
+					Vec<dbl> v(n);
+					for (unsigned ii = 0; ii < n; ++ii)
+						v(ii) = dbl(rhs_re[ii*L + lane], rhs_im[ii*L + lane]);
+					return v;
+				};
+
+				auto Finish = [&](Path& p, SuccessCode code)
+				{
+					codes[p.index] = code;
+					if (code==SuccessCode::Success)
+					{
+						solutions_at_endtime[p.index] = ToMultiple(p.x);
+						++num_tracked_in_double_;
+					}
+					p.active = false;
+				};
+
+				auto Eject = [&](Path& p)
+				{
+					ejected.push_back({p.index, p.x, p.t});
+					++num_ejected_;
+					p.active = false;
+					p.taking_step = false;
+				};
+
+				auto Refill = [&]()
+				{
+					for (auto& p : paths)
+						if (!p.active && next_path < num_paths)
+						{
+							p.active = true;
+							p.index = next_path;
+							p.x = start_points[next_path];
+							p.t = start_time;
+							p.stepsize = initial_stepsize;
+							p.num_steps = 0;
+							p.num_consecutive_successes = 0;
+							++next_path;
+						}
+				};
+
+
+
+				Refill();
+				while (std::any_of(paths.begin(), paths.end(), [](Path const& p){ return p.active; }))
+				{
+					// decide the steps
+					for (auto& p : paths)
+					{
+						p.taking_step = false;
+						if (!p.active)
+							continue;
+
+						if (p.num_steps >= stepping.max_num_steps)
+						{
+							Finish(p, SuccessCode::MaxNumStepsTaken);
+							continue;
+						}
+						if (p.stepsize < min_stepsize)
+						{
+							Eject(p);
+							continue;
+						}
+
+						if (abs(end_time - p.t) < p.stepsize)
+							p.delta_t = end_time - p.t;
+						else
+							p.delta_t = p.stepsize * (end_time - p.t)/abs(end_time - p.t);
+						p.taking_step = true;
+					}
+
+
+					// predict, with Heun's method.  first, the derivative at the current point
+					for (unsigned lane = 0; lane < B; ++lane)
+						if (paths[lane].taking_step)
+							batch.SetPoint(lane, paths[lane].x, paths[lane].t);
+					batch.Eval();
+					LoadJacobians();
+					lu.Factor();
+
+					LoadNegated(&SLPBatch::TimeDerivLocation);
+					lu.Solve(rhs_re.data(), rhs_im.data());
+
+					// estimate the norm of the inverse of the Jacobian, for the precision criteria, as the trackers do
+					for (unsigned ii = 0; ii < n; ++ii)
+						for (unsigned lane = 0; lane < L; ++lane)
+						{
+							const auto r = RandomUnit<dbl>();
+							est_re[ii*L + lane] = r.real();
+							est_im[ii*L + lane] = r.imag();
+						}
+					lu.Solve(est_re.data(), est_im.data());
+
+					for (unsigned lane = 0; lane < B; ++lane)
+					{
+						auto& p = paths[lane];
+						if (!p.taking_step)
+							continue;
+
+						double norm_squared = 0;
+						for (unsigned ii = 0; ii < n; ++ii)
+							norm_squared += est_re[ii*L + lane]*est_re[ii*L + lane] + est_im[ii*L + lane]*est_im[ii*L + lane];
+						norm_J_inverse[lane] = std::sqrt(norm_squared);
+
+						if (lu.IsSingular(lane) || !amp::CriterionA<dbl>(norm_J[lane], norm_J_inverse[lane], amp))
+						{
+							Eject(p);
+							continue;
+						}
+
+						k1[lane] = Solution(lane);
+						batch.SetPoint(lane, p.x + p.delta_t*k1[lane], p.t + p.delta_t);
+					}
+
+					// the derivative at the Euler step
+					batch.Eval();
+					LoadJacobians();
+					lu.Factor();
+					LoadNegated(&SLPBatch::TimeDerivLocation);
+					lu.Solve(rhs_re.data(), rhs_im.data());
+
+					for (unsigned lane = 0; lane < B; ++lane)
+					{
+						auto& p = paths[lane];
+						if (!p.taking_step)
+							continue;
+
+						if (lu.IsSingular(lane))
+						{
+							p.taking_step = false;
+							StepFail(p, fail_factor);
+							continue;
+						}
+						x_next[lane] = p.x + p.delta_t/2.*(k1[lane] + Solution(lane));
+					}
+
+
+					// correct, with Newton's method
+					std::vector<bool> converged(B, false);
+					for (unsigned iteration = 0; iteration < newton.max_num_newton_iterations; ++iteration)
+					{
+						bool any_correcting = false;
+						for (unsigned lane = 0; lane < B; ++lane)
+							if (paths[lane].taking_step && !converged[lane])
+							{
+								batch.SetPoint(lane, x_next[lane], paths[lane].t + paths[lane].delta_t);
+								any_correcting = true;
+							}
+						if (!any_correcting)
+							break;
+
+						batch.Eval();
+						LoadJacobians();
+						lu.Factor();
+						LoadNegated(&SLPBatch::FunctionLocation);
+						lu.Solve(rhs_re.data(), rhs_im.data());
+
+						for (unsigned lane = 0; lane < B; ++lane)
+						{
+							auto& p = paths[lane];
+							if (!p.taking_step || converged[lane])
+								continue;
+
+							if (lu.IsSingular(lane))
+							{
+								p.taking_step = false;
+								StepFail(p, fail_factor);
+								continue;
+							}
+
+							const Vec<dbl> delta_x = Solution(lane);
+							x_next[lane] += delta_x;
+							if (iteration+1 >= newton.min_num_newton_iterations && delta_x.norm() < tracking_tolerance)
+								converged[lane] = true;
+						}
+					}
+
+
+					// accept or reject the steps
+					for (unsigned lane = 0; lane < B; ++lane)
+					{
+						auto& p = paths[lane];
+						if (!p.taking_step)
+							continue;
+
+						if (!converged[lane])
+						{
+							StepFail(p, fail_factor);
+							continue;
+						}
+
+						if (!amp::CriterionC<dbl>(norm_J_inverse[lane], x_next[lane], tracking_tolerance, amp))
+						{
+							Eject(p);
+							continue;
+						}
+
+						p.x = x_next[lane];
+						p.t += p.delta_t;
+						++p.num_steps;
+						if (++p.num_consecutive_successes >= stepping.consecutive_successful_steps_before_stepsize_increase)
+						{
+							p.stepsize = std::min(p.stepsize*success_factor, max_stepsize);
+							p.num_consecutive_successes = 0;
+						}
+
+						if (infinite_path_truncation_ && sys.DehomogenizePoint(p.x).norm() > truncation_threshold)
+							Finish(p, SuccessCode::GoingToInfinity);
+						else if (IsSymmRelDiffSmall(p.t, end_time, Eigen::NumTraits<dbl>::epsilon()))
+							Finish(p, SuccessCode::Success);
+					}
+
+					Refill();
+				}
+
+
+				// the paths double precision wasn't enough for
+				for (auto const& e : ejected)
+				{
+					DefaultPrecision(precision);
+					mpfr_complex t(e.t), t_end(end_time);
+					codes[e.index] = fallback_.TrackPath(solutions_at_endtime[e.index], t, t_end, ToMultiple(e.x));
+				}
+				DefaultPrecision(precision);
+
+				return codes;
+			}
+
+		private:
+
+			template<typename PathT>
+			static void StepFail(PathT& p, double fail_factor)
+			{
+				p.stepsize *= fail_factor;
+				p.num_consecutive_successes = 0;
+			}
+
+			// at the current default precision
+			static Vec<mpfr_complex> ToMultiple(Vec<dbl> const& x)
+			{
+				Vec<mpfr_complex> result(x.size());
+				for (unsigned ii = 0; ii < x.size(); ++ii)
+					result(ii) = mpfr_complex(x(ii).real(), x(ii).imag());
+				return result;
+			}
+
+
+			AMPTracker const& fallback_; ///< Where the settings come from, and the tracker for ejected paths.
+			unsigned batch_size_; ///< The number of paths advanced together.
+			bool infinite_path_truncation_ = true; ///< Whether to stop paths going to infinity.
+
+			mutable unsigned num_ejected_ = 0;
+			mutable unsigned num_tracked_in_double_ = 0;
+		};
+
+	} // namespace tracking
+} // namespace bertini
+
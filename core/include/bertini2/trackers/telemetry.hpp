@@ -0,0 +1,407 @@
+//This file is part of Bertini 2.
+//
+//trackers/telemetry.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//trackers/telemetry.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with trackers/telemetry.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+
+/**
+\file include/bertini2/trackers/telemetry.hpp
+
+\brief Low-overhead recording of tracker steps, into a binary trace file.
+
+A StepRecorder observes a tracker, and pushes a fixed-size StepRecord for every step into a lock-free ring owned by a TraceWriter.  The writer drains its rings from a background thread into a compact binary file, which can be read back with ReadTrace and summarized with SummarizeTrace, or the `bertini2_trace_summary` program.
+
+Nothing is formatted while tracking, so recording costs a few stores per step, unlike GoryDetailLogger.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "bertini2/trackers/events.hpp"
+
+#include "bertini2/detail/observer.hpp"
+
+#include "bertini2/trackers/base_tracker.hpp"
+
+namespace bertini {
+
+	namespace tracking{
+
+		/**
+		\brief What is recorded about one step of tracking, or the start of tracking a path.
+
+		These are written to trace files as they are in memory, so the layout is fixed, and is one cache line.
+		*/
+		struct StepRecord
+		{
+			std::uint64_t path; ///< The index of the path being tracked.
+			std::uint64_t nanoseconds; ///< When the step ended, since the TraceWriter was made.
+			double time_real; ///< The real part of the time after the step.
+			double time_imag; ///< The imaginary part of the time after the step.
+			double stepsize; ///< The stepsize after the step, or zero for the start of a path.
+			double newton_residual; ///< The norm of the latest Newton step.
+			double condition_number; ///< The latest estimate of the condition number of the Jacobian.
+			std::uint32_t precision; ///< The precision of the step, in digits.
+			std::int32_t success_code; ///< The SuccessCode of the step, or SuccessCode::NeverStarted for the start of a path.
+		};
+
+		static_assert(sizeof(StepRecord)==64, "step records are written to trace files byte for byte, and must keep their layout");
+		static_assert(std::is_trivially_copyable<StepRecord>::value, "step records are written to trace files byte for byte");
+
+
+		/**
+		\brief A fixed-capacity ring of StepRecords, for one producing and one consuming thread, without locks.
+
+		The producer pushes with TryPush, which drops the record if the ring is full rather than waiting, and the consumer takes everything pushed so far with Drain.
+		*/
+		class StepRing
+		{
+		public:
+
+			/**
+			\param capacity The number of records the ring can hold.  Rounded up to a power of two.
+			*/
+			explicit
+			StepRing(std::size_t capacity);
+
+			StepRing(StepRing const&) = delete;
+			StepRing& operator=(StepRing const&) = delete;
+
+			/**
+			\brief Add a record, from the producing thread.
+
+			\return Whether there was room.  If not, the record is counted as dropped.
+			*/
+			bool TryPush(StepRecord const& record)
+			{
+				const auto head = head_.load(std::memory_order_relaxed);
+				if (head - tail_.load(std::memory_order_acquire) > mask_)
+				{
+					num_dropped_.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+
+				records_[head & mask_] = record;
+				head_.store(head+1, std::memory_order_release);
+				return true;
+			}
+
+			/**
+			\brief Take all the records pushed so far, from the consuming thread.
+
+			\param f Called with a pointer to, and a number of, contiguous records, at most twice.
+			\return The number of records taken.
+			*/
+			template<typename F>
+			std::size_t Drain(F&& f)
+			{
+				const auto tail = tail_.load(std::memory_order_relaxed);
+				const auto head = head_.load(std::memory_order_acquire);
+				const auto n = head - tail;
+				if (n==0)
+					return 0;
+
+				const auto begin = tail & mask_;
+				const auto first = std::min(n, Capacity() - begin);
+				f(records_.data() + begin, first);
+				if (first < n)
+					f(records_.data(), n - first);
+
+				tail_.store(head, std::memory_order_release);
+				return n;
+			}
+
+			std::size_t Capacity() const
+			{
+				return mask_ + 1;
+			}
+
+			/**
+			\brief The number of records dropped because the ring was full.
+			*/
+			std::size_t NumDropped() const
+			{
+				return num_dropped_.load(std::memory_order_relaxed);
+			}
+
+		private:
+			std::vector<StepRecord> records_;
+			std::size_t mask_;
+
+			// the producer and consumer each write one of these, so they are kept on separate cache lines
+			char pad0_[64];
+			std::atomic<std::size_t> head_{0}; ///< The number of records ever pushed.
+			char pad1_[64];
+			std::atomic<std::size_t> tail_{0}; ///< The number of records ever taken.
+			char pad2_[64];
+			std::atomic<std::size_t> num_dropped_{0};
+		};
+
+
+
+		/**
+		\brief Writes the records pushed into its rings to a binary trace file, from a background thread.
+
+		Each thread recording steps gets a ring of its own, with NewRing, so pushing a record never waits on another thread.  Rings are drained every `interval`, and once more when the writer is destroyed, which must be after the recorders using it are done.
+
+		The file is a header -- the bytes `B2TRACE`, a zero, and the version and record size as 32-bit unsigned integers -- followed by the StepRecords, in the order they were drained.  Records from one ring stay in order, but records from different rings are interleaved.
+		*/
+		class TraceWriter
+		{
+		public:
+
+			/**
+			\param filename The trace file to write.  Overwritten if it exists.
+			\param ring_capacity The number of records each ring can hold.
+			\param interval How often the rings are drained.
+			*/
+			TraceWriter(std::string const& filename, std::size_t ring_capacity = 1<<14, std::chrono::milliseconds interval = std::chrono::milliseconds(10));
+
+			~TraceWriter();
+
+			TraceWriter(TraceWriter const&) = delete;
+			TraceWriter& operator=(TraceWriter const&) = delete;
+
+			/**
+			\brief A new ring, for one producing thread.  Owned by the writer.
+			*/
+			StepRing& NewRing();
+
+			/**
+			\brief Write everything pushed so far to the file, now.
+			*/
+			void Flush();
+
+			/**
+			\brief The time since the writer was made, for time-stamping records.
+			*/
+			std::uint64_t Nanoseconds() const
+			{
+				return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count();
+			}
+
+			/**
+			\brief The number of records written to the file so far.
+			*/
+			std::size_t NumWritten() const;
+
+			/**
+			\brief The number of records dropped because a ring was full, so missing from the file.
+			*/
+			std::size_t NumDropped() const;
+
+			static constexpr std::uint32_t Version = 1;
+
+		private:
+
+			void Run();
+			void DrainAll();
+
+			std::ofstream file_;
+			std::size_t ring_capacity_;
+			std::chrono::milliseconds interval_;
+			std::chrono::steady_clock::time_point start_;
+
+			mutable std::mutex mutex_; ///< For the rings, the file, and stopping.  Never taken while pushing.
+			std::condition_variable wake_;
+			bool stop_ = false;
+			std::vector<std::unique_ptr<StepRing>> rings_;
+			std::size_t num_written_ = 0;
+
+			std::thread thread_;
+		};
+
+
+
+		/**
+		\brief Records every step of a tracker, and the start of every path, into a ring of a TraceWriter.
+
+		Attach one recorder to each tracker, and use each tracker from one thread at a time.  The recorder doesn't know which path is being tracked, so set it with SetPath before tracking each path.
+
+		\tparam TrackerT The type of tracker being recorded.
+		*/
+		template<class TrackerT>
+		class StepRecorder : public Observer<TrackerT>
+		{ BOOST_TYPE_INDEX_REGISTER_CLASS
+
+			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+			using StartEventT = Initializing<EmitterT, typename TrackerTraits<TrackerT>::BaseComplexType>;
+
+			virtual void Observe(AnyEvent const& e) override
+			{
+				if (!writer_)
+					return;
+
+				using std::real; using std::imag;
+
+				StepRecord r;
+				r.path = path_;
+				r.nanoseconds = writer_->Nanoseconds();
+
+				if (auto p = EventCast<StartEventT>(e))
+				{
+					// the tracker is not yet initialized, so only what the event carries is known
+					r.time_real = static_cast<double>(real(p->StartTime()));
+					r.time_imag = static_cast<double>(imag(p->StartTime()));
+					r.stepsize = 0;
+					r.newton_residual = 0;
+					r.condition_number = 0;
+					r.precision = Precision(p->StartPoint());
+					r.success_code = static_cast<std::int32_t>(SuccessCode::NeverStarted);
+				}
+				else if (auto p = EventCast<TrackingEvent<EmitterT>>(e))
+				{
+					auto const& t = p->Get();
+					auto time = t.CurrentTime();
+
+					r.time_real = static_cast<double>(real(time));
+					r.time_imag = static_cast<double>(imag(time));
+					r.stepsize = static_cast<double>(t.CurrentStepsize());
+					r.newton_residual = t.LatestNormOfStep();
+					r.condition_number = t.LatestConditionNumber();
+					r.precision = t.CurrentPrecision();
+					r.success_code = static_cast<std::int32_t>(t.LatestStepSuccessCode());
+				}
+				else
+					return;
+
+				ring_->TryPush(r);
+			}
+
+			detail::EventMask Subscriptions() const override
+			{
+				return detail::EventTypeBits<StartEventT, SuccessfulStep<EmitterT>, FailedStep<EmitterT>>();
+			}
+
+		public:
+
+			StepRecorder() = default;
+
+			/**
+			\brief Make a recorder writing to a new ring of a writer.
+			*/
+			explicit
+			StepRecorder(TraceWriter & writer)
+			{
+				WriteTo(writer);
+			}
+
+			/**
+			\brief Write to a new ring of a writer.
+			*/
+			void WriteTo(TraceWriter & writer)
+			{
+				writer_ = &writer;
+				ring_ = &writer.NewRing();
+			}
+
+			/**
+			\brief Stop recording.
+			*/
+			void StopWriting()
+			{
+				writer_ = nullptr;
+				ring_ = nullptr;
+			}
+
+			bool IsWriting() const
+			{
+				return writer_;
+			}
+
+			/**
+			\brief Set the index of the path whose steps are being recorded.
+			*/
+			void SetPath(std::uint64_t path)
+			{
+				path_ = path;
+			}
+
+			virtual ~StepRecorder() = default;
+
+		private:
+			TraceWriter* writer_ = nullptr;
+			StepRing* ring_ = nullptr;
+			std::uint64_t path_ = 0;
+		};
+
+
+
+		/**
+		\brief Read the records of a trace file written by a TraceWriter.
+
+		\throws std::runtime_error if the file can't be read, or isn't a trace file of this version.
+		*/
+		std::vector<StepRecord> ReadTrace(std::string const& filename);
+
+
+		/**
+		\brief What happened while tracking one path, from a trace.
+		*/
+		struct PathTraceSummary
+		{
+			std::size_t num_steps = 0; ///< Including failed steps.
+			std::size_t num_failed_steps = 0;
+			unsigned max_precision = 0;
+			double seconds = 0; ///< Time spent taking steps.
+		};
+
+		/**
+		\brief Summary of a trace: steps per path, time spent at each precision, and where steps failed.
+
+		The time of a step is the time since the previous record of the same path, and the start of each path is recorded, so the time between tracking a path to the endgame boundary and running the endgame on it is not counted.
+		*/
+		struct TraceSummary
+		{
+			std::size_t num_steps = 0; ///< Including failed steps.
+			std::size_t num_failed_steps = 0;
+			std::map<std::uint64_t, PathTraceSummary> paths; ///< By path index.
+			std::map<unsigned, double> seconds_at_precision; ///< Time spent taking steps, by precision in digits.
+			std::map<unsigned, std::size_t> steps_at_precision; ///< Steps taken, by precision in digits.
+			std::map<SuccessCode, std::size_t> failures_by_code; ///< Failed steps, by why they failed.
+			std::vector<std::size_t> failures_by_time; ///< Failed steps, by where they failed, in equal intervals of |t| over [0,1].  Failures past |t|=1 are in the last interval.
+		};
+
+		/**
+		\brief Summarize the records of a trace.
+
+		\param records The records, as from ReadTrace.
+		\param num_time_intervals How many intervals of |t| to count failures in.
+		*/
+		TraceSummary SummarizeTrace(std::vector<StepRecord> const& records, unsigned num_time_intervals = 20);
+
+	} //re: namespace tracking
+
+}// re: namespace bertini
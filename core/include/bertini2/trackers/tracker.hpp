@@ -34,6 +34,7 @@
 
 #include "bertini2/trackers/fixed_precision_tracker.hpp"
 #include "bertini2/trackers/amp_tracker.hpp"
+#include "bertini2/trackers/path_batch_tracker.hpp"
 
 
 #endif
@@ -0,0 +1,113 @@
+//This file is part of Bertini 2.
+//
+//src/blackbox/trace_summary.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//src/blackbox/trace_summary.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with src/blackbox/trace_summary.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+
+/**
+\file src/blackbox/trace_summary.cpp
+
+\brief Summarizes a trace file of tracker steps, written by a TraceWriter.
+
+usage: bertini2_trace_summary trace_file [num_hot_spots]
+
+Prints the steps per path, the time spent at each precision, and where steps failed: by reason, by time, and the paths with the most failures.
+*/
+
+#include "bertini2/trackers/telemetry.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+	using namespace bertini;
+	using namespace bertini::tracking;
+
+	if (argc < 2)
+	{
+		std::cerr << "usage: " << argv[0] << " trace_file [num_hot_spots]\n";
+		return 1;
+	}
+
+	const unsigned num_hot_spots = argc > 2 ? std::atoi(argv[2]) : 10;
+
+	std::vector<StepRecord> records;
+	try
+	{
+		records = ReadTrace(argv[1]);
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << e.what() << '\n';
+		return 1;
+	}
+
+	const auto summary = SummarizeTrace(records);
+
+	std::cout << records.size() << " records, of " << summary.num_steps << " steps on " << summary.paths.size() << " paths, " << summary.num_failed_steps << " of which failed\n\n";
+
+	if (!summary.paths.empty())
+	{
+		std::size_t min_steps = summary.paths.begin()->second.num_steps, max_steps = 0;
+		for (auto const& p : summary.paths)
+		{
+			min_steps = std::min(min_steps, p.second.num_steps);
+			max_steps = std::max(max_steps, p.second.num_steps);
+		}
+		std::cout << "steps per path: mean " << double(summary.num_steps)/summary.paths.size() << ", min " << min_steps << ", max " << max_steps << "\n\n";
+	}
+
+	std::cout << "precision\tsteps\tseconds\n";
+	for (auto const& p : summary.steps_at_precision)
+		std::cout << p.first << "\t\t" << p.second << '\t' << summary.seconds_at_precision.at(p.first) << '\n';
+	std::cout << '\n';
+
+	if (summary.num_failed_steps==0)
+		return 0;
+
+	std::cout << "failed steps, by SuccessCode\n";
+	for (auto const& f : summary.failures_by_code)
+		std::cout << f.first << '\t' << f.second << '\n';
+	std::cout << '\n';
+
+	std::cout << "failed steps, by |t|\n";
+	const auto num_intervals = summary.failures_by_time.size();
+	for (std::size_t ii = 0; ii < num_intervals; ++ii)
+		if (summary.failures_by_time[ii])
+			std::cout << '[' << double(ii)/num_intervals << ", " << double(ii+1)/num_intervals << ")\t" << summary.failures_by_time[ii] << '\n';
+	std::cout << '\n';
+
+	std::vector<std::pair<std::uint64_t, PathTraceSummary>> paths(summary.paths.begin(), summary.paths.end());
+	std::stable_sort(paths.begin(), paths.end(), [](auto const& a, auto const& b){ return a.second.num_failed_steps > b.second.num_failed_steps; });
+
+	std::cout << "paths with the most failed steps\npath\tfailed\tsteps\tmax precision\tseconds\n";
+	for (std::size_t ii = 0; ii < std::min<std::size_t>(num_hot_spots, paths.size()) && paths[ii].second.num_failed_steps > 0; ++ii)
+	{
+		auto const& p = paths[ii].second;
+		std::cout << paths[ii].first << '\t' << p.num_failed_steps << '\t' << p.num_steps << '\t' << p.max_precision << "\t\t" << p.seconds << '\n';
+	}
+
+	return 0;
+}
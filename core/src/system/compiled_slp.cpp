@@ -0,0 +1,217 @@
+//This file is part of Bertini 2.
+//
+//compiled_slp.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//compiled_slp.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with compiled_slp.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+#include "bertini2/system/compiled_slp.hpp"
+#include "bertini2/system/straight_line_program.hpp"
+
+#include <boost/dll/shared_library.hpp>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <vector>
+
+
+namespace bertini{
+
+	namespace {
+
+		struct Registry{
+			std::mutex mutex;
+			std::map<std::uint64_t, CompiledSLP> compiled; // a map, so that pointers to its entries stay valid
+			std::vector<boost::dll::shared_library> libraries;
+		};
+
+		Registry& TheRegistry(){
+			static Registry registry; // constructed on first use, because generated code registers during static initialization
+			return registry;
+		}
+
+	}
+
+
+	void CompiledSLPRegistry::Register(CompiledSLP const& compiled){
+		auto& registry = TheRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		registry.compiled[compiled.Fingerprint] = compiled;
+	}
+
+
+	CompiledSLP const* CompiledSLPRegistry::Find(std::uint64_t fingerprint){
+		auto& registry = TheRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		auto found = registry.compiled.find(fingerprint);
+		return found==registry.compiled.end() ? nullptr : &found->second;
+	}
+
+
+	void CompiledSLPRegistry::Unregister(std::uint64_t fingerprint){
+		auto& registry = TheRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		registry.compiled.erase(fingerprint);
+	}
+
+
+	void CompiledSLPRegistry::Load(std::string const& shared_library){
+		// not under the lock, because loading the library runs its registrars
+		boost::dll::shared_library library;
+		try{
+			library.load(shared_library);
+		}
+		catch (std::exception const& e){
+			std::stringstream err_msg;
+			err_msg << "unable to load compiled straight-line programs from " << shared_library << ": " << e.what();
+			throw std::runtime_error(err_msg.str());
+		}
+
+		auto& registry = TheRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		registry.libraries.push_back(std::move(library));
+	}
+
+
+	std::size_t CompiledSLPRegistry::NumRegistered(){
+		auto& registry = TheRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		return registry.compiled.size();
+	}
+
+
+
+
+	namespace {
+
+		bool ReadsSecondOperand(PackedOperation op){
+			switch (op){
+				case PackedOperation::Add:
+				case PackedOperation::Subtract:
+				case PackedOperation::Multiply:
+				case PackedOperation::Divide:
+				case PackedOperation::Power:
+				case PackedOperation::MultiplyAdd:
+					return true;
+				default:
+					return false;
+			}
+		}
+
+
+		/**
+		 \brief The right hand side of the statement for an instruction, with operands named by `v`.
+		 */
+		template<typename NameT>
+		std::string Expression(PackedInstruction const& i, NameT const& v){
+			switch (i.op){
+				case PackedOperation::Add:          return v(i.in1) + " + " + v(i.in2);
+				case PackedOperation::Subtract:     return v(i.in1) + " - " + v(i.in2);
+				case PackedOperation::Multiply:     return v(i.in1) + " * " + v(i.in2);
+				case PackedOperation::Divide:       return v(i.in1) + " / " + v(i.in2);
+				case PackedOperation::Power:        return "pow(" + v(i.in1) + ", " + v(i.in2) + ")";
+				case PackedOperation::Assign:       return v(i.in1);
+				case PackedOperation::Negate:       return "-" + v(i.in1);
+				case PackedOperation::Sqrt:         return "sqrt(" + v(i.in1) + ")";
+				case PackedOperation::Exp:          return "exp(" + v(i.in1) + ")";
+				case PackedOperation::Log:          return "log(" + v(i.in1) + ")";
+				case PackedOperation::Sin:          return "sin(" + v(i.in1) + ")";
+				case PackedOperation::Cos:          return "cos(" + v(i.in1) + ")";
+				case PackedOperation::Tan:          return "tan(" + v(i.in1) + ")";
+				case PackedOperation::Asin:         return "asin(" + v(i.in1) + ")";
+				case PackedOperation::Acos:         return "acos(" + v(i.in1) + ")";
+				case PackedOperation::Atan:         return "atan(" + v(i.in1) + ")";
+				case PackedOperation::MultiplyAdd:  return v(i.in1) + " * " + v(i.in2) + " + " + v(i.in3);
+				case PackedOperation::Square:       return v(i.in1) + " * " + v(i.in1);
+				case PackedOperation::IntegerPower: return "bertini::IntegerPower(" + v(i.in1) + ", " + std::to_string(static_cast<std::int32_t>(i.in2)) + ")";
+				case PackedOperation::End:          break;
+			}
+			throw std::runtime_error("generating code for unknown packed operation");
+		}
+
+	}
+
+
+	void SLPCodeGenerator::Generate(StraightLineProgram const& slp, std::string const& name, std::ostream & out) const{
+		if (slp.packed_instructions_.empty())
+			throw std::runtime_error("generating code for a straight-line program which was never compiled");
+
+		const auto memory_size = slp.MemorySize();
+		const auto fingerprint = slp.Fingerprint();
+		const auto instructions = std::vector<PackedInstruction>(slp.packed_instructions_.begin(), slp.packed_instructions_.end()-1); // without the End
+
+
+		// the locations past the inputs and outputs which aren't numbers hold intermediate results, which are only needed during one evaluation
+		std::vector<bool> is_temporary(memory_size, false);
+		for (auto loc = slp.EndOfOutputs(); loc<memory_size; ++loc)
+			is_temporary[loc] = true;
+		for (auto const& x : slp.true_values_of_numbers_)
+			is_temporary[x.second] = false;
+
+		std::vector<size_t> temporaries;
+		{
+			std::vector<bool> used(memory_size, false);
+			auto use = [&](std::uint32_t loc){ if (is_temporary[loc] && !used[loc]){ used[loc] = true; temporaries.push_back(loc);} };
+			for (auto const& i : instructions){
+				use(i.out);
+				use(i.in1);
+				if (ReadsSecondOperand(i.op))
+					use(i.in2);
+				if (i.op==PackedOperation::MultiplyAdd)
+					use(i.in3);
+			}
+			std::sort(temporaries.begin(), temporaries.end());
+		}
+
+		auto in_memory = [](size_t loc){ return "m[" + std::to_string(loc) + "]"; };
+		auto in_register = [&](size_t loc){ return is_temporary[loc] ? "r" + std::to_string(loc) : in_memory(loc); };
+
+
+		out << "// generated by Bertini2's SLPCodeGenerator.  do not edit.\n";
+		out << "//\n";
+		out << "// evaluates the straight-line programs with fingerprint " << fingerprint << ", which have " << instructions.size() << " packed instructions, and memory of size " << memory_size << ".\n\n";
+		out << "#include <bertini2/system/straight_line_program.hpp>\n\n";
+		out << "namespace {\n\n";
+		out << "\tusing bertini::dbl_complex;\n";
+		out << "\tusing bertini::mpfr_complex;\n\n";
+
+		// double precision, with the intermediate results in local variables
+		out << "\tvoid " << name << "_EvalDouble(dbl_complex* m)\n\t{\n";
+		for (size_t ii = 0; ii<temporaries.size(); ++ii)
+			out << (ii%8==0 ? "\t\tdbl_complex " : ", ") << in_register(temporaries[ii]) << (ii%8==7 || ii+1==temporaries.size() ? ";\n" : "");
+		out << "\n";
+		for (auto const& i : instructions)
+			out << "\t\t" << in_register(i.out) << " = " << Expression(i, in_register) << ";\n";
+		out << "\t}\n\n";
+
+		// multiple precision, in the program's memory
+		out << "\tvoid " << name << "_EvalMultiprecision(mpfr_complex* m)\n\t{\n";
+		for (auto const& i : instructions)
+			out << "\t\t" << in_memory(i.out) << " = " << Expression(i, in_memory) << ";\n";
+		out << "\t}\n\n";
+
+		out << "\tconst bertini::CompiledSLPRegistry::Registrar " << name << "_registrar(bertini::CompiledSLP{" << fingerprint << "ull, \"" << name << "\", &" << name << "_EvalDouble, &" << name << "_EvalMultiprecision});\n\n";
+		out << "} // namespace\n";
+	}
+
+} // namespace bertini
@@ -0,0 +1,498 @@
+//This file is part of Bertini 2.
+//
+//polynomial_system.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//polynomial_system.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with polynomial_system.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+#include "bertini2/system/polynomial_system.hpp"
+#include "bertini2/system/system.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+
+// PolynomialSystem stuff
+namespace bertini{
+
+	PolynomialSystem::PolynomialSystem(System const& sys)
+	{
+		PolynomialExpander expander;
+		*this = expander.Expand(sys);
+	}
+
+
+	void PolynomialSystem::precision(unsigned new_precision) const
+	{
+		if (new_precision==precision_)
+			return;
+
+		precision_ = new_precision;
+
+		auto& rounded = coefficients_at_precision_[new_precision];
+		if (!rounded)
+			rounded = RoundCoefficients<mpfr_complex>();
+		std::get<std::shared_ptr<const std::vector<mpfr_complex>>>(coefficients_) = rounded;
+
+		auto& memory = std::get<ProgramMemory<mpfr_complex>>(memory_);
+		for (auto& x : memory.values)
+			Precision(x, new_precision);
+		for (auto& x : memory.tangents)
+			Precision(x, new_precision);
+		memory.is_evaluated = false;
+		memory.tangents_evaluated = false;
+	}
+
+
+	template<typename NumT>
+	std::shared_ptr<const std::vector<NumT>> PolynomialSystem::RoundCoefficients() const
+	{
+		// the coefficient nodes are those of the system, whose numbers hold their values at whatever precision the system was last at, and which other threads may be evaluating.  so round copies of them, whose numbers are evaluated fresh from their exact values.  copying them all at once keeps what they share shared, so it is evaluated once.
+		std::vector<std::shared_ptr<node::Node>> copies;
+		{
+			std::stringstream ss;
+			{
+				boost::archive::text_oarchive oa(ss);
+				oa << coefficient_nodes_;
+			}
+			boost::archive::text_iarchive ia(ss);
+			ia >> copies;
+		}
+
+		// the numbers are evaluated at the default precision, so temporarily make it that of this system
+		auto previous_default = DefaultPrecision();
+		if (std::is_same<NumT,mpfr_complex>::value)
+			DefaultPrecision(precision_);
+
+		auto rounded = std::make_shared<std::vector<NumT>>(copies.size());
+		for (size_t ii = 0; ii < copies.size(); ++ii)
+		{
+			(*rounded)[ii] = copies[ii]->Eval<NumT>();
+			Precision((*rounded)[ii], precision_);
+		}
+
+		DefaultPrecision(previous_default);
+		return rounded;
+	}
+
+	template std::shared_ptr<const std::vector<dbl>> PolynomialSystem::RoundCoefficients<dbl>() const;
+	template std::shared_ptr<const std::vector<mpfr_complex>> PolynomialSystem::RoundCoefficients<mpfr_complex>() const;
+
+
+	template<typename NumT>
+	void PolynomialSystem::MakeMemory()
+	{
+		auto previous_default = DefaultPrecision();
+		if (std::is_same<NumT,mpfr_complex>::value)
+			DefaultPrecision(precision_);
+
+		auto& memory = std::get<ProgramMemory<NumT>>(memory_);
+		memory.values = std::vector<NumT>(memory_size_);
+		memory.tangents = std::vector<NumT>(num_functions_*num_inputs_);
+
+		for (int e = 1; e <= max_exponent_; ++e)
+			memory.values[integers_ + e - 1] = e;
+
+		for (auto& x : memory.values)
+			Precision(x, precision_);
+		for (auto& x : memory.tangents)
+			Precision(x, precision_);
+
+		memory.is_evaluated = false;
+		memory.tangents_evaluated = false;
+
+		DefaultPrecision(previous_default);
+	}
+
+	template void PolynomialSystem::MakeMemory<dbl>();
+	template void PolynomialSystem::MakeMemory<mpfr_complex>();
+
+} // namespace bertini
+
+
+
+// stuff for PolynomialExpander
+namespace bertini{
+
+	using Monomials = PolynomialExpander::Monomials;
+
+
+	PolynomialSystem PolynomialExpander::Expand(System const& sys)
+	{
+		if (!sys.IsPolynomial())
+			throw std::runtime_error("trying to expand a system into monomials, but it is not polynomial");
+
+		expansions_.clear();
+		one_ = MakeInteger(1);
+
+		PolynomialSystem poly;
+		poly.precision_ = sys.precision();
+
+		// 1. the variables, and then the path variable, are the inputs, each a monomial of its own
+		const auto& variables = sys.Variables();
+		poly.num_variables_ = variables.size();
+		poly.have_path_variable_ = sys.HavePathVariable();
+		poly.num_inputs_ = num_inputs_ = poly.num_variables_ + (poly.have_path_variable_ ? 1 : 0);
+
+		auto Input = [&](std::shared_ptr<const node::Node> const& v, size_t index){
+			std::vector<int> exponents(num_inputs_, 0);
+			exponents[index] = 1;
+			expansions_[v] = Monomials{{exponents, one_}};
+		};
+
+		for (size_t ii = 0; ii < variables.size(); ++ii)
+			Input(variables[ii], ii);
+		if (sys.HavePathVariable())
+			Input(sys.GetPathVariable(), poly.num_variables_);
+
+
+		// 2. expand the functions, and lay their monomials out flat
+		const auto& functions = sys.GetFunctions();
+		poly.num_functions_ = functions.size();
+		poly.max_exponents_.assign(num_inputs_, 0);
+
+		std::vector<bool> depends(poly.num_functions_*num_inputs_, false);
+
+		for (size_t ii = 0; ii < functions.size(); ++ii)
+		{
+			for (auto const& mono : ExpansionOf(functions[ii]))
+			{
+				const auto& exponents = mono.first;
+				for (size_t v = 0; v < num_inputs_; ++v)
+					if (exponents[v] > 0)
+					{
+						poly.factor_variables_.push_back(static_cast<int>(v));
+						poly.factor_exponents_.push_back(exponents[v]);
+						poly.max_exponents_[v] = std::max(poly.max_exponents_[v], exponents[v]);
+						depends[ii*num_inputs_ + v] = true;
+					}
+
+				poly.max_factors_ = std::max(poly.max_factors_, poly.factor_variables_.size() - poly.monomial_starts_.back());
+				poly.monomial_starts_.push_back(poly.factor_variables_.size());
+				poly.coefficient_nodes_.push_back(mono.second);
+			}
+			poly.function_starts_.push_back(poly.coefficient_nodes_.size());
+		}
+
+		for (size_t loc = 0; loc < depends.size(); ++loc)
+			if (depends[loc])
+				poly.nonzero_derivatives_.push_back(loc);
+
+
+		// 3. lay out the memory
+		size_t loc = num_inputs_;
+
+		poly.max_exponent_ = poly.max_exponents_.empty() ? 0 : *std::max_element(poly.max_exponents_.begin(), poly.max_exponents_.end());
+		poly.integers_ = loc;
+		loc += poly.max_exponent_;
+
+		poly.power_starts_.resize(num_inputs_);
+		for (size_t v = 0; v < num_inputs_; ++v)
+		{
+			poly.power_starts_[v] = loc;
+			loc += poly.max_exponents_[v];
+		}
+
+		poly.functions_ = loc;
+		loc += poly.num_functions_;
+
+		poly.scratch_ = loc;
+		loc += poly.max_factors_ + 3; // the running products from the left, the one from the right, and a term
+
+		poly.memory_size_ = loc;
+
+		poly.MakeMemory<dbl>();
+		poly.MakeMemory<mpfr_complex>();
+
+
+		// 4. round the coefficients
+		std::get<std::shared_ptr<const std::vector<dbl>>>(poly.coefficients_) = poly.RoundCoefficients<dbl>();
+		auto rounded = poly.RoundCoefficients<mpfr_complex>();
+		poly.coefficients_at_precision_[poly.precision_] = rounded;
+		std::get<std::shared_ptr<const std::vector<mpfr_complex>>>(poly.coefficients_) = rounded;
+
+		expansions_.clear();
+		return poly;
+	}
+
+
+	Monomials const& PolynomialExpander::ExpansionOf(std::shared_ptr<node::Node> const& n)
+	{
+		auto found = expansions_.find(n);
+		if (found != expansions_.end())
+			return found->second;
+
+		n->Accept(*this);
+
+		found = expansions_.find(n);
+		if (found == expansions_.end())
+		{
+			std::stringstream err_msg;
+			err_msg << "unable to expand node " << *n << " into monomials.  its type is not supported.";
+			throw std::runtime_error(err_msg.str());
+		}
+		return found->second;
+	}
+
+
+	void PolynomialExpander::NotPolynomial(node::Node const& n) const
+	{
+		std::stringstream err_msg;
+		err_msg << "unable to expand node " << n << " into monomials, because it is not polynomial in the variables and path variable of the system.";
+		throw std::runtime_error(err_msg.str());
+	}
+
+
+	Monomials PolynomialExpander::Constant(std::shared_ptr<node::Node> const& c) const
+	{
+		return Monomials{{std::vector<int>(num_inputs_, 0), c}};
+	}
+
+
+	bool PolynomialExpander::IsConstant(Monomials const& p) const
+	{
+		if (p.empty())
+			return true;
+		if (p.size() > 1)
+			return false;
+		const auto& exponents = p.begin()->first;
+		return std::all_of(exponents.begin(), exponents.end(), [](int e){ return e==0; });
+	}
+
+
+	std::shared_ptr<node::Node> PolynomialExpander::Product(std::shared_ptr<node::Node> const& a, std::shared_ptr<node::Node> const& b) const
+	{
+		if (a==one_)
+			return b;
+		if (b==one_)
+			return a;
+		return a*b;
+	}
+
+
+	void PolynomialExpander::AddTo(Monomials & p, Monomials const& q, bool add) const
+	{
+		for (auto const& mono : q)
+		{
+			auto found = p.find(mono.first);
+			if (found==p.end())
+				p.emplace(mono.first, add ? mono.second : -mono.second);
+			else
+				found->second = add ? found->second + mono.second : found->second - mono.second;
+		}
+	}
+
+
+	Monomials PolynomialExpander::Multiply(Monomials const& p, Monomials const& q) const
+	{
+		Monomials result;
+		std::vector<int> exponents(num_inputs_);
+		for (auto const& a : p)
+			for (auto const& b : q)
+			{
+				for (size_t v = 0; v < num_inputs_; ++v)
+					exponents[v] = a.first[v] + b.first[v];
+
+				auto coefficient = Product(a.second, b.second);
+				auto found = result.find(exponents);
+				if (found==result.end())
+					result.emplace(exponents, coefficient);
+				else
+					found->second = found->second + coefficient;
+			}
+		return result;
+	}
+
+
+	Monomials PolynomialExpander::Power(Monomials const& p, int exponent) const
+	{
+		// by repeated squaring
+		Monomials result = Constant(one_);
+		Monomials square = p;
+		while (exponent > 0)
+		{
+			if (exponent & 1)
+				result = Multiply(result, square);
+			exponent >>= 1;
+			if (exponent > 0)
+				square = Multiply(square, square);
+		}
+		return result;
+	}
+
+
+
+	void PolynomialExpander::Visit(node::Variable const& n){
+		// all the variables of the system, and the path variable, are expanded before the functions.  so this one is foreign to the system.
+		std::stringstream err_msg;
+		err_msg << "encountered variable " << n << " while expanding polynomial system, but it is not a variable of the system.  implicit parameters are not supported.";
+		throw std::runtime_error(err_msg.str());
+	}
+
+	void PolynomialExpander::Visit(node::Integer const& n){
+		if (n.Eval<dbl>()==dbl(0))
+			expansions_[n.shared_from_this()] = Monomials(); // the zero polynomial
+		else
+			this->DealWithNumber(n);
+	}
+
+	void PolynomialExpander::Visit(node::Float const& n){
+		this->DealWithNumber(n);
+	}
+
+	void PolynomialExpander::Visit(node::Rational const& n){
+		this->DealWithNumber(n);
+	}
+
+	void PolynomialExpander::Visit(node::special_number::Pi const& n){
+		this->DealWithNumber(n);
+	}
+
+	void PolynomialExpander::Visit(node::special_number::E const& n){
+		this->DealWithNumber(n);
+	}
+
+	void PolynomialExpander::Visit(node::Function const& f){
+		const auto& expansion = ExpansionOf(f.entry_node());
+		expansions_[f.shared_from_this()] = expansion;
+	}
+
+
+	// arithmetic
+	void PolynomialExpander::Visit(node::SumOperator const& n){
+		const auto& operands = n.Operands();
+		const auto& signs = n.GetSigns();
+
+		Monomials result;
+		for (size_t ii = 0; ii < operands.size(); ++ii)
+			AddTo(result, ExpansionOf(operands[ii]), signs[ii]);
+
+		expansions_[n.shared_from_this()] = std::move(result);
+	}
+
+	void PolynomialExpander::Visit(node::NegateOperator const& n){
+		Monomials result;
+		AddTo(result, ExpansionOf(n.Operand()), false);
+		expansions_[n.shared_from_this()] = std::move(result);
+	}
+
+	void PolynomialExpander::Visit(node::MultOperator const& n){
+		const auto& operands = n.Operands();
+		const auto& mult_or_div = n.GetMultOrDiv(); // true is multiply and false is divide
+
+		Monomials result = Constant(one_);
+		for (size_t ii = 0; ii < operands.size(); ++ii)
+		{
+			const auto& q = ExpansionOf(operands[ii]);
+			if (mult_or_div[ii])
+			{
+				result = Multiply(result, q);
+				continue;
+			}
+
+			// dividing is polynomial only by a constant, so is multiplying by its reciprocal
+			if (!IsConstant(q))
+				NotPolynomial(n);
+			if (q.empty())
+				throw std::runtime_error("dividing by zero while expanding polynomial system");
+
+			auto reciprocal = one_ / q.begin()->second;
+			for (auto& mono : result)
+				mono.second = Product(mono.second, reciprocal);
+		}
+
+		expansions_[n.shared_from_this()] = std::move(result);
+	}
+
+	void PolynomialExpander::Visit(node::IntegerPowerOperator const& n){
+		const auto& base = ExpansionOf(n.Operand());
+		const auto exponent = n.exponent();
+
+		if (exponent >= 0)
+			expansions_[n.shared_from_this()] = Power(base, exponent);
+		else if (IsConstant(base))
+			this->DealWithNumber(n);
+		else
+			NotPolynomial(n);
+	}
+
+	void PolynomialExpander::Visit(node::PowerOperator const& n){
+		const auto& base = ExpansionOf(n.GetBase());
+		const auto& exponent = ExpansionOf(n.GetExponent());
+
+		if (!IsConstant(exponent))
+			NotPolynomial(n);
+
+		if (IsConstant(base))
+		{
+			this->DealWithNumber(n);
+			return;
+		}
+
+		// the same test for an integer exponent as PowerOperator::Degree
+		auto exp_val = n.GetExponent()->Eval<dbl>();
+		const auto tol = 10*std::numeric_limits<double>::epsilon();
+		if (fabs(imag(exp_val)) >= tol || fabs(real(exp_val) - std::round(real(exp_val))) >= tol || std::round(real(exp_val)) < 0)
+			NotPolynomial(n);
+
+		expansions_[n.shared_from_this()] = Power(base, static_cast<int>(std::round(real(exp_val))));
+	}
+
+	void PolynomialExpander::Visit(node::SqrtOperator const& n){
+		this->DealWithConstantOnly(n);
+	}
+
+	void PolynomialExpander::Visit(node::ExpOperator const& n){
+		this->DealWithConstantOnly(n);
+	}
+
+	void PolynomialExpander::Visit(node::LogOperator const& n){
+		this->DealWithConstantOnly(n);
+	}
+
+
+	// the trig operators
+	void PolynomialExpander::Visit(node::SinOperator const& n){
+		this->DealWithConstantOnly(n);
+	}
+
+	void PolynomialExpander::Visit(node::ArcSinOperator const& n){
+		this->DealWithConstantOnly(n);
+	}
+
+	void PolynomialExpander::Visit(node::CosOperator const& n){
+		this->DealWithConstantOnly(n);
+	}
+
+	void PolynomialExpander::Visit(node::ArcCosOperator const& n){
+		this->DealWithConstantOnly(n);
+	}
+
+	void PolynomialExpander::Visit(node::TanOperator const& n){
+		this->DealWithConstantOnly(n);
+	}
+
+	void PolynomialExpander::Visit(node::ArcTanOperator const& n){
+		this->DealWithConstantOnly(n);
+	}
+
+} // namespace bertini
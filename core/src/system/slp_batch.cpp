@@ -0,0 +1,275 @@
+//This file is part of Bertini 2.
+//
+//slp_batch.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//slp_batch.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with slp_batch.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+#include "bertini2/system/slp_batch.hpp"
+
+
+namespace bertini{
+
+	namespace {
+
+		/**
+		 \brief Apply a function of one complex number in every lane, one lane at a time.
+		 */
+		template<typename F>
+		void LaneByLane(unsigned num_lanes, double const* a_re, double const* a_im, double* out_re, double* out_im, F f){
+			for (unsigned k = 0; k<num_lanes; ++k){
+				const dbl result = f(dbl(a_re[k], a_im[k]));
+				out_re[k] = result.real();
+				out_im[k] = result.imag();
+			}
+		}
+
+	}
+
+
+	SLPBatch::SLPBatch(StraightLineProgram const& slp, unsigned num_points) :
+		slp_(slp),
+		num_points_(num_points),
+		stride_((num_points + LaneMultiple - 1) / LaneMultiple * LaneMultiple)
+	{
+		if (slp.packed_instructions_.empty())
+			throw std::runtime_error("making a batch for a straight-line program which was never compiled");
+		if (slp.DifferentiatesInForwardMode())
+			throw std::runtime_error("making a batch for a straight-line program differentiated in forward mode.  batches evaluate programs with their derivatives compiled in");
+
+		// every lane starts as a copy of the program's memory, for the numbers
+		const auto& memory = slp.GetMemory<dbl_complex>();
+		real_.resize(memory.size()*stride_);
+		imag_.resize(memory.size()*stride_);
+		for (size_t loc = 0; loc<memory.size(); ++loc)
+			for (unsigned k = 0; k<stride_; ++k)
+				SetValue(loc, k, memory[loc]);
+	}
+
+
+	void SLPBatch::SetPoint(unsigned k, Vec<dbl> const& variable_values){
+		if (k >= num_points_)
+			throw std::runtime_error("setting a point beyond the end of a batch");
+		if (variable_values.size() != slp_.NumVariables())
+			throw std::runtime_error("number of variable values passed to straight-line program batch doesn't match its number of variables");
+
+		for (unsigned ii = 0; ii<slp_.NumVariables(); ++ii)
+			SetValue(slp_.input_locations_.Variables + ii, k, variable_values(ii));
+	}
+
+
+	void SLPBatch::SetPoint(unsigned k, Vec<dbl> const& variable_values, dbl const& time){
+		if (!slp_.HavePathVariable())
+			throw std::runtime_error("setting the path variable of a batch, but its straight-line program doesn't have one");
+
+		SetPoint(k, variable_values);
+		SetValue(slp_.input_locations_.Time, k, time);
+	}
+
+
+	void SLPBatch::SetPoints(Mat<dbl> const& variable_values){
+		if (variable_values.cols() != num_points_)
+			throw std::runtime_error("number of points passed to straight-line program batch doesn't match its size");
+
+		for (unsigned k = 0; k<num_points_; ++k)
+			SetPoint(k, variable_values.col(k));
+	}
+
+
+	void SLPBatch::SetPoints(Mat<dbl> const& variable_values, dbl const& time){
+		if (variable_values.cols() != num_points_)
+			throw std::runtime_error("number of points passed to straight-line program batch doesn't match its size");
+
+		for (unsigned k = 0; k<num_points_; ++k)
+			SetPoint(k, variable_values.col(k), time);
+	}
+
+
+	void SLPBatch::Eval(){
+		const unsigned L = stride_;
+		double* const re = real_.data();
+		double* const im = imag_.data();
+
+		for (auto i = slp_.packed_instructions_.data(); i->op != PackedOperation::End; ++i){
+			double* const o_re = re + size_t(i->out)*L;
+			double* const o_im = im + size_t(i->out)*L;
+			double const* const a_re = re + size_t(i->in1)*L;
+			double const* const a_im = im + size_t(i->in1)*L;
+
+			// the second and third operands, for the operations which have them.  for IntegerPower, in2 is the exponent.
+			auto b_re = [&]{ return re + size_t(i->in2)*L; };
+			auto b_im = [&]{ return im + size_t(i->in2)*L; };
+			auto c_re = [&]{ return re + size_t(i->in3)*L; };
+			auto c_im = [&]{ return im + size_t(i->in3)*L; };
+
+			switch (i->op){
+
+				case PackedOperation::Add:{
+					double const* br = b_re(); double const* bi = b_im();
+					BERTINI_INDEPENDENT_LANES
+					for (unsigned k = 0; k<L; ++k){
+						const double r = a_re[k] + br[k], s = a_im[k] + bi[k];
+						o_re[k] = r; o_im[k] = s;
+					}
+					break;
+				}
+
+				case PackedOperation::Subtract:{
+					double const* br = b_re(); double const* bi = b_im();
+					BERTINI_INDEPENDENT_LANES
+					for (unsigned k = 0; k<L; ++k){
+						const double r = a_re[k] - br[k], s = a_im[k] - bi[k];
+						o_re[k] = r; o_im[k] = s;
+					}
+					break;
+				}
+
+				case PackedOperation::Multiply:{
+					double const* br = b_re(); double const* bi = b_im();
+					BERTINI_INDEPENDENT_LANES
+					for (unsigned k = 0; k<L; ++k){
+						const double ar = a_re[k], ai = a_im[k], xr = br[k], xi = bi[k];
+						o_re[k] = ar*xr - ai*xi;
+						o_im[k] = ar*xi + ai*xr;
+					}
+					break;
+				}
+
+				case PackedOperation::Divide:{
+					double const* br = b_re(); double const* bi = b_im();
+					BERTINI_INDEPENDENT_LANES
+					for (unsigned k = 0; k<L; ++k){
+						const double ar = a_re[k], ai = a_im[k], xr = br[k], xi = bi[k];
+						const double d = 1/(xr*xr + xi*xi);
+						o_re[k] = (ar*xr + ai*xi)*d;
+						o_im[k] = (ai*xr - ar*xi)*d;
+					}
+					break;
+				}
+
+				case PackedOperation::MultiplyAdd:{
+					double const* br = b_re(); double const* bi = b_im();
+					double const* cr = c_re(); double const* ci = c_im();
+					BERTINI_INDEPENDENT_LANES
+					for (unsigned k = 0; k<L; ++k){
+						const double ar = a_re[k], ai = a_im[k], xr = br[k], xi = bi[k];
+						const double r = ar*xr - ai*xi + cr[k], s = ar*xi + ai*xr + ci[k];
+						o_re[k] = r; o_im[k] = s;
+					}
+					break;
+				}
+
+				case PackedOperation::Square:{
+					BERTINI_INDEPENDENT_LANES
+					for (unsigned k = 0; k<L; ++k){
+						const double ar = a_re[k], ai = a_im[k];
+						o_re[k] = ar*ar - ai*ai;
+						o_im[k] = 2*ar*ai;
+					}
+					break;
+				}
+
+				case PackedOperation::Assign:{
+					BERTINI_INDEPENDENT_LANES
+					for (unsigned k = 0; k<L; ++k){
+						o_re[k] = a_re[k]; o_im[k] = a_im[k];
+					}
+					break;
+				}
+
+				case PackedOperation::Negate:{
+					BERTINI_INDEPENDENT_LANES
+					for (unsigned k = 0; k<L; ++k){
+						o_re[k] = -a_re[k]; o_im[k] = -a_im[k];
+					}
+					break;
+				}
+
+				case PackedOperation::IntegerPower:{
+					const auto exponent = static_cast<std::int32_t>(i->in2);
+					LaneByLane(L, a_re, a_im, o_re, o_im, [exponent](dbl const& x){ return IntegerPower(x, exponent); });
+					break;
+				}
+
+				case PackedOperation::Power:{
+					double const* br = b_re(); double const* bi = b_im();
+					for (unsigned k = 0; k<L; ++k){
+						const dbl result = pow(dbl(a_re[k], a_im[k]), dbl(br[k], bi[k]));
+						o_re[k] = result.real(); o_im[k] = result.imag();
+					}
+					break;
+				}
+
+				case PackedOperation::Sqrt: LaneByLane(L, a_re, a_im, o_re, o_im, [](dbl const& x){ return sqrt(x); }); break;
+				case PackedOperation::Exp:  LaneByLane(L, a_re, a_im, o_re, o_im, [](dbl const& x){ return exp(x); }); break;
+				case PackedOperation::Log:  LaneByLane(L, a_re, a_im, o_re, o_im, [](dbl const& x){ return log(x); }); break;
+				case PackedOperation::Sin:  LaneByLane(L, a_re, a_im, o_re, o_im, [](dbl const& x){ return sin(x); }); break;
+				case PackedOperation::Cos:  LaneByLane(L, a_re, a_im, o_re, o_im, [](dbl const& x){ return cos(x); }); break;
+				case PackedOperation::Tan:  LaneByLane(L, a_re, a_im, o_re, o_im, [](dbl const& x){ return tan(x); }); break;
+				case PackedOperation::Asin: LaneByLane(L, a_re, a_im, o_re, o_im, [](dbl const& x){ return asin(x); }); break;
+				case PackedOperation::Acos: LaneByLane(L, a_re, a_im, o_re, o_im, [](dbl const& x){ return acos(x); }); break;
+				case PackedOperation::Atan: LaneByLane(L, a_re, a_im, o_re, o_im, [](dbl const& x){ return atan(x); }); break;
+
+				case PackedOperation::End:
+					break;
+			}
+		}
+	}
+
+
+	Vec<dbl> SLPBatch::GetFuncVals(unsigned k) const{
+		Vec<dbl> result(slp_.NumTotalFunctions());
+		GetFuncValsInPlace(k, result);
+		return result;
+	}
+
+
+	Mat<dbl> SLPBatch::GetJacobian(unsigned k) const{
+		Mat<dbl> result(slp_.NumTotalFunctions(), slp_.NumVariables());
+		GetJacobianInPlace(k, result);
+		return result;
+	}
+
+
+	Vec<dbl> SLPBatch::GetTimeDeriv(unsigned k) const{
+		Vec<dbl> result(slp_.NumTotalFunctions());
+		GetTimeDerivInPlace(k, result);
+		return result;
+	}
+
+
+	std::vector<Vec<dbl>> SLPBatch::GetFuncVals() const{
+		std::vector<Vec<dbl>> result;
+		result.reserve(num_points_);
+		for (unsigned k = 0; k<num_points_; ++k)
+			result.push_back(GetFuncVals(k));
+		return result;
+	}
+
+
+	std::vector<Mat<dbl>> SLPBatch::GetJacobians() const{
+		std::vector<Mat<dbl>> result;
+		result.reserve(num_points_);
+		for (unsigned k = 0; k<num_points_; ++k)
+			result.push_back(GetJacobian(k));
+		return result;
+	}
+
+} // namespace bertini
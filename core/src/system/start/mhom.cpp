@@ -51,9 +51,6 @@ namespace bertini
 
 
 			CreateDegreeMatrix(s);
-
-
-			GenerateValidPartitions(s);
 			
 			CopyVariableStructure(s);
 			
@@ -115,19 +112,167 @@ namespace bertini
 
 
 			##Details:
-					If we have all valid partitions of the degree matrix, we can find the total number of start points. This is done by 
-					multiply all entries of a partition and adding that to all other products from all other partitions. 
+					The number of start points is the sum over all valid partitions of the degree matrix of the product of the degrees 
+					they choose.  This is counted without enumerating the partitions, by CompletionCounts. 
 		*/
 		unsigned long long MHomogeneous::NumStartPoints() const
 		{
-			unsigned long long num_start_points = 0;
-			for(int ii = 0; ii < valid_partitions_.size(); ii++)
-			{ 
-    			num_start_points += NumStartPointsForPartition(valid_partitions_[ii]);
+			if (degree_matrix_.rows()==0)
+				return 0;
+
+			auto remaining = GroupSizes();
+			return CompletionCounts(remaining, 0).second;
+		}
+
+
+		unsigned long long MHomogeneous::NumPartitions() const
+		{
+			if (degree_matrix_.rows()==0)
+				return 0;
+
+			auto remaining = GroupSizes();
+			return CompletionCounts(remaining, 0).first;
+		}
+
+
+		std::vector<int> MHomogeneous::GroupSizes() const
+		{
+			std::vector<int> sizes;
+			for (auto const& cols : variable_cols_)
+				sizes.push_back(static_cast<int>(cols.size()));
+			return sizes;
+		}
+
+
+		/**
+			\brief Function to count the completions of a partial partition of the degree matrix. 
+
+			## Input: 
+				remaining: How many more times each variable group (column) may be chosen.
+				row: The first function (row) not yet assigned a variable group.
+
+
+			## Output:
+					The number of valid ways to assign variable groups to the rest of the rows, and the number of start points they have.
+
+
+			##Details:
+					Each row may choose a column with a non-zero degree, if that column may still be chosen.  The counts depend only on 
+					the numbers remaining, since the row is the number of functions minus their sum, so they are remembered in 
+					completion_counts_, and the partial partitions sharing them are counted only once.  Counting all partitions this way 
+					visits at most one entry per possible vector of remaining numbers, rather than one per partition. 
+		*/
+		std::pair<unsigned long long, unsigned long long> MHomogeneous::CompletionCounts(std::vector<int> & remaining, int row) const
+		{
+			if (row == degree_matrix_.rows())
+				return {1, 1};
+
+			auto found = completion_counts_.find(remaining);
+			if (found != completion_counts_.end())
+				return found->second;
+
+			std::pair<unsigned long long, unsigned long long> counts{0, 0};
+			for (int col = 0; col < degree_matrix_.cols(); ++col)
+			{
+				if (degree_matrix_(row,col) == 0 || remaining[col] == 0)
+					continue;
+
+				--remaining[col];
+				auto completions = CompletionCounts(remaining, row+1);
+				++remaining[col];
+
+				counts.first += completions.first;
+				counts.second += degree_matrix_(row,col) * completions.second;
+			}
+
+			completion_counts_.emplace(remaining, counts);
+			return counts;
+		}
+
+
+		Vec<int> MHomogeneous::Partition(unsigned long long index) const
+		{
+			if (index >= NumPartitions())
+				throw std::out_of_range("attempted to get mhom partition, but index not valid");
+
+			auto remaining = GroupSizes();
+			Vec<int> partition(degree_matrix_.rows());
+			for (int row = 0; row < degree_matrix_.rows(); ++row)
+			{
+				for (int col = 0; col < degree_matrix_.cols(); ++col)
+				{
+					if (degree_matrix_(row,col) == 0 || remaining[col] == 0)
+						continue;
+
+					--remaining[col];
+					auto num_completions = CompletionCounts(remaining, row+1).first;
+					if (index < num_completions)
+					{
+						partition(row) = col;
+						break;
+					}
+					++remaining[col];
+					index -= num_completions;
+				}
 			}
-			return num_start_points;
+			return partition;
 		}
 
+
+		/**
+			\brief Function to find the partition and linear factors of a start point. 
+
+			## Input: 
+				index: The index of the start point.
+				partition: Set to the partition of the start point.
+				subscript: Set to which linear factor the start point takes from each function, in its variable group.
+
+
+			## Output:
+					None.
+
+
+			##Details:
+					Start points are ordered by partition, from left to right, and then by subscript, with the first function's factor 
+					changing fastest.  The start points of all partitions sharing their first few columns are consecutive, and there 
+					are as many of them as the product of the degrees of those columns times the number of start points of the 
+					completions, so the columns are found one row at a time by skipping past the others. 
+		*/
+		void MHomogeneous::LocateStartPoint(unsigned long long index, Vec<int> & partition, std::vector<size_t> & subscript) const
+		{
+			if (index >= NumStartPoints())
+				throw std::out_of_range("attempted to generate mhom start point, but index not valid");
+
+			auto remaining = GroupSizes();
+			partition.resize(degree_matrix_.rows());
+			std::vector<size_t> dim_vector(degree_matrix_.rows());
+
+			unsigned long long prefix_product = 1;
+			for (int row = 0; row < degree_matrix_.rows(); ++row)
+			{
+				for (int col = 0; col < degree_matrix_.cols(); ++col)
+				{
+					if (degree_matrix_(row,col) == 0 || remaining[col] == 0)
+						continue;
+
+					--remaining[col];
+					auto num_points = prefix_product * degree_matrix_(row,col) * CompletionCounts(remaining, row+1).second;
+					if (index < num_points)
+					{
+						partition(row) = col;
+						break;
+					}
+					++remaining[col];
+					index -= num_points;
+				}
+				dim_vector[row] = degree_matrix_(row, partition(row));
+				prefix_product *= dim_vector[row];
+			}
+
+			subscript = IndexToSubscript<size_t>(index, dim_vector);
+		}
+
+
 		/**
 			\brief Function to create the degree matrix for a multi homogeneous start system.
 
@@ -201,218 +346,69 @@ namespace bertini
 
 		}
 
-		/**
-			\brief Function to find all valid partitions inside of a degree matrix. 
-
-			## Input: 
-				target_system: System that we wish to solve. Using this we can know total number of variables, functions, and variable groups,
-				 by using the systems member functions. 
-
-
-			## Output:
-					None: This is purely used inside of a constructor. 
-
-
-			##Details:
-					TODO: Fill this.
-		*/
-		void MHomogeneous::GenerateValidPartitions(System const& target_system)
+		template<typename T>
+		void MHomogeneous::GenerateStartPointT(Vec<T>& start_point, unsigned long long index) const
 		{
-			int row = 0;
-			int old_current_part_row = -1;
-			int bad_choice = 0;
-			Vec<int> current_partition = -1*Vec<int>::Ones(target_system.NumFunctions());
-			Vec<int> variable_group_counter = Vec<int>::Zero(target_system.NumTotalVariableGroups());
-
-			auto size_of_each_var_gp = target_system.VariableGroupSizes(); //K
-			
+			Vec<int> partition;
+			std::vector<size_t> subscript;
+			LocateStartPoint(index, partition, subscript);
 
+			// The linear system is block diagonal, one block for each variable group, since each linear factor involves only the variables of its group.
+			size_t num_grouped_variables = NumNaturalVariables() - NumUngroupedVariables();
+			start_point.resize(num_grouped_variables);
 
-
-
-			for(int ii = 0; ii < target_system.NumTotalVariableGroups(); ++ii)
-			{
-				variable_group_counter[ii] = size_of_each_var_gp[ii];
-			}			    
-			// std::cout << "variable_group_counter is " << std::endl;
-			// std::cout << variable_group_counter << std::endl;		
-			  while (row > -1)  // Algorithm will move up and down rows, kicking out to row=-1 at end
-			  {
-//			  	 std::cout << "current_partition before is " << std::endl;
-//			  	 std::cout <<  current_partition << std::endl;
-			    old_current_part_row = current_partition[row];  //Hang on to previous choice of column for this row, in case we are done with this row.
-			    current_partition[row] = ChooseColumnInRow(target_system,variable_group_counter,row,current_partition[row]);  //Pick next column (var gp) for the current row (func)
-//				  std::cout << "current_partition after is " << std::endl;
-//				  std::cout <<  current_partition << std::endl;
-
-			    //ChooseColumnInRow() will make this happen if it runs into col being equal to system.NumVariables()!
-			    if (current_partition[row] == target_system.NumTotalVariableGroups()) // means we have exhausted all good columns for the current row, so we go back up a row
-			    { //no choices for current row
-			      row = row - 1;  //go back up a row
-			      bad_choice = 1;
-			    }
-			    else  //found a good choice of column for this row!
-			    {
-			      	row = row + 1;  //move on to next row!
-			      	if (row < target_system.NumFunctions())
-			        	current_partition[row] = -1; //This allows us to consider all possible columns from left to right.
-			        	//since we are starting a new row, we start with the left-most entry (ChooseColumnInRow() first increments col)
-			    }
-			     
-			    if((row == target_system.NumFunctions()) && (!bad_choice))
-			    {
-			    	// std::cout << "Good partition!!!!" << std::endl;
-			    	// std::cout << current_partition << std::endl;
-			    	valid_partitions_.push_back(current_partition);
-			     	row = row - 1; //put the counter back on the last row to try to move to the next column
-			    }
-			    bad_choice=0;
-			  }
-		}
-
-
-		/**
-			\brief Function to find a valid column for a given row. 
-
-			## Input: 
-				target_system: System that we wish to solve. Using this we can know total number of variables, functions, and variable groups,
-				 by using the systems member functions. 
-				variable_group_counter: This vector of integers will keep track of how many times we can pick from a column.
-				row: This is the row in GenerateValidPartitions(). 
-				column: This comes from current_partition[row] in GenerateValidPartitions(). Because of this we will walk through the 
-				degree matrix from left to right.  
-
-
-			## Output:
-					int col: Returns the column that we have chosen for a given row. 
-
-
-			##Details:
-					Given a row, we search for a valid column from left to right. Since column is defaulted to -1 we will start with 
-					col = 0. Variaable_group_counter will be incremented or decremented if we are coming off a good partition, or have found a 
-					good column. 
-
-		*/
-		int MHomogeneous::ChooseColumnInRow(System const& target_system,Vec<int>& variable_group_counter, int row, int column)
-		{
-			int col = column + 1;  //We assume the current column is done and we need to increment by at least one. 
-			int done = 0;		   //Note: we started at -1 so this is ok
-
-			if (col - 1 > -1)
-			{ //If we are coming off of a good partition, we need to remember to increment var_gp_ctr, 
-			  //this holds how many we have chosen in a column as we move away from that column.
-			  variable_group_counter[col - 1] = variable_group_counter[col - 1] + 1;// var_gp_ctr is incremented because if(var_gp_ctr[col] == 0) -> bad choice
-			} 
-			while (!done)
+			for (int group = 0; group < static_cast<int>(variable_cols_.size()); ++group)
 			{
-				/*We have reached the end of the degree matrix. 
-				Return and (current_partition[row] == target_system.NumTotalVariableGroups()) in GenerateValidPartitions() gets executed.
-			    */
-			    if (col == target_system.NumTotalVariableGroups())
-			    {
-			    	done = 1; //got to the right end of the degree matrix!
-			    } 
-			   
-			    else
-			    {
-			    	/*
-			    		If degree_matrix(row,col) == 0, we know that this is not a valid partition choice. We cannot pick 0 linears. 
-						If variable_group_counter[col] == 0, we have picked the maximum number of choices for this column.
-			    	*/
-			        if ((degree_matrix_(row,col) == 0) || (variable_group_counter[col] == 0))  //bad choice, either way!
-			        {	
-			        	col = col + 1;
-			        }
-			        else  
-			        {	/*means degree_matrix[row][col] > 0, so we have a possible valid choice,
-			        	 col <= NumTotalVariableGroups, we have not ran out of the matrix,
-			        	  and variable_group_counter[col] > 0 --> we still have choices for this column! Good column!
-			            */
-			            done = 1;
-			            variable_group_counter[col] = variable_group_counter[col] - 1;
-			        }
-			    }
+				auto const& block = BlockSolution<T>(group, partition, subscript);
+				auto const& cols = variable_cols_[group];
+				for (int jj = 0; jj < cols.size(); ++jj)
+					start_point(cols[jj]) = block(jj);
 			}
-			return col;
-
 		}
 
 
-		
 		template<typename T>
-		void MHomogeneous::GenerateStartPointT(Vec<T>& start_point, unsigned long long index) const
+		Vec<T> const& MHomogeneous::BlockSolution(int group, Vec<int> const& partition, std::vector<size_t> const& subscript) const
 		{
-			if(valid_partitions_.size() <= 0)
-				throw std::runtime_error("Trying to generate MHom start points before determining valid partitions.");
-			
-			
-			
-			// First, determine which partition we are looking through
-			int counter = 0;
-			int partition_ii = -1;
-			for (int ii = 0; ii < valid_partitions_.size(); ++ii)
+			auto& cache = std::get<std::map<std::vector<size_t>, Vec<T>>>(block_solutions_);
+
+			// multiple precision solutions are only good at the precision they were computed in
+			if (std::is_same<T, mpfr_complex>::value && block_solutions_precision_ != DefaultPrecision())
 			{
-				counter += NumStartPointsForPartition(valid_partitions_[ii]);
-				
-				if(index < counter)
-				{
-					partition_ii = ii;
-					counter -= NumStartPointsForPartition(valid_partitions_[ii]);
-					index -= counter;
-					break;
-				}
+				cache.clear();
+				block_solutions_precision_ = DefaultPrecision();
 			}
-			
-			if(partition_ii == -1)
-				throw std::runtime_error("attempted to generate mhom start point, but index not valid");
-			
-			
-			// Using partition ii, create dimension vector.  Then find the subscript.
-			auto partition = valid_partitions_[partition_ii];
-			std::vector<size_t> dim_vector(partition.size());
+
+			std::vector<size_t> key{static_cast<size_t>(group)};
 			for (int ii = 0; ii < partition.size(); ++ii)
-			{
-				dim_vector[ii] = degree_matrix_(ii, partition(ii));
-			}
-			
-			std::vector<size_t> subscript = IndexToSubscript<size_t>(index, dim_vector);
-			
-			
-			
-			
-			
-			
-			// Create a linear system to solve.
-			size_t num_grouped_variables = NumNaturalVariables() - NumUngroupedVariables();
-			Mat<T> A(partition.size(), num_grouped_variables);
-			Vec<T> v(num_grouped_variables);
-			Vec<T> b(partition.size());
-			
-			for(int ii = 0; ii < partition.size(); ++ii)
-			{
-				v.setZero();
-				std::vector<size_t> cols = variable_cols_[partition[ii]];
-				auto coeff = linprod_matrix_(ii,partition[ii])->GetCoeffs<T>(subscript[ii]);
-				for(int jj = 0; jj < cols.size(); ++jj)
+				if (partition(ii) == group)
 				{
-					v(cols[jj]) = coeff[jj];
+					key.push_back(ii);
+					key.push_back(subscript[ii]);
 				}
-				
-				A.row(ii) = v;
-				b(ii) = -coeff[cols.size()];
+
+			auto found = cache.find(key);
+			if (found != cache.end())
+				return found->second;
+
+			if (cache.size() >= MaxCachedBlocks)
+				cache.clear();
+
+			// one row for each function assigned to the group, and there are as many of them as variables in the group
+			const auto num_vars = variable_cols_[group].size();
+			Mat<T> A(num_vars, num_vars);
+			Vec<T> b(num_vars);
+			for (size_t kk = 0; kk < num_vars; ++kk)
+			{
+				const auto row = key[2*kk+1];
+				auto coeff = linprod_matrix_(row,group)->template GetCoeffs<T>(key[2*kk+2]);
+				for (size_t jj = 0; jj < num_vars; ++jj)
+					A(kk,jj) = coeff(jj);
+				b(kk) = -coeff(num_vars);
 			}
-			
-			start_point = A.partialPivLu().solve(b);
-			
-			
-			var_groups_[0][0]->set_current_value(start_point(0));
-			var_groups_[0][1]->set_current_value(start_point(1));
-			
-			std::shared_ptr<node::Node> f = Function(0);
-			// !!! superfluous line?
-			
-			
 
+			Vec<T> solution = A.partialPivLu().solve(b);
+			return cache.emplace(std::move(key), std::move(solution)).first->second;
 		}
 		
 		
@@ -126,6 +126,102 @@ namespace bertini {
 			return start_point;
 		}
 
+		std::vector<dbl> TotalDegree::StartFunctionRoots(dbl, size_t index) const
+		{
+			const auto degree = static_cast<double>(degrees_[index]);
+			const auto two_pi = 2*std::acos(-1.0);
+			const dbl root = pow(random_values_[index]->Eval<dbl>(), 1.0 / degree);
+
+			std::vector<dbl> roots(degrees_[index]);
+			for (size_t jj = 0; jj < roots.size(); ++jj)
+				roots[jj] = std::polar(1.0, two_pi * static_cast<double>(jj) / degree) * root;
+			return roots;
+		}
+
+
+		std::vector<mpfr_complex> TotalDegree::StartFunctionRoots(mpfr_complex, size_t index) const
+		{
+			using bertini::DefaultPrecision;
+
+			auto one = mpfr_float(1);
+			mpfr_complex two_i_pi = mpfr_complex(0,2) * acos( mpfr_float(-1) );
+			mpfr_complex root = pow(random_values_[index]->Eval<mpfr_complex>(), one / degrees_[index]);
+			Precision(root,DefaultPrecision());
+
+			std::vector<mpfr_complex> roots(degrees_[index]);
+			for (size_t jj = 0; jj < roots.size(); ++jj)
+			{
+				mpfr_complex a = exp( (two_i_pi * jj) / degrees_[index]);
+				Precision(a,DefaultPrecision());
+				roots[jj] = a*root;
+			}
+			return roots;
+		}
+
+
+		/**
+		The start points are the rows of the block, and its columns are filled one at a time, so each is written contiguously.  The roots of each start function are computed once, and the root a point takes for variable ii is digit ii of its index in mixed radix, with the degrees as the radices and the first digit changing fastest, as in IndexToSubscript.  So walking down a column, the digit stays the same for as many points as the product of the earlier degrees, and then moves on to the next root.
+		*/
+		template<typename T>
+		void TotalDegree::GenerateStartPointsT(StartPointBlock<T> & block) const
+		{
+			auto& coordinates = block.Coordinates();
+			coordinates.resize(block.Size(), NumVariables());
+			if (block.Size()==0)
+				return;
+
+			unsigned offset = 0;
+			if (IsPatched())
+			{
+				for (unsigned long long pp = 0; pp < block.Size(); ++pp)
+					coordinates(pp,0) = T(1);
+				offset = 1;
+			}
+
+			unsigned long long stride = 1; // the number of consecutive points sharing a digit
+			for (size_t ii = 0; ii < NumNaturalVariables(); ++ii)
+			{
+				const auto roots = StartFunctionRoots(T(), ii);
+				const unsigned long long degree = degrees_[ii];
+
+				unsigned long long digit = (block.First() / stride) % degree;
+				unsigned long long repeat = block.First() % stride;
+				for (unsigned long long pp = 0; pp < block.Size(); ++pp)
+				{
+					coordinates(pp,ii+offset) = roots[digit];
+					if (++repeat == stride)
+					{
+						repeat = 0;
+						if (++digit == degree)
+							digit = 0;
+					}
+				}
+
+				stride *= degree;
+			}
+
+			if (IsPatched())
+				for (unsigned long long pp = 0; pp < block.Size(); ++pp)
+				{
+					Vec<T> start_point = coordinates.row(pp).transpose();
+					RescalePointToFitPatchInPlace(start_point);
+					coordinates.row(pp) = start_point.transpose();
+				}
+		}
+
+
+		void TotalDegree::GenerateStartPoints(StartPointBlock<dbl> & block) const
+		{
+			GenerateStartPointsT(block);
+		}
+
+
+		void TotalDegree::GenerateStartPoints(StartPointBlock<mpfr_complex> & block) const
+		{
+			GenerateStartPointsT(block);
+		}
+
+
 		inline
 		TotalDegree operator*(TotalDegree td, std::shared_ptr<node::Node> const& n)
 		{
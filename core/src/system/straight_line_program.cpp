@@ -26,6 +26,13 @@
 #include "bertini2/system/straight_line_program.hpp"
 #include "bertini2/system/system.hpp"
 
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <tuple>
+
 
 
 // SLP Stuff
@@ -33,34 +40,109 @@ namespace bertini{
 
 
 	// the constructor
-	StraightLineProgram::StraightLineProgram(System const& sys){
-		SLPCompiler compiler;
+	StraightLineProgram::StraightLineProgram(System const& sys, bool optimize, bool differentiate){
+		SLPCompiler compiler(optimize, differentiate);
 
 		*this = compiler.Compile(sys);
 	}
 
 	void StraightLineProgram::precision(unsigned new_precision) const{
-		if (new_precision==DoublePrecision()){
-			// nothing
+		if (new_precision==precision_)
+			return;
+
+		auto& program_memory = std::get<ProgramMemory<mpfr_complex>>(memory_);
+		auto& mem = program_memory.values;
+
+		// park the memory at the current precision, numbers, tangents and all, and take out the one at the new precision
+		auto& parked = parked_memory_[precision_];
+		parked.values.swap(mem);
+		parked.tangents.swap(program_memory.tangents);
+		auto const& old_memory = parked.values;
+
+		auto& new_memory = parked_memory_[new_precision];
+		if (new_memory.values.size()!=old_memory.size())
+		{
+			// first time at this precision, so make the memory, with the numbers rounded into it
+			auto previous_default = DefaultPrecision();
+			DefaultPrecision(new_precision);
+			new_memory.values = std::vector<mpfr_complex>(old_memory.size());
+			DefaultPrecision(previous_default);
+
+			auto numbers = NumbersAtPrecision(new_precision);
+			for (size_t ii = 0; ii < true_values_of_numbers_.size(); ++ii)
+				new_memory.values[true_values_of_numbers_[ii].second] = (*numbers)[ii];
 		}
-		else{
-			auto& mem = std::get<std::vector<mpfr_complex>>(memory_);
+		mem.swap(new_memory.values);
+		// the tangents hold only unit vectors for the inputs and the tangents of results, which the next forward mode evaluation overwrites.  the first time at this precision there are none, and they are made when next evaluating in forward mode
+		program_memory.tangents.swap(new_memory.tangents);
 
+		// the variables and time are all that's carried over
+		const auto num_inputs = number_of_.Variables;
+		for (size_t ii = 0; ii < num_inputs; ++ii)
+		{
+			mem[input_locations_.Variables+ii] = old_memory[input_locations_.Variables+ii];
+			Precision(mem[input_locations_.Variables+ii], new_precision);
+		}
+		if (has_path_variable_)
+		{
+			mem[input_locations_.Time] = old_memory[input_locations_.Time];
+			Precision(mem[input_locations_.Time], new_precision);
+		}
+
+		program_memory.is_evaluated = false;
+		program_memory.tangents_evaluated = false;
+		precision_ = new_precision;
+	}
 
 
-			for (auto& p: true_values_of_numbers_)
+	std::shared_ptr<const std::vector<mpfr_complex>> StraightLineProgram::NumbersAtPrecision(unsigned precision) const
+	{
+		std::lock_guard<std::mutex> lock(numbers_at_precision_->mutex);
+
+		auto& numbers = numbers_at_precision_->values[precision];
+		if (!numbers)
+		{
+			// the number nodes are those of the system's tree, which is kept at the precision of the system, and may be evaluated by other threads meanwhile.  so round copies of them, whose numbers are evaluated fresh from their true values.  numbers folded by optimization are expressions, and copying them all at once keeps what they share shared.
+			std::vector<std::shared_ptr<node::Node>> copies;
 			{
-				auto& n = std::get<Nd>(p);
-				auto& loc = std::get<size_t>(p);
+				std::vector<std::shared_ptr<node::Node>> originals;
+				originals.reserve(true_values_of_numbers_.size());
+				for (auto const& p: true_values_of_numbers_)
+					originals.push_back(std::const_pointer_cast<node::Node>(std::get<Nd>(p)));
+
+				std::stringstream ss;
+				{
+					boost::archive::text_oarchive oa(ss);
+					oa << originals;
+				}
+				boost::archive::text_iarchive ia(ss);
+				ia >> copies;
+			}
+
+			// the numbers are evaluated at the default precision, so temporarily make it the requested one
+			auto previous_default = DefaultPrecision();
+			DefaultPrecision(precision);
 
-				mem[loc] = n->Eval<mpfr_complex>();
+			auto rounded = std::make_shared<std::vector<mpfr_complex>>();
+			rounded->reserve(copies.size());
+			for (auto const& n: copies)
+			{
+				rounded->push_back(n->Eval<mpfr_complex>());
+				Precision(rounded->back(), precision);
 			}
 
-			for (auto& n : mem)
-				Precision(n, new_precision);
+			DefaultPrecision(previous_default);
+			numbers = rounded;
 		}
+		return numbers;
+	}
 
 
+	size_t StraightLineProgram::NumInstructions() const{
+		size_t num_instructions{0};
+		for (size_t ii = 0; ii<instructions_.size(); ++num_instructions)
+			ii += IsUnary(static_cast<Operation>(instructions_[ii])) ? 3 : 4;
+		return num_instructions;
 	}
 
 
@@ -108,16 +190,196 @@ namespace bertini{
 	template<typename NumT>
 	void StraightLineProgram::CopyNumbersIntoMemory() const
 	{
+		// the numbers are evaluated at the default precision, so temporarily make it that of this SLP
+		auto previous_default = DefaultPrecision();
+		if (std::is_same<NumT,mpfr_complex>::value)
+			DefaultPrecision(this->precision_);
+
+		auto& memory = GetMemory<NumT>();
 		for (auto const& x: true_values_of_numbers_){
-			GetMemory<NumT>()[x.second] = (x.first)->Eval<NumT>();
-			if (std::is_same<NumT,mpfr_complex>::value)
-				Precision(GetMemory<NumT>()[x.second], this->precision_);
+			(x.first)->Reset();
+			memory[x.second] = (x.first)->Eval<NumT>();
 		}
+
+		if (std::is_same<NumT,mpfr_complex>::value)
+			for (auto& x : memory)
+				Precision(x, this->precision_);
+
+		DefaultPrecision(previous_default);
 	}
 
 	template void StraightLineProgram::CopyNumbersIntoMemory<dbl_complex>() const;
 	template void StraightLineProgram::CopyNumbersIntoMemory<mpfr_complex>() const;
 
+
+
+	namespace {
+
+		PackedOperation PackedOperationFor(Operation op)
+		{
+			switch (op)
+			{
+				case Add:      return PackedOperation::Add;
+				case Subtract: return PackedOperation::Subtract;
+				case Multiply: return PackedOperation::Multiply;
+				case Divide:   return PackedOperation::Divide;
+				case Power:    return PackedOperation::Power;
+				case Assign:   return PackedOperation::Assign;
+				case Negate:   return PackedOperation::Negate;
+				case Sqrt:     return PackedOperation::Sqrt;
+				case Exp:      return PackedOperation::Exp;
+				case Log:      return PackedOperation::Log;
+				case Sin:      return PackedOperation::Sin;
+				case Cos:      return PackedOperation::Cos;
+				case Tan:      return PackedOperation::Tan;
+				case Asin:     return PackedOperation::Asin;
+				case Acos:     return PackedOperation::Acos;
+				case Atan:     return PackedOperation::Atan;
+			}
+			throw std::runtime_error("unknown operation while packing straight-line program");
+		}
+	}
+
+
+
+	void StraightLineProgram::Pack(){
+		const auto& memory = GetMemory<dbl_complex>();
+		if (memory.size() > std::numeric_limits<std::uint32_t>::max())
+			throw std::runtime_error("straight-line program too large to pack.  its memory must be addressable with 32 bits");
+
+		auto location = [](size_t loc){ return static_cast<std::uint32_t>(loc); };
+
+		struct Unpacked{
+			Operation op;
+			size_t in1, in2, out;
+		};
+
+		std::vector<Unpacked> instructions;
+		for (size_t ii = 0; ii<instructions_.size(); ){
+			auto op = static_cast<Operation>(instructions_[ii]);
+			if (IsUnary(op)){
+				instructions.push_back({op, instructions_[ii+1], 0, instructions_[ii+2]});
+				ii += 3;
+			}
+			else{
+				instructions.push_back({op, instructions_[ii+1], instructions_[ii+2], instructions_[ii+3]});
+				ii += 4;
+			}
+		}
+		const auto num_instructions = instructions.size();
+
+
+		const auto end_of_outputs = EndOfOutputs();
+		auto is_output = [&](size_t loc){ return loc >= output_locations_.Functions && loc < end_of_outputs; };
+
+
+		// the small integer numbers, which as exponents can be done by repeated multiplication
+		std::map<size_t, std::int32_t> integers;
+		for (auto const& x : true_values_of_numbers_)
+			if (std::dynamic_pointer_cast<const node::Integer>(x.first) && std::abs(memory[x.second].real()) <= (1 << 16))
+				integers[x.second] = static_cast<std::int32_t>(memory[x.second].real());
+
+
+		// how many times the result of each instruction is read.  locations can be reused for several results, so count the reads up to the next write.
+		std::vector<size_t> reads(memory.size(), 0);
+		std::vector<size_t> reads_of_result(num_instructions, 0);
+		for (auto kk = num_instructions; kk-- > 0; ){
+			auto const& ins = instructions[kk];
+			reads_of_result[kk] = reads[ins.out];
+			reads[ins.out] = 0;
+			++reads[ins.in1];
+			if (!IsUnary(ins.op))
+				++reads[ins.in2];
+		}
+
+
+		packed_instructions_.clear();
+		packed_instructions_.reserve(num_instructions+1);
+		for (size_t kk = 0; kk<num_instructions; ++kk){
+			auto const& ins = instructions[kk];
+
+			// a product, only used by the sum following it
+			if (ins.op==Multiply && kk+1<num_instructions && instructions[kk+1].op==Add && !is_output(ins.out) && reads_of_result[kk]==1){
+				auto const& next = instructions[kk+1];
+				if ((next.in1==ins.out) != (next.in2==ins.out)){
+					auto addend = next.in1==ins.out ? next.in2 : next.in1;
+					packed_instructions_.push_back({PackedOperation::MultiplyAdd, location(ins.in1), location(ins.in2), location(addend), location(next.out)});
+					++kk;
+					continue;
+				}
+			}
+
+			if (ins.op==Power){
+				auto exponent = integers.find(ins.in2);
+				if (exponent!=integers.end()){
+					if (exponent->second==2)
+						packed_instructions_.push_back({PackedOperation::Square, location(ins.in1), 0, 0, location(ins.out)});
+					else
+						packed_instructions_.push_back({PackedOperation::IntegerPower, location(ins.in1), static_cast<std::uint32_t>(exponent->second), 0, location(ins.out)});
+					continue;
+				}
+			}
+
+			packed_instructions_.push_back({PackedOperationFor(ins.op), location(ins.in1), IsUnary(ins.op) ? 0 : location(ins.in2), 0, location(ins.out)});
+		}
+
+		packed_instructions_.push_back({PackedOperation::End, 0, 0, 0, 0});
+	}
+
+
+	size_t StraightLineProgram::EndOfOutputs() const{
+		const auto num_rows = NumTotalFunctions();
+		if (forward_mode_)
+			return output_locations_.Functions + num_rows;
+		return HavePathVariable() ? output_locations_.TimeDeriv + num_rows : output_locations_.Jacobian + num_rows*number_of_.Variables;
+	}
+
+
+	std::uint64_t StraightLineProgram::Fingerprint() const{
+		// 64-bit FNV-1a, over everything the generated code depends on
+		std::uint64_t hash = 14695981039346656037ull;
+		auto mix = [&hash](std::uint64_t x){
+			for (int ii = 0; ii<8; ++ii, x >>= 8){
+				hash ^= x & 0xff;
+				hash *= 1099511628211ull;
+			}
+		};
+
+		mix(MemorySize());
+		mix(has_path_variable_);
+		for (auto x : {number_of_.Functions, number_of_.Patches, number_of_.Variables, number_of_.Jacobian, number_of_.TimeDeriv,
+		               input_locations_.Variables, input_locations_.Time,
+		               output_locations_.Functions, output_locations_.Variables, output_locations_.Jacobian, output_locations_.TimeDeriv})
+			mix(x);
+
+		std::vector<size_t> number_locations;
+		for (auto const& x : true_values_of_numbers_)
+			number_locations.push_back(x.second);
+		std::sort(number_locations.begin(), number_locations.end());
+		for (auto loc : number_locations)
+			mix(loc);
+
+		for (auto const& i : packed_instructions_){
+			mix(static_cast<std::uint32_t>(i.op));
+			mix(i.in1);
+			mix(i.in2);
+			mix(i.in3);
+			mix(i.out);
+		}
+
+		return hash;
+	}
+
+
+	void StraightLineProgram::UseCompiled(CompiledSLP const& compiled){
+		if (compiled.Fingerprint != Fingerprint()){
+			std::stringstream err_msg;
+			err_msg << "compiled straight-line program " << compiled.Name << " was generated for a program of a different structure than this one";
+			throw std::runtime_error(err_msg.str());
+		}
+		compiled_ = &compiled;
+	}
+
 }
 
 
@@ -131,8 +393,37 @@ namespace bertini{
 	using SLP = StraightLineProgram;
 
 
+	size_t SLPCompiler::LocationOf(std::shared_ptr<node::Node> const& n){
+		auto found = this->locations_encountered_symbols_.find(n);
+		if (found != this->locations_encountered_symbols_.end())
+			return found->second;
+
+		n->Accept(*this); // think of calling Compile(n)
+
+		found = this->locations_encountered_symbols_.find(n);
+		if (found == this->locations_encountered_symbols_.end())
+		{
+			std::stringstream err_msg;
+			err_msg << "unable to compile node " << *n << " into a straight-line program.  its type is not supported.";
+			throw std::runtime_error(err_msg.str());
+		}
+		return found->second;
+	}
+
+
+	size_t SLPCompiler::LocationOfInteger(int value){
+		// this code sucks.  really, there should be a bank of integers that we pull from, instead of many copies of the same integer.
+		auto n = std::make_shared<node::Integer>(value);
+		this->DealWithNumber(*n);
+		return locations_encountered_symbols_[n];
+	}
+
+
 	void SLPCompiler::Visit(node::Variable const& n){
-		std::cout << "visiting variable " << n << " at location " << locations_encountered_symbols_[n.shared_from_this()] << std::endl;
+		// all the variables of the system, and the path variable, are put in memory before compiling the functions.  so this one is foreign to the system.
+		std::stringstream err_msg;
+		err_msg << "encountered variable " << n << " while compiling straight-line program, but it is not a variable of the system.  implicit parameters are not supported.";
+		throw std::runtime_error(err_msg.str());
 	}
 
 
@@ -149,18 +440,26 @@ namespace bertini{
 		this->DealWithNumber(n);
 	}
 
+	void SLPCompiler::Visit(node::special_number::Pi const& n){
+		this->DealWithNumber(n);
+	}
+
+	void SLPCompiler::Visit(node::special_number::E const& n){
+		this->DealWithNumber(n);
+	}
+
 
 
 
 
 	void SLPCompiler::Visit(node::Jacobian const& n){
-		throw std::runtime_error("unimplemented visit to node of type Jacobian");
+		throw std::runtime_error("unimplemented visit to node of type Jacobian.  straight-line programs are compiled from the derivatives of a system, not its Jacobian nodes");
 
 
 	}
 
 	void SLPCompiler::Visit(node::Differential const& n){
-		throw std::runtime_error("unimplemented visit to node of type Differential");
+		throw std::runtime_error("unimplemented visit to node of type Differential.  straight-line programs are compiled from the derivatives of a system, not its Jacobian nodes");
 	}
 
 
@@ -168,26 +467,8 @@ namespace bertini{
 
 
 	void SLPCompiler::Visit(node::Function const & f){
-
-		// put the location of the accepted node into memory, and copy into an output location.
-		auto& n = f.entry_node();
-		size_t location_entry;
-
-		if (this->locations_encountered_symbols_.find(n) == this->locations_encountered_symbols_.end())
-			n->Accept(*this); // think of calling Compile(n)
-
-		location_entry = this->locations_encountered_symbols_[n];
-
-		size_t location_this_node;
-		if (this->locations_encountered_symbols_.find(f.shared_from_this()) == this->locations_encountered_symbols_.end()){
-			location_this_node = next_available_mem_;
-			locations_encountered_symbols_[f.shared_from_this()] = next_available_mem_++;
-		}
-		else
-			location_this_node = locations_encountered_symbols_[f.shared_from_this()];
-
-
-		slp_under_construction_.AddInstruction(Assign, location_entry, location_this_node);
+		// a function is just a name for its entry node, so no instructions are needed.  the outputs of the SLP are copied into place by Compile.
+		locations_encountered_symbols_[f.shared_from_this()] = LocationOf(f.entry_node());
 	}
 
 
@@ -197,13 +478,8 @@ namespace bertini{
 		// this loop
 		// gets the locations of all the things we're going to add up.
 		std::vector<size_t> operand_locations;
-		for (auto& n : n.Operands()){
-
-			if (this->locations_encountered_symbols_.find(n)==this->locations_encountered_symbols_.end())
-				n->Accept(*this); // think of calling Compile(n)
-
-			operand_locations.push_back(this->locations_encountered_symbols_[n]);
-		}
+		for (auto& n : n.Operands())
+			operand_locations.push_back(LocationOf(n));
 
 		  
 		const auto& signs = n.GetSigns();
@@ -238,7 +514,9 @@ namespace bertini{
 	}
 
 
-
+	void SLPCompiler::Visit(node::NegateOperator const & n){
+		this->DealWithUnary(n, Negate);
+	}
 
 
 
@@ -250,14 +528,8 @@ namespace bertini{
 		// this loop
 		// gets the locations of all the things we're going to add up.
 		std::vector<size_t> operand_locations;
-		for (auto& n : n.Operands()){
-
-			if (this->locations_encountered_symbols_.find(n)==this->locations_encountered_symbols_.end())
-				n->Accept(*this); // think of calling Compile(n)
-
-			operand_locations.push_back(this->locations_encountered_symbols_[n]);
-			
-		}
+		for (auto& n : n.Operands())
+			operand_locations.push_back(LocationOf(n));
 
 		  
 		const auto& mult_or_div = n.GetMultOrDiv();// true is multiply and false is divide
@@ -269,11 +541,7 @@ namespace bertini{
 			prev_result_loc = operand_locations[0];
 		else{ 
 			// this case is reciprocation of the first operand
-
-			// this code sucks.  really, there should be a bank of integers that we pull from, instead of many copies of the same integer.
-			auto one = std::make_shared<node::Integer>(1);
-			this->DealWithNumber(*one);
-			auto location_one  = locations_encountered_symbols_[one];
+			auto location_one  = LocationOfInteger(1);
 
 			slp_under_construction_.AddInstruction(Divide, location_one, operand_locations[0], next_available_mem_);
 			prev_result_loc = next_available_mem_++;
@@ -303,17 +571,10 @@ namespace bertini{
 		
 		auto expo = n.exponent(); //integer
 
-		auto operand = n.Operand();
-		if (this->locations_encountered_symbols_.find(operand) == this->locations_encountered_symbols_.end())
-			operand->Accept(*this); // think of calling Compile(n)
-
-
 		// this code sucks, because it results in many copies of the same few integers over and over.  
 		// instead, we should add a bank of integers, and only add a new one if needed.
-		auto location_operand = locations_encountered_symbols_[operand];
-		auto e = std::make_shared<node::Integer>(expo);
-		this->DealWithNumber(*e);
-		auto location_exponent  = locations_encountered_symbols_[e];
+		auto location_operand = LocationOf(n.Operand());
+		auto location_exponent  = LocationOfInteger(expo);
 
 
 		this->locations_encountered_symbols_[n.shared_from_this()] =  next_available_mem_;
@@ -326,17 +587,8 @@ namespace bertini{
 		
 		//get location of base and power then add instruction
 
-		const auto& base = n.GetBase();
-		const auto& exponent = n.GetExponent();
-
-		if (this->locations_encountered_symbols_.find(base) == this->locations_encountered_symbols_.end())
-			base->Accept(*this); // think of calling Compile(n)
-
-		if (this->locations_encountered_symbols_.find(exponent) == this->locations_encountered_symbols_.end())
-			exponent->Accept(*this); // think of calling Compile(n)
-
-		auto loc_base = locations_encountered_symbols_[base];
-		auto loc_exponent = locations_encountered_symbols_[exponent];
+		auto loc_base = LocationOf(n.GetBase());
+		auto loc_exponent = LocationOf(n.GetExponent());
 
 		this->locations_encountered_symbols_[n.shared_from_this()] =  next_available_mem_;
 		slp_under_construction_.AddInstruction(Power, loc_base, loc_exponent, next_available_mem_++);
@@ -345,102 +597,100 @@ namespace bertini{
 
 	}
 
-	void SLPCompiler::Visit(node::ExpOperator const& n){
-		
-
-		auto operand = n.Operand();
-		if (this->locations_encountered_symbols_.find(operand) == this->locations_encountered_symbols_.end())
-			operand->Accept(*this); // think of calling Compile(n)
+	void SLPCompiler::Visit(node::SqrtOperator const& n){
+		this->DealWithUnary(n, Sqrt);
+	}
 
-		auto location_operand = locations_encountered_symbols_[operand];
-		this->locations_encountered_symbols_[n.shared_from_this()] =  next_available_mem_;
-		slp_under_construction_.AddInstruction(Exp,location_operand, next_available_mem_++);
+	void SLPCompiler::Visit(node::ExpOperator const& n){
+		this->DealWithUnary(n, Exp);
 	}
 
 	void SLPCompiler::Visit(node::LogOperator const& n){
-		
-
-		auto operand = n.Operand();
-		if (this->locations_encountered_symbols_.find(operand) == this->locations_encountered_symbols_.end())
-			operand->Accept(*this); // think of calling Compile(n)
-
-		auto location_operand = locations_encountered_symbols_[operand];
-		this->locations_encountered_symbols_[n.shared_from_this()] =  next_available_mem_;
-		slp_under_construction_.AddInstruction(Log,location_operand, next_available_mem_++);
+		this->DealWithUnary(n, Log);
 	}
 
 
 	// the trig operators
 	void SLPCompiler::Visit(node::SinOperator const& n){
-		
+		this->DealWithUnary(n, Sin);
+	}
 
-		auto operand = n.Operand();
-		if (this->locations_encountered_symbols_.find(operand) == this->locations_encountered_symbols_.end())
-			operand->Accept(*this); // think of calling Compile(n)
+	void SLPCompiler::Visit(node::ArcSinOperator const& n){
+		this->DealWithUnary(n, Asin);
+	}
 
-		auto location_operand = locations_encountered_symbols_[operand];
-		this->locations_encountered_symbols_[n.shared_from_this()] =  next_available_mem_;
-		slp_under_construction_.AddInstruction(Sin,location_operand, next_available_mem_++);
+	void SLPCompiler::Visit(node::CosOperator const& n){
+		this->DealWithUnary(n, Cos);
 	}
 
-	void SLPCompiler::Visit(node::ArcSinOperator const& n){
-		
+	void SLPCompiler::Visit(node::ArcCosOperator const& n){
+		this->DealWithUnary(n, Acos);
+	}
 
-		auto operand = n.Operand();
-		if (this->locations_encountered_symbols_.find(operand) == this->locations_encountered_symbols_.end())
-			operand->Accept(*this); // think of calling Compile(n)
+	void SLPCompiler::Visit(node::TanOperator const& n){
+		this->DealWithUnary(n, Tan);
+	}
 
-		auto location_operand = locations_encountered_symbols_[operand];
-		this->locations_encountered_symbols_[n.shared_from_this()] =  next_available_mem_;
-		slp_under_construction_.AddInstruction(Asin,location_operand, next_available_mem_++);
+	void SLPCompiler::Visit(node::ArcTanOperator const& n){
+		this->DealWithUnary(n, Atan);
 	}
 
-	void SLPCompiler::Visit(node::CosOperator const& n){
-		
 
-		auto operand = n.Operand();
-		if (this->locations_encountered_symbols_.find(operand) == this->locations_encountered_symbols_.end())
-			operand->Accept(*this); // think of calling Compile(n)
 
-		auto location_operand = locations_encountered_symbols_[operand];
-		this->locations_encountered_symbols_[n.shared_from_this()] =  next_available_mem_;
-		slp_under_construction_.AddInstruction(Cos,location_operand, next_available_mem_++);
-	}
+	void SLPCompiler::CompilePatch(System const& sys){
+		// each patch is the linear function sum_j c_j x_j - 1, for the variables x_j in one group
+		const auto num_patches = slp_under_construction_.number_of_.Patches;
+		if (num_patches==0)
+			return;
 
-	void SLPCompiler::Visit(node::ArcCosOperator const& n){
-		
+		const auto& patch = sys.GetPatch();
+		const auto& vars = sys.Variables();
+		const auto num_functions = slp_under_construction_.number_of_.Functions;
+		const auto num_rows = num_functions + num_patches;
+		const auto& out = slp_under_construction_.output_locations_;
 
-		auto operand = n.Operand();
-		if (this->locations_encountered_symbols_.find(operand) == this->locations_encountered_symbols_.end())
-			operand->Accept(*this); // think of calling Compile(n)
+		auto location_zero = LocationOfInteger(0);
+		auto location_one = LocationOfInteger(1);
 
-		auto location_operand = locations_encountered_symbols_[operand];
-		this->locations_encountered_symbols_[n.shared_from_this()] =  next_available_mem_;
-		slp_under_construction_.AddInstruction(Acos,location_operand, next_available_mem_++);
-	}
+		size_t variable_counter{0};
+		for (size_t ii=0; ii<num_patches; ++ii){
+			const auto& coefficients = patch.HighestPrecisionCoefficients(ii);
 
-	void SLPCompiler::Visit(node::TanOperator const& n){
-		
+			size_t prev_result_loc;
+			for (int jj=0; jj<coefficients.size(); ++jj, ++variable_counter){
+				auto c = MakeFloat(coefficients(jj));
+				this->DealWithNumber(*c);
+				auto location_coefficient = locations_encountered_symbols_[c];
 
-		auto operand = n.Operand();
-		if (this->locations_encountered_symbols_.find(operand) == this->locations_encountered_symbols_.end())
-			operand->Accept(*this); // think of calling Compile(n)
+				// the derivative with respect to this variable is the coefficient
+				if (differentiate_)
+					slp_under_construction_.AddInstruction(Assign, location_coefficient, out.Jacobian + num_functions+ii + variable_counter*num_rows);
 
-		auto location_operand = locations_encountered_symbols_[operand];
-		this->locations_encountered_symbols_[n.shared_from_this()] =  next_available_mem_;
-		slp_under_construction_.AddInstruction(Tan,location_operand, next_available_mem_++);
-	}
+				auto location_term = next_available_mem_++;
+				slp_under_construction_.AddInstruction(Multiply, location_coefficient, locations_encountered_symbols_[vars[variable_counter]], location_term);
 
-	void SLPCompiler::Visit(node::ArcTanOperator const& n){
-		
+				if (jj==0)
+					prev_result_loc = location_term;
+				else
+				{
+					slp_under_construction_.AddInstruction(Add, prev_result_loc, location_term, next_available_mem_);
+					prev_result_loc = next_available_mem_++;
+				}
+			}
 
-		auto operand = n.Operand();
-		if (this->locations_encountered_symbols_.find(operand) == this->locations_encountered_symbols_.end())
-			operand->Accept(*this); // think of calling Compile(n)
+			slp_under_construction_.AddInstruction(Subtract, prev_result_loc, location_one, out.Functions + num_functions + ii);
 
-		auto location_operand = locations_encountered_symbols_[operand];
-		this->locations_encountered_symbols_[n.shared_from_this()] =  next_available_mem_;
-		slp_under_construction_.AddInstruction(Atan,location_operand, next_available_mem_++);
+			if (!differentiate_)
+				continue;
+
+			// the derivatives with respect to variables in other groups are 0, as is the time derivative.
+			for (size_t kk=0; kk<vars.size(); ++kk)
+				if (kk < variable_counter-coefficients.size() || kk >= variable_counter)
+					slp_under_construction_.AddInstruction(Assign, location_zero, out.Jacobian + num_functions+ii + kk*num_rows);
+
+			if (slp_under_construction_.HavePathVariable())
+				slp_under_construction_.AddInstruction(Assign, location_zero, out.TimeDeriv + num_functions + ii);
+		}
 	}
 
 
@@ -451,114 +701,367 @@ namespace bertini{
 		
 
 
-		this->slp_under_construction_.precision_ = DefaultPrecision();
+		this->slp_under_construction_.precision_ = sys.precision();
 
 		// deal with variables
 		
 
-			// 1. ADD VARIABLES
-		auto variable_groups = sys.VariableGroups();
-		auto variable_group_sizes = sys.VariableGroupSizes();
+			// 1. ADD VARIABLES, in the same order as the system uses
+		const auto& variables = sys.Variables();
 		slp_under_construction_.input_locations_.Variables = next_available_mem_;
-		unsigned variable_counter{0};
-		for (int ii=0; ii<variable_group_sizes.size(); ++ii){
-			auto vg = variable_groups[ii];
-			auto s = variable_group_sizes[ii];
-
-			for (int jj=0; jj<s; ++jj){
-				locations_encountered_symbols_[ vg[jj] ] = next_available_mem_++;
-				variable_counter += 1;
-			}
-		}
-		slp_under_construction_.number_of_.Variables = variable_counter;
-		slp_under_construction_.input_locations_.Variables = variable_counter;
+		for (const auto& v : variables)
+			locations_encountered_symbols_[v] = next_available_mem_++;
+
+		slp_under_construction_.number_of_.Variables = variables.size();
 
 			// deal with path variable
 		if (sys.HavePathVariable())
 		{
 				// do this action only if the system has a path variable defined
+			slp_under_construction_.input_locations_.Time = next_available_mem_;
 			locations_encountered_symbols_[ sys.GetPathVariable() ] = next_available_mem_++;
 			slp_under_construction_.has_path_variable_ = true;
 		}
 
 
 		
-			// make space for functions and derivatives
+			// make space for functions and derivatives.  the patches follow the functions.
+		const auto num_functions = sys.NumFunctions();
+		const auto num_patches = sys.IsPatched() ? sys.NumPatches() : 0;
+		const auto num_rows = num_functions + num_patches;
+		const auto num_vars = variables.size();
+
+		auto& out = slp_under_construction_.output_locations_;
+
+		slp_under_construction_.number_of_.Functions = num_functions;
+		slp_under_construction_.number_of_.Patches = num_patches;
+		out.Functions = next_available_mem_;
+		next_available_mem_ += num_rows;
+
+		slp_under_construction_.forward_mode_ = !differentiate_;
+
+			// space derivatives are stored column-major, with rows for the patches too.
+			// a program differentiated in forward mode has no space for them, its derivatives being carried with every value.
+		if (differentiate_) {
+			slp_under_construction_.number_of_.Jacobian = num_rows*num_vars;
+			out.Jacobian = next_available_mem_;
+			next_available_mem_ += num_rows*num_vars;
+		}
+
+		if (differentiate_ && sys.HavePathVariable()) {
+			slp_under_construction_.number_of_.TimeDeriv = num_rows;
+			out.TimeDeriv = next_available_mem_;
+			next_available_mem_ += num_rows;
+		}
+
+		end_of_outputs_ = next_available_mem_;
+
+
+
+		// everything is compiled into one program, so that the functions and derivatives share their intermediate results.  
+		// the result of each output node is copied into its place in the output block.
+
 			// 3. ADD FUNCTIONS
-		slp_under_construction_.number_of_.Functions = sys.NumFunctions();
-		slp_under_construction_.output_locations_.Functions = next_available_mem_;
-		for (auto f: sys.GetFunctions())
-			locations_encountered_symbols_[f] = next_available_mem_++;
+		const auto& functions = sys.GetFunctions();
+		for (size_t ii=0; ii<num_functions; ++ii)
+			slp_under_construction_.AddInstruction(Assign, LocationOf(functions[ii]), out.Functions + ii);
+
+
+			// 4. ADD SPACE VARIABLE DERIVATIVES
+		if (differentiate_) {
+			const auto ds_dx = sys.GetSpaceDerivatives(); // column-major, num_functions by num_vars
+			for (size_t jj=0; jj<num_vars; ++jj)
+				for (size_t ii=0; ii<num_functions; ++ii)
+					slp_under_construction_.AddInstruction(Assign, LocationOf(ds_dx[ii+jj*num_functions]), out.Jacobian + ii + jj*num_rows);
+		}
+
 
+			// 5. ADD TIME VARIABLE DERIVATIVES
+			// we need derivatives with respect to time only if the system has a path variable defined
+		if (differentiate_ && sys.HavePathVariable()) {
+			const auto ds_dt = sys.GetTimeDerivatives();
+			for (size_t ii=0; ii<num_functions; ++ii)
+				slp_under_construction_.AddInstruction(Assign, LocationOf(ds_dt[ii]), out.TimeDeriv + ii);
+		}
 
 
+		// 6. ADD PATCHES
+		CompilePatch(sys);
 
 
-		
-		// always have space derivatives
+		if (optimize_)
+			Optimize();
 
-		auto ds_dx = sys.GetSpaceDerivatives(); // a linear object, so can just run down the object
-		slp_under_construction_.number_of_.Jacobian = ds_dx.size();
-		slp_under_construction_.output_locations_.Jacobian = next_available_mem_;
-		for (auto n: ds_dx)
-			locations_encountered_symbols_[n] = next_available_mem_++;
 
+		slp_under_construction_.GetMemory<dbl_complex>().resize(next_available_mem_);
+		slp_under_construction_.GetMemory<mpfr_complex>().resize(next_available_mem_);
 
-		// sometimes have time derivatives
-		if (sys.HavePathVariable()) {
-			
-			auto ds_dt = sys.GetTimeDerivatives();  // a linear object, so can just run down the object
-			slp_under_construction_.number_of_.TimeDeriv = ds_dt.size();
-			slp_under_construction_.output_locations_.TimeDeriv = next_available_mem_;
-			for (auto n: ds_dt)
-				locations_encountered_symbols_[n] = next_available_mem_++;
+		slp_under_construction_.CopyNumbersIntoMemory<dbl_complex>();
+		slp_under_construction_.CopyNumbersIntoMemory<mpfr_complex>();
+
+		slp_under_construction_.Pack();
+
+		return slp_under_construction_;
+	}
+
+	namespace {
+
+		// an instruction of a SLP, unpacked for optimization
+		struct Instruction
+		{
+			Operation op;
+			size_t in1, in2, out; // in2 is unused for unary operations
+		};
+
+		bool IsCommutative(Operation op)
+		{
+			return op==Add || op==Multiply;
+		}
+
+		// the number resulting from applying an operation to numbers.  kept as an expression, so that it can be evaluated at any precision.
+		std::shared_ptr<node::Node> FoldedNumber(Operation op, std::shared_ptr<node::Node> const& a, std::shared_ptr<node::Node> const& b)
+		{
+			switch (op)
+			{
+				case Add:      return a+b;
+				case Subtract: return a-b;
+				case Multiply: return a*b;
+				case Divide:   return a/b;
+				case Power:    return pow(a,b);
+				case Assign:   return a;
+				case Negate:   return -a;
+				case Sqrt:     return sqrt(a);
+				case Exp:      return exp(a);
+				case Log:      return log(a);
+				case Sin:      return sin(a);
+				case Cos:      return cos(a);
+				case Tan:      return tan(a);
+				case Asin:     return asin(a);
+				case Acos:     return acos(a);
+				case Atan:     return atan(a);
+			}
+			throw std::runtime_error("unknown operation while folding constants in straight-line program");
 		}
+	}
 
 
 
+	void SLPCompiler::Optimize(){
+		auto& slp = slp_under_construction_;
+		auto& report = slp.optimization_report_;
+		const auto memory_size = next_available_mem_;
+		const auto npos = memory_size;
 
+		report.InstructionsBefore = slp.NumInstructions();
+		report.MemoryBefore = memory_size;
+		report.NumbersBefore = slp.true_values_of_numbers_.size();
 
+		auto is_output = [&](size_t loc){ return loc >= slp.output_locations_.Functions && loc < end_of_outputs_; };
 
-		
-		for (auto f: sys.GetFunctions())
+		// unpack the instructions
+		std::vector<Instruction> instructions;
+		for (size_t ii = 0; ii<slp.instructions_.size(); ){
+			auto op = static_cast<Operation>(slp.instructions_[ii]);
+			if (IsUnary(op)){
+				instructions.push_back({op, slp.instructions_[ii+1], 0, slp.instructions_[ii+2]});
+				ii += 3;
+			}
+			else{
+				instructions.push_back({op, slp.instructions_[ii+1], slp.instructions_[ii+2], slp.instructions_[ii+3]});
+				ii += 4;
+			}
+		}
+
+
+		// the numbers, by location
+		std::vector<std::shared_ptr<node::Node>> numbers(memory_size);
+		for (auto const& x : slp.true_values_of_numbers_)
+			numbers[x.second] = std::const_pointer_cast<node::Node>(x.first);
+
+
+		// 1 and 2.  hash-consing and constant folding, in one pass.
+		// every location is written at most once, so the location first computing a value can stand in for all others computing it.
+		std::vector<size_t> canonical(memory_size);
+		std::iota(canonical.begin(), canonical.end(), 0);
+
+		// equal numbers are the same number.  they are keyed on their exact values: integers and rationals print exactly, and floats are printed with all the digits of their precision, so floats are only the same if they have the same value at the same precision
+		std::map<std::string, size_t> exact_numbers;
+		for (size_t loc = 0; loc<memory_size; ++loc)
 		{
-			f->Accept(*this);
+			const auto& n = numbers[loc];
+			char kind;
+			if (std::dynamic_pointer_cast<node::Integer>(n))
+				kind = 'i';
+			else if (std::dynamic_pointer_cast<node::Rational>(n))
+				kind = 'r';
+			else if (std::dynamic_pointer_cast<node::Float>(n))
+				kind = 'f';
+			else
+				continue;
 
-			// post visit function
-			/* code */
+			std::stringstream key;
+			key << kind << std::scientific << std::setprecision(0) << *n;
+			auto found = exact_numbers.find(key.str());
+			if (found==exact_numbers.end())
+				exact_numbers[key.str()] = loc;
+			else
+				canonical[loc] = found->second;
 		}
 
+		std::map<std::tuple<size_t,size_t,size_t>, size_t> computed; // (operation, operand, operand) -> where the result is
+		std::vector<Instruction> kept;
+		for (auto ins : instructions){
+			const bool unary = IsUnary(ins.op);
+			ins.in1 = canonical[ins.in1];
+			if (!unary)
+				ins.in2 = canonical[ins.in2];
+
+			if (numbers[ins.in1] && (unary || numbers[ins.in2])){
+				numbers[ins.out] = FoldedNumber(ins.op, numbers[ins.in1], unary ? nullptr : numbers[ins.in2]);
+				++report.FoldedConstants;
+				continue;
+			}
+
+			if (ins.op==Assign){
+				if (!is_output(ins.out))
+					canonical[ins.out] = ins.in1;
+				else
+					kept.push_back(ins);
+				continue;
+			}
 
+			if (IsCommutative(ins.op) && ins.in2 < ins.in1)
+				std::swap(ins.in1, ins.in2);
+
+			auto key = std::make_tuple(static_cast<size_t>(ins.op), ins.in1, unary ? npos : ins.in2);
+			auto found = computed.find(key);
+			if (found!=computed.end()){
+				++report.CommonSubexpressions;
+				if (is_output(ins.out))
+					kept.push_back({Assign, found->second, 0, ins.out});
+				else
+					canonical[ins.out] = found->second;
+				continue;
+			}
 
-		
-		// always do derivatives with respect to space variables
-		// 4. ADD SPACE VARIABLE DERIVATIVES
-		for (auto n: ds_dx)
-			n->Accept(*this);
+			computed[key] = ins.out;
+			kept.push_back(ins);
+		}
 
 
+		// 3a.  remove instructions not contributing to an output, working backwards from the outputs.
+		std::vector<bool> live(memory_size, false);
+		std::vector<Instruction> alive;
+		for (auto iter = kept.rbegin(); iter!=kept.rend(); ++iter){
+			if (!is_output(iter->out) && !live[iter->out]){
+				++report.DeadInstructions;
+				continue;
+			}
+			live[iter->in1] = true;
+			if (!IsUnary(iter->op))
+				live[iter->in2] = true;
+			alive.push_back(*iter);
+		}
+		std::reverse(alive.begin(), alive.end());
 
 
-		// sometimes have time derivatives
-		if (sys.HavePathVariable()) {
-			
-			// we need derivatives with respect to time only if the system has a path variable defined
-			// 5. ADD TIME VARIABLE DERIVATIVES
+		// 3b.  write results directly into the outputs they are copied to, if nothing else uses them.
+		std::vector<size_t> num_uses(memory_size, 0);
+		std::vector<size_t> defined_by(memory_size, npos);
+		for (size_t ii = 0; ii<alive.size(); ++ii){
+			++num_uses[alive[ii].in1];
+			if (!IsUnary(alive[ii].op))
+				++num_uses[alive[ii].in2];
+			defined_by[alive[ii].out] = ii;
+		}
 
-			auto ds_dt = sys.GetTimeDerivatives();  // a linear object, so can just run down the object
-			for (auto n: ds_dt)
-				n->Accept(*this);
+		std::vector<Instruction> final_instructions;
+		std::vector<bool> forwarded(alive.size(), false);
+		for (size_t ii = 0; ii<alive.size(); ++ii){
+			auto const& ins = alive[ii];
+			if (ins.op==Assign && is_output(ins.out) && !is_output(ins.in1) && defined_by[ins.in1]!=npos && num_uses[ins.in1]==1){
+				alive[defined_by[ins.in1]].out = ins.out;
+				forwarded[ii] = true;
+				++report.ForwardedOutputs;
+			}
+		}
+		for (size_t ii = 0; ii<alive.size(); ++ii)
+			if (!forwarded[ii])
+				final_instructions.push_back(alive[ii]);
+
+
+		// 4.  lay out memory again.  the inputs and outputs stay where they are, followed by the numbers still used, followed by the intermediate results, which share locations when their lifetimes don't overlap.
+		std::vector<bool> used(memory_size, false);
+		std::vector<size_t> last_use(memory_size, 0);
+		for (size_t ii = 0; ii<final_instructions.size(); ++ii){
+			auto const& ins = final_instructions[ii];
+			used[ins.in1] = true;
+			last_use[ins.in1] = ii;
+			if (!IsUnary(ins.op)){
+				used[ins.in2] = true;
+				last_use[ins.in2] = ii;
+			}
 		}
 
-		slp_under_construction_.GetMemory<dbl_complex>().resize(next_available_mem_);
-		slp_under_construction_.GetMemory<mpfr_complex>().resize(next_available_mem_);
+		std::vector<size_t> location(memory_size, npos);
+		for (size_t loc = 0; loc<end_of_outputs_; ++loc)
+			location[loc] = loc;
+
+		size_t next_location = end_of_outputs_;
+		std::vector< std::pair<Nd,size_t> > numbers_in_use;
+		for (size_t loc = 0; loc<memory_size; ++loc){
+			if (!numbers[loc])
+				continue;
+
+			if (loc < end_of_outputs_)
+				numbers_in_use.emplace_back(numbers[loc], loc); // a constant output
+			else if (used[loc]){
+				location[loc] = next_location++;
+				numbers_in_use.emplace_back(numbers[loc], location[loc]);
+			}
+		}
 
-		slp_under_construction_.CopyNumbersIntoMemory<dbl_complex>();
-		slp_under_construction_.CopyNumbersIntoMemory<mpfr_complex>();
+		std::vector<size_t> free_locations;
+		auto release = [&](size_t loc, size_t ii){
+			if (loc >= end_of_outputs_ && !numbers[loc] && last_use[loc]==ii)
+				free_locations.push_back(location[loc]);
+		};
+
+		slp.instructions_.clear();
+		for (size_t ii = 0; ii<final_instructions.size(); ++ii){
+			auto const& ins = final_instructions[ii];
+			const bool unary = IsUnary(ins.op);
+
+			// the result gets a location before the operands' are released, so that it never overwrites an operand
+			if (location[ins.out]==npos){
+				if (free_locations.empty())
+					location[ins.out] = next_location++;
+				else{
+					location[ins.out] = free_locations.back();
+					free_locations.pop_back();
+				}
+			}
 
-		return slp_under_construction_;
+			if (unary)
+				slp.AddInstruction(ins.op, location[ins.in1], location[ins.out]);
+			else
+				slp.AddInstruction(ins.op, location[ins.in1], location[ins.in2], location[ins.out]);
+
+			release(ins.in1, ii);
+			if (!unary && ins.in2!=ins.in1)
+				release(ins.in2, ii);
+		}
+
+		slp.true_values_of_numbers_ = numbers_in_use;
+		next_available_mem_ = next_location;
+
+		report.InstructionsAfter = slp.NumInstructions();
+		report.MemoryAfter = next_available_mem_;
+		report.NumbersAfter = slp.true_values_of_numbers_.size();
 	}
 
+
+
 	void SLPCompiler::Clear(){
 		next_available_mem_ = 0;
 		locations_encountered_symbols_.clear();
@@ -25,6 +25,9 @@
 
 #include "bertini2/system/system.hpp"
 
+#include <unordered_map>
+#include <unordered_set>
+
 template<typename NumType> using Vec = bertini::Vec<NumType>;
 template<typename NumType> using Mat = bertini::Mat<NumType>;
 using Nd = std::shared_ptr<bertini::node::Node>;
@@ -41,6 +44,11 @@ namespace bertini
 		return JacobianEvalMethod::Derivatives;
 	}
 
+	EvalMethod DefaultEvalMethod()
+	{
+		return EvalMethod::FunctionTree;
+	}
+
 	bool DefaultAutoSimplify()
 	{
 		return true;
@@ -72,6 +80,8 @@ namespace bertini
 
 		swap(a.is_differentiated_,b.is_differentiated_);
 		swap(a.jacobian_,b.jacobian_);
+		swap(a.jacobian_rows_of_columns_,b.jacobian_rows_of_columns_);
+		swap(a.patch_group_of_variables_,b.patch_group_of_variables_);
 
 		swap(a.space_derivatives_,b.space_derivatives_);
 		swap(a.time_derivatives_,b.time_derivatives_);
@@ -79,7 +89,12 @@ namespace bertini
 		swap(a.assume_uniform_precision_,b.assume_uniform_precision_);
 		swap(a.jacobian_eval_method_,b.jacobian_eval_method_);
 
+		swap(a.eval_method_,b.eval_method_);
+		swap(a.slp_,b.slp_);
+		swap(a.poly_,b.poly_);
+
 		swap(a.precision_,b.precision_);
+		swap(a.tree_precision_,b.tree_precision_);
 		swap(a.is_patched_,b.is_patched_);
 		swap(a.patch_,b.patch_);
 	}
@@ -103,9 +118,12 @@ namespace bertini
 		time_derivatives_ = other.time_derivatives_;
 
 		is_differentiated_ = other.is_differentiated_;
+		jacobian_rows_of_columns_ = other.jacobian_rows_of_columns_;
+		patch_group_of_variables_ = other.patch_group_of_variables_;
 
 		assume_uniform_precision_ = other.assume_uniform_precision_;
 		jacobian_eval_method_ = other.jacobian_eval_method_;
+		eval_method_ = other.eval_method_; // but not the straight-line program or polynomial system, which are made from the nodes of the other system, and are made again on demand
 
 		time_order_of_variable_groups_ = other.time_order_of_variable_groups_;
 
@@ -115,6 +133,7 @@ namespace bertini
 		have_ordering_ =  other.have_ordering_;
 
 		precision_ = other.precision_;
+		tree_precision_ = other.tree_precision_;
 
 		// now to do the members which are not simply copied
 		constant_subfunctions_.resize(other.constant_subfunctions_.size());
@@ -227,6 +246,46 @@ namespace bertini
 		if (this->assume_uniform_precision_ && new_precision == this->precision_)
 			return;
 
+		// evaluating with a straight-line program, the function tree isn't evaluated, so rather than walking it on every change of precision, it is brought to the system's precision when next evaluated
+		if (!UsesStraightLineProgram() && !UsesPolynomialSystem())
+			TreePrecision(new_precision);
+
+		if (have_path_variable_)
+			path_variable_->precision(new_precision);
+
+
+		for (const auto& iter : homogenizing_variables_)
+			iter->precision(new_precision);
+
+		for (const auto& iter : variable_groups_)
+			for (const auto& jter : iter)
+				jter->precision(new_precision);
+
+		for (const auto& iter : hom_variable_groups_)
+			for (const auto& jter : iter)
+				jter->precision(new_precision);
+
+		for (const auto& iter : ungrouped_variables_)
+			iter->precision(new_precision);
+
+		using bertini::Precision;
+		Precision(std::get<Vec<mpfr_complex> >(current_variable_values_),new_precision);
+
+		if (IsPatched())
+			patch_.Precision(new_precision);
+
+		if (slp_)
+			slp_->precision(new_precision);
+
+		if (poly_)
+			poly_->precision(new_precision);
+
+		precision_ = new_precision;
+	}
+
+
+	void System::TreePrecision(unsigned new_precision) const
+	{
 		for (const auto& iter : functions_) {
 			iter->precision(new_precision);
 		}
@@ -262,41 +321,31 @@ namespace bertini
 					for (const auto& iter : time_derivatives_)
 						iter->precision(new_precision);
 					break;
-				// later, case for straight line program?
+				case JacobianEvalMethod::ForwardMode:
+					break; // no derivative trees
 			}
 			
 		}
 
-		if (have_path_variable_)
-			path_variable_->precision(new_precision);
-
-
-		for (const auto& iter : homogenizing_variables_)
-			iter->precision(new_precision);
-
-		for (const auto& iter : variable_groups_)
-			for (const auto& jter : iter)
-				jter->precision(new_precision);
-
-		for (const auto& iter : hom_variable_groups_)
-			for (const auto& jter : iter)
-				jter->precision(new_precision);
-
-		for (const auto& iter : ungrouped_variables_)
-			iter->precision(new_precision);
-
-		using bertini::Precision;
-		Precision(std::get<Vec<mpfr_complex> >(current_variable_values_),new_precision);
-
-		if (IsPatched())
-			patch_.Precision(new_precision);
-
-		precision_ = new_precision;
+		tree_precision_ = new_precision;
 	}
 
 
 	void System::Differentiate() const
 	{
+		slp_.reset(); // compiled from the old derivatives
+		poly_.reset(); // expanded from the old functions
+
+		jacobian_rows_of_columns_.clear(); // found again for the new functions, when next needed
+		patch_group_of_variables_.clear();
+
+		if (UsesPolynomialSystem())
+		{
+			// the derivatives are computed from the exponents of the polynomial system, when evaluating
+			is_differentiated_ = true;
+			return;
+		}
+
 		switch (jacobian_eval_method_)
 		{
 			case JacobianEvalMethod::JacobianNode:
@@ -309,6 +358,12 @@ namespace bertini
 				DifferentiateUsingDerivatives();
 				break;
 			}
+			case JacobianEvalMethod::ForwardMode:
+			{
+				// the derivatives are computed from the straight-line program, when evaluating
+				is_differentiated_ = true;
+				return;
+			}
 		}
 		
 		if (auto_simplify_)
@@ -332,10 +387,16 @@ namespace bertini
 		const auto num_vars = NumVariables();
 		const auto num_functions = NumFunctions();
 
-		space_derivatives_.resize(num_functions*num_vars);
+		if (!HasJacobianSparsity())
+			ComputeJacobianSparsity();
+
+		// the entries for functions not depending on a variable are all the same zero, rather than each a tree differentiated to zero
+		auto zero = MakeFunction(MakeInteger(0));
+		space_derivatives_.assign(num_functions*num_vars, zero);
+
 		// again, computing these in column major, so staying with one variable at a time.
 		for (int jj = 0; jj < num_vars; ++jj)
-			for (int ii = 0; ii < num_functions; ++ii)
+			for (auto ii : jacobian_rows_of_columns_[jj])
 				space_derivatives_[ii+jj*num_functions] = MakeFunction(functions_[ii]->Differentiate(vars[jj]));
 
 		if (HavePathVariable())
@@ -349,9 +410,123 @@ namespace bertini
 		is_differentiated_ = true;
 	}
 
+	namespace {
+
+		/**
+		 Add the nodes of the variables a tree depends on to `found`, walking each shared subtree once.
+
+		 \return false if the tree has a kind of node this can't see into, such as a linear product, in which case `found` may be missing variables.
+		*/
+		bool FindVariables(std::shared_ptr<const node::Node> const& n, std::unordered_set<node::Node const*> & visited, std::unordered_set<node::Node const*> & found)
+		{
+			if (!visited.insert(n.get()).second)
+				return true;
+
+			if (std::dynamic_pointer_cast<const node::Number>(n))
+				return true;
+
+			if (std::dynamic_pointer_cast<const node::Variable>(n))
+			{
+				found.insert(n.get());
+				return true;
+			}
+
+			if (auto f = std::dynamic_pointer_cast<const node::Function>(n))
+				return FindVariables(f->entry_node(), visited, found);
+
+			if (auto op = std::dynamic_pointer_cast<const node::UnaryOperator>(n))
+				return FindVariables(op->Operand(), visited, found);
+
+			if (auto op = std::dynamic_pointer_cast<const node::NaryOperator>(n))
+			{
+				for (auto const& operand : op->Operands())
+					if (!FindVariables(operand, visited, found))
+						return false;
+				return true;
+			}
+
+			if (auto op = std::dynamic_pointer_cast<const node::PowerOperator>(n))
+				return FindVariables(op->GetBase(), visited, found) && FindVariables(op->GetExponent(), visited, found);
+
+			return false;
+		}
+	}
+
+	void System::ComputeJacobianSparsity() const
+	{
+		const auto& vars = this->Variables();
+		const auto num_vars = NumVariables();
+		const auto num_functions = NumFunctions();
+
+		std::unordered_map<node::Node const*, int> column_of_variable;
+		for (int jj = 0; jj < num_vars; ++jj)
+			column_of_variable[vars[jj].get()] = jj;
+
+		// a function depends on the variables appearing in it, found in one walk of it.  a function with nodes the walk can't see into depends on a variable unless it has degree 0 in it, non-polynomial dependence having negative degree.
+		jacobian_rows_of_columns_.assign(num_vars, std::vector<int>());
+		for (int ii = 0; ii < num_functions; ++ii)
+		{
+			std::unordered_set<node::Node const*> visited, found;
+			if (FindVariables(functions_[ii], visited, found))
+			{
+				for (auto v : found)
+				{
+					auto column = column_of_variable.find(v);
+					if (column != column_of_variable.end())
+						jacobian_rows_of_columns_[column->second].push_back(ii);
+				}
+			}
+			else
+			{
+				for (int jj = 0; jj < num_vars; ++jj)
+					if (functions_[ii]->Degree(vars[jj]) != 0)
+						jacobian_rows_of_columns_[jj].push_back(ii);
+			}
+		}
+
+		patch_group_of_variables_.clear();
+		if (IsPatched())
+		{
+			patch_group_of_variables_.reserve(num_vars);
+			const auto& sizes = patch_.VariableGroupSizes();
+			for (unsigned ii = 0; ii < sizes.size(); ++ii)
+				for (unsigned jj = 0; jj < sizes[ii]; ++jj)
+					patch_group_of_variables_.emplace_back(ii, jj);
+		}
+	}
+
+
+	size_t System::NumJacobianNonzeros() const
+	{
+		size_t num_nonzeros = IsPatched() ? NumVariables() : 0;
+		for (auto const& rows : jacobian_rows_of_columns_)
+			num_nonzeros += rows.size();
+		return num_nonzeros;
+	}
+
+
+	JacobianPattern System::JacobianSparsity() const
+	{
+		if (!is_differentiated_)
+			Differentiate();
+		if (!HasJacobianSparsity())
+			ComputeJacobianSparsity();
+
+		if (!IsPatched())
+			return JacobianPattern(NumTotalFunctions(), jacobian_rows_of_columns_);
+
+		// each variable appears in exactly one patch equation, whose rows follow those of the functions
+		auto rows_of_columns = jacobian_rows_of_columns_;
+		for (unsigned jj = 0; jj < rows_of_columns.size(); ++jj)
+			rows_of_columns[jj].push_back(static_cast<int>(NumFunctions() + patch_group_of_variables_[jj].first));
+
+		return JacobianPattern(NumTotalFunctions(), rows_of_columns);
+	}
+
+
 	std::vector< Nd > System::GetSpaceDerivatives() const
 	{
-		if ( (jacobian_eval_method_==JacobianEvalMethod::JacobianNode) || (!is_differentiated_) )
+		if ( (jacobian_eval_method_!=JacobianEvalMethod::Derivatives) || (!is_differentiated_) || UsesPolynomialSystem() )
 			DifferentiateUsingDerivatives();
 
 		return space_derivatives_;
@@ -359,7 +534,7 @@ namespace bertini
 
 	std::vector< Nd > System::GetTimeDerivatives() const
 	{
-		if ( (jacobian_eval_method_==JacobianEvalMethod::JacobianNode) || (!is_differentiated_) )
+		if ( (jacobian_eval_method_!=JacobianEvalMethod::Derivatives) || (!is_differentiated_) || UsesPolynomialSystem() )
 			DifferentiateUsingDerivatives();
 		
 		return time_derivatives_;
@@ -799,6 +974,70 @@ namespace bertini
 
 		return variable_ordering_;
 	}
+
+
+
+	EvalContext System::NewEvalContext() const
+	{
+		// do the lazy setup now, so that evaluating through contexts doesn't modify the system
+		Variables();
+		if (!is_differentiated_)
+			Differentiate();
+
+		// evaluation through a context goes through the polynomial system if the system evaluates with one, and otherwise the straight-line program, whatever the evaluation method
+		if (UsesPolynomialSystem())
+			GetPolynomialSystem();
+		else
+			GetStraightLineProgram();
+
+		return EvalContext();
+	}
+
+
+
+	StraightLineProgram const& System::GetStraightLineProgram() const
+	{
+		if (!is_differentiated_)
+			Differentiate();
+
+		if (!slp_)
+		{
+			SyncTreePrecision(); // the program's numbers come from the tree
+			auto slp = std::make_shared<StraightLineProgram>(*this, true, jacobian_eval_method_!=JacobianEvalMethod::ForwardMode);
+
+			if (eval_method_==EvalMethod::CompiledStraightLineProgram)
+			{
+				auto compiled = CompiledSLPRegistry::Find(slp->Fingerprint());
+				if (!compiled)
+				{
+					std::stringstream err_msg;
+					err_msg << "no compiled straight-line program is registered for this system, whose program has fingerprint " << slp->Fingerprint() << ".  generate one with SLPCodeGenerator, and compile it in or load it with CompiledSLPRegistry::Load";
+					throw std::runtime_error(err_msg.str());
+				}
+				slp->UseCompiled(*compiled);
+			}
+
+			slp_ = slp;
+		}
+
+		return *slp_;
+	}
+
+
+	PolynomialSystem const& System::GetPolynomialSystem() const
+	{
+		if (!is_differentiated_)
+			Differentiate(); // which forgets the polynomial system expanded from the old functions
+
+		if (!poly_)
+		{
+			SyncTreePrecision(); // the coefficients come from the tree
+			poly_ = std::make_shared<PolynomialSystem>(*this);
+			poly_->precision(precision_);
+		}
+
+		return *poly_;
+	}
 		
 
 	void System::CopyVariableStructure(System const& other)
@@ -859,6 +1098,7 @@ namespace bertini
 		patch_ = Patch(VariableGroupSizesFIFO());
 
 		is_patched_ = true;
+		slp_.reset();
 	}
 
 
@@ -870,6 +1110,7 @@ namespace bertini
 
 		this->patch_ = other.patch_;
 		is_patched_ = true;
+		slp_.reset();
 	}
 
 
@@ -1069,6 +1310,8 @@ namespace bertini
 				for (auto& iter : this->time_derivatives_)
 					Simplify(iter);
 				break;
+			case JacobianEvalMethod::ForwardMode:
+				break;
 
 		}
 		
@@ -1160,7 +1403,12 @@ namespace bertini
 		else 
 			out << "no path variable defined\n";
 
-		if (s.is_differentiated_)
+		if (s.is_differentiated_ && s.UsesPolynomialSystem())
+		{
+			out << "system is differentiated; jacobian:\n";
+			out << "computed from the exponents of the polynomial system\n\n";
+		}
+		else if (s.is_differentiated_)
 		{
 			out << "system is differentiated; jacobian:\n";
 			switch (s.jacobian_eval_method_)
@@ -1184,6 +1432,9 @@ namespace bertini
 						out << "jac_time_der(" << ii << ") = " << d << "\n";
 					}
 				break;
+			case JacobianEvalMethod::ForwardMode:
+				out << "computed by forward mode differentiation of the straight-line program\n";
+				break;
 			}
 			out << "\n";
 		}
@@ -0,0 +1,228 @@
+//This file is part of Bertini 2.
+//
+//src/tracking/telemetry.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//src/tracking/telemetry.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with src/tracking/telemetry.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+
+/**
+\file src/tracking/telemetry.cpp
+
+\brief Writing, reading, and summarizing trace files of tracker steps.
+*/
+
+#include "bertini2/trackers/telemetry.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace bertini{
+	namespace tracking{
+
+		namespace {
+			const char TraceMagic[8] = {'B','2','T','R','A','C','E','\0'};
+		}
+
+		constexpr std::uint32_t TraceWriter::Version;
+
+
+		StepRing::StepRing(std::size_t capacity)
+		{
+			std::size_t rounded = 1;
+			while (rounded < capacity)
+				rounded *= 2;
+
+			records_.resize(rounded);
+			mask_ = rounded - 1;
+		}
+
+
+
+		TraceWriter::TraceWriter(std::string const& filename, std::size_t ring_capacity, std::chrono::milliseconds interval) :
+			file_(filename, std::ios::binary | std::ios::trunc),
+			ring_capacity_(ring_capacity),
+			interval_(interval),
+			start_(std::chrono::steady_clock::now())
+		{
+			if (!file_)
+				throw std::runtime_error("unable to open trace file " + filename + " for writing");
+
+			const std::uint32_t version = Version, record_size = sizeof(StepRecord);
+			file_.write(TraceMagic, sizeof(TraceMagic));
+			file_.write(reinterpret_cast<const char*>(&version), sizeof(version));
+			file_.write(reinterpret_cast<const char*>(&record_size), sizeof(record_size));
+
+			thread_ = std::thread([this]{ Run(); });
+		}
+
+
+		TraceWriter::~TraceWriter()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				stop_ = true;
+			}
+			wake_.notify_one();
+			thread_.join();
+
+			std::lock_guard<std::mutex> lock(mutex_);
+			DrainAll();
+		}
+
+
+		StepRing& TraceWriter::NewRing()
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			rings_.push_back(std::make_unique<StepRing>(ring_capacity_));
+			return *rings_.back();
+		}
+
+
+		void TraceWriter::Flush()
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			DrainAll();
+		}
+
+
+		std::size_t TraceWriter::NumWritten() const
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			return num_written_;
+		}
+
+
+		std::size_t TraceWriter::NumDropped() const
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			std::size_t num_dropped = 0;
+			for (auto const& ring : rings_)
+				num_dropped += ring->NumDropped();
+			return num_dropped;
+		}
+
+
+		void TraceWriter::Run()
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			while (!stop_)
+			{
+				wake_.wait_for(lock, interval_, [this]{ return stop_; });
+				DrainAll();
+			}
+		}
+
+
+		// call with the mutex held
+		void TraceWriter::DrainAll()
+		{
+			for (auto& ring : rings_)
+				num_written_ += ring->Drain([this](StepRecord const* records, std::size_t n)
+				{
+					file_.write(reinterpret_cast<const char*>(records), n*sizeof(StepRecord));
+				});
+			file_.flush();
+		}
+
+
+
+		std::vector<StepRecord> ReadTrace(std::string const& filename)
+		{
+			std::ifstream file(filename, std::ios::binary);
+			if (!file)
+				throw std::runtime_error("unable to open trace file " + filename + " for reading");
+
+			char magic[sizeof(TraceMagic)];
+			std::uint32_t version, record_size;
+			file.read(magic, sizeof(magic));
+			file.read(reinterpret_cast<char*>(&version), sizeof(version));
+			file.read(reinterpret_cast<char*>(&record_size), sizeof(record_size));
+
+			if (!file || std::memcmp(magic, TraceMagic, sizeof(TraceMagic))!=0)
+				throw std::runtime_error(filename + " is not a bertini2 trace file");
+			if (version!=TraceWriter::Version || record_size!=sizeof(StepRecord))
+				throw std::runtime_error("trace file " + filename + " is of version " + std::to_string(version) + ", but only version " + std::to_string(TraceWriter::Version) + " can be read");
+
+			std::vector<StepRecord> records;
+			StepRecord r;
+			while (file.read(reinterpret_cast<char*>(&r), sizeof(r)))
+				records.push_back(r);
+			return records;
+		}
+
+
+
+		TraceSummary SummarizeTrace(std::vector<StepRecord> const& records, unsigned num_time_intervals)
+		{
+			TraceSummary summary;
+			summary.failures_by_time.assign(std::max(num_time_intervals, 1u), 0);
+
+			// records of a path are in order within a ring, but the rings are interleaved, so each path's records are put back in order of time
+			std::map<std::uint64_t, std::vector<StepRecord const*>> by_path;
+			for (auto const& r : records)
+				by_path[r.path].push_back(&r);
+
+			for (auto& p : by_path)
+			{
+				auto& path_records = p.second;
+				std::stable_sort(path_records.begin(), path_records.end(), [](StepRecord const* a, StepRecord const* b){ return a->nanoseconds < b->nanoseconds; });
+
+				auto& path = summary.paths[p.first];
+				StepRecord const* previous = nullptr;
+				for (auto r : path_records)
+				{
+					const auto code = static_cast<SuccessCode>(r->success_code);
+					if (code==SuccessCode::NeverStarted)
+					{
+						previous = r;
+						continue;
+					}
+
+					++summary.num_steps;
+					++path.num_steps;
+					++summary.steps_at_precision[r->precision];
+					path.max_precision = std::max(path.max_precision, unsigned(r->precision));
+
+					const double seconds = previous ? (r->nanoseconds - previous->nanoseconds)*1e-9 : 0;
+					summary.seconds_at_precision[r->precision] += seconds;
+					path.seconds += seconds;
+
+					if (code!=SuccessCode::Success)
+					{
+						++summary.num_failed_steps;
+						++path.num_failed_steps;
+						++summary.failures_by_code[code];
+
+						const double abs_t = std::hypot(r->time_real, r->time_imag);
+						const auto last = summary.failures_by_time.size()-1;
+						++summary.failures_by_time[abs_t < 1 ? std::min(static_cast<std::size_t>(abs_t*(last+1)), last) : last];
+					}
+
+					previous = r;
+				}
+			}
+
+			return summary;
+		}
+
+	} // re: namespace tracking
+} // re: namespace bertini
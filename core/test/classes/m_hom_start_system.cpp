@@ -89,8 +89,8 @@ BOOST_AUTO_TEST_CASE(m_hom_system_preliminary_construction_small_example)
 	partition_2 << 1, 0;
 
 
-	BOOST_CHECK(mhom_start_system.valid_partitions_[0] == partition_1);
-	BOOST_CHECK(mhom_start_system.valid_partitions_[1] == partition_2);
+	BOOST_CHECK(mhom_start_system.Partition(0) == partition_1);
+	BOOST_CHECK(mhom_start_system.Partition(1) == partition_2);
 	BOOST_CHECK(mhom_start_system.degree_matrix_(0,0) == 1);
 	BOOST_CHECK(mhom_start_system.degree_matrix_(0,1) == 1);
 	BOOST_CHECK(mhom_start_system.degree_matrix_(1,0) == 2);
@@ -146,8 +146,8 @@ BOOST_AUTO_TEST_CASE(m_hom_system_preliminary_construction_larger_example)
 	Vec<int> partition_2(3);
 	partition_2 << 1, 2, 0;
 
-	BOOST_CHECK(mhom_start_system.valid_partitions_[0]== partition_1);
-	BOOST_CHECK(mhom_start_system.valid_partitions_[1]== partition_2);
+	BOOST_CHECK(mhom_start_system.Partition(0) == partition_1);
+	BOOST_CHECK(mhom_start_system.Partition(1) == partition_2);
 
 	BOOST_CHECK(mhom_start_system.degree_matrix_(0,0) == 1);
 	BOOST_CHECK(mhom_start_system.degree_matrix_(0,1) == 1);
@@ -540,6 +540,76 @@ BOOST_AUTO_TEST_CASE(variable_in_many_variable_groups_in_mhom_construction)
 
 }
 
+
+BOOST_AUTO_TEST_CASE(start_points_are_addressed_by_index_without_enumerating_partitions)
+{
+	/*
+		variable groups {x,y}, {z}, both affine.
+		f1 = x*z + 1           degrees [1 1]
+		f2 = x^2 + y*z         degrees [2 1]
+		f3 = y*z^2 + x         degrees [1 2]
+
+		valid partitions <0,0,1>, <0,1,0>, <1,0,0>, with 1*2*2 + 1*1*1 + 1*2*1 = 7 start points.
+	*/
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	auto x = MakeVariable("x");
+	auto y = MakeVariable("y");
+	auto z = MakeVariable("z");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddVariableGroup(VariableGroup{z});
+
+	sys.AddFunction(x*z + 1);
+	sys.AddFunction(pow(x,2) + y*z);
+	sys.AddFunction(y*pow(z,2) + x);
+
+	auto mhom_start_system = bertini::start_system::MHomogeneous(sys);
+
+	BOOST_CHECK_EQUAL(mhom_start_system.NumPartitions(), 3);
+	BOOST_CHECK_EQUAL(mhom_start_system.NumStartPoints(), 7);
+
+	Vec<int> partition_1(3), partition_2(3), partition_3(3);
+	partition_1 << 0, 0, 1;
+	partition_2 << 0, 1, 0;
+	partition_3 << 1, 0, 0;
+	BOOST_CHECK(mhom_start_system.Partition(0) == partition_1);
+	BOOST_CHECK(mhom_start_system.Partition(1) == partition_2);
+	BOOST_CHECK(mhom_start_system.Partition(2) == partition_3);
+	BOOST_CHECK_THROW(mhom_start_system.Partition(3), std::out_of_range);
+
+	std::vector<Vec<dbl>> start_points;
+	for (unsigned long long ii = 0; ii < mhom_start_system.NumStartPoints(); ++ii)
+	{
+		auto start = mhom_start_system.StartPoint<dbl>(ii);
+		BOOST_REQUIRE_EQUAL(start.size(), 3);
+
+		auto function_values = mhom_start_system.Eval(start);
+		for (int jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < relaxed_threshold_clearance_d);
+
+		for (auto const& other : start_points)
+			BOOST_CHECK((start - other).norm() > 1e-8);
+		start_points.push_back(start);
+	}
+
+	// these share blocks with the ones above, so are remembered rather than solved again, and must agree
+	for (unsigned long long ii = 0; ii < mhom_start_system.NumStartPoints(); ++ii)
+	{
+		auto start = mhom_start_system.StartPoint<dbl>(ii);
+		BOOST_CHECK((start - start_points[ii]).norm() < relaxed_threshold_clearance_d);
+
+		auto start_mp = mhom_start_system.StartPoint<mpfr>(ii);
+		BOOST_CHECK_EQUAL(bertini::Precision(start_mp), CLASS_TEST_MPFR_DEFAULT_DIGITS);
+		auto function_values = mhom_start_system.Eval(start_mp);
+		for (int jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < threshold_clearance_mp);
+	}
+
+	BOOST_CHECK_THROW(mhom_start_system.StartPoint<dbl>(7), std::out_of_range);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
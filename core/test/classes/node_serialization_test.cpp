@@ -39,6 +39,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <fstream>
+#include <sstream>
 
 #include "bertini2/function_tree.hpp"
 #include "bertini2/system/system.hpp"
@@ -203,6 +204,37 @@ BOOST_AUTO_TEST_CASE(system_serialize)
 
 }
 
+BOOST_AUTO_TEST_CASE(system_serialize_eval_method)
+{
+	std::string str = "function f1, f2; variable_group x1, x2; y = x1*x2; f1 = y*y; f2 = x1*y; ";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+	sys.SetEvalMethod(bertini::EvalMethod::StraightLineProgram);
+
+	std::stringstream archive;
+	{
+		boost::archive::text_oarchive oa(archive);
+		oa << sys;
+	}
+
+	bertini::System sys2;
+	{
+		boost::archive::text_iarchive ia(archive);
+		ia >> sys2;
+	}
+
+	BOOST_CHECK(sys2.GetEvalMethod()==bertini::EvalMethod::StraightLineProgram);
+
+	Vec<dbl> values(2);
+	values(0) = dbl(2.0);
+	values(1) = dbl(3.0);
+
+	Vec<dbl> v = sys2.Eval(values);
+	BOOST_CHECK_EQUAL(v(0), 36.0);
+	BOOST_CHECK_EQUAL(v(1), 12.0);
+}
+
 BOOST_AUTO_TEST_CASE(system_clone)
 {
 	std::string str = "function f1, f2; variable_group x1, x2; y = x1*x2; f1 = y*y; f2 = x1*y; ";
@@ -0,0 +1,232 @@
+//This file is part of Bertini 2.
+//
+//polynomial_system_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//polynomial_system_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with polynomial_system_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+#include <boost/test/unit_test.hpp>
+#include "bertini2/system/polynomial_system.hpp"
+#include "bertini2/system/system.hpp"
+#include "bertini2/io/parsing/system_parsers.hpp"
+
+using PolynomialSystem = bertini::PolynomialSystem;
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+template<typename NumType> using Mat = bertini::Mat<NumType>;
+using dbl = bertini::dbl;
+using mpfr = bertini::mpfr_complex;
+
+BOOST_AUTO_TEST_SUITE(polynomial_system_tests)
+
+
+bertini::System Parse(std::string const& str)
+{
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+	return sys;
+}
+
+
+BOOST_AUTO_TEST_CASE(expands_into_monomials)
+{
+	auto sys = Parse("function f, g; variable_group x, y; f = (x+y)^2 - 1; g = x*(y - x) + x^2;");
+
+	PolynomialSystem poly(sys);
+
+	BOOST_CHECK_EQUAL(poly.NumFunctions(), 2);
+	BOOST_CHECK_EQUAL(poly.NumVariables(), 2);
+	BOOST_CHECK(!poly.HavePathVariable());
+
+	// x^2 + 2xy + y^2 - 1
+	BOOST_CHECK_EQUAL(poly.NumMonomials(0), 4);
+
+	// the x^2 terms of g collect into one monomial, whose coefficient is 0
+	BOOST_CHECK_EQUAL(poly.NumMonomials(1), 2);
+	BOOST_CHECK_EQUAL(poly.NumMonomials(), 6);
+
+	std::vector<std::vector<int>> exponents;
+	for (size_t ii = 0; ii < poly.NumMonomials(0); ++ii)
+		exponents.push_back(poly.Exponents(poly.FirstMonomial(0) + ii));
+
+	std::vector<std::vector<int>> expected{{0,0}, {0,2}, {1,1}, {2,0}};
+	BOOST_CHECK(exponents == expected);
+}
+
+
+BOOST_AUTO_TEST_CASE(matches_function_tree_with_path_variable)
+{
+	auto sys = Parse("function f, g, h; variable_group x, y, z; pathvariable t; f = x^2*y + 3*x*z - t*y^5; g = (x - 2*y)^3/7 + z*t + sqrt(2)*x; h = (1-t)*(x*y*z - 1) + t*(x^3 - y)*(z + 1);");
+
+	auto sys_poly = sys;
+	sys_poly.SetEvalMethod(bertini::EvalMethod::Polynomial);
+
+	Vec<dbl> x(3);
+	x << dbl(0.5, 0.1), dbl(-0.2, 1.0), dbl(1.5, -0.7);
+	dbl t(0.3, 0.1);
+
+	auto f = sys.Eval(x, t);
+	auto J = sys.Jacobian(x, t);
+	auto dt = sys.TimeDerivative(x, t);
+
+	auto f_poly = sys_poly.Eval(x, t);
+	auto J_poly = sys_poly.Jacobian(x, t);
+	auto dt_poly = sys_poly.TimeDerivative(x, t);
+
+	for (int ii=0; ii<3; ++ii)
+	{
+		BOOST_CHECK_SMALL(abs(f(ii) - f_poly(ii)), 1e-12);
+		BOOST_CHECK_SMALL(abs(dt(ii) - dt_poly(ii)), 1e-12);
+		for (int jj=0; jj<3; ++jj)
+			BOOST_CHECK_SMALL(abs(J(ii,jj) - J_poly(ii,jj)), 1e-12);
+	}
+
+	// and in multiple precision, after changing it
+	sys.precision(50);
+	sys_poly.precision(50);
+	bertini::DefaultPrecision(50);
+
+	Vec<mpfr> x_mp(3);
+	x_mp << mpfr("0.5","0.1"), mpfr("-0.2","1.0"), mpfr("1.5","-0.7");
+	mpfr t_mp("0.3","0.1");
+
+	auto f_mp = sys.Eval(x_mp, t_mp);
+	auto J_mp = sys.Jacobian(x_mp, t_mp);
+	auto dt_mp = sys.TimeDerivative(x_mp, t_mp);
+
+	auto f_poly_mp = sys_poly.Eval(x_mp, t_mp);
+	auto J_poly_mp = sys_poly.Jacobian(x_mp, t_mp);
+	auto dt_poly_mp = sys_poly.TimeDerivative(x_mp, t_mp);
+
+	for (int ii=0; ii<3; ++ii)
+	{
+		BOOST_CHECK_EQUAL(bertini::Precision(f_poly_mp(ii)), 50);
+		BOOST_CHECK(abs(f_mp(ii) - f_poly_mp(ii)) < bertini::mpfr_float("1e-45"));
+		BOOST_CHECK(abs(dt_mp(ii) - dt_poly_mp(ii)) < bertini::mpfr_float("1e-45"));
+		for (int jj=0; jj<3; ++jj)
+			BOOST_CHECK(abs(J_mp(ii,jj) - J_poly_mp(ii,jj)) < bertini::mpfr_float("1e-45"));
+	}
+
+	bertini::DefaultPrecision(16);
+}
+
+
+BOOST_AUTO_TEST_CASE(coefficients_round_from_exact_numbers)
+{
+	// 0.1 is known to far more digits than the system is at, and 1/3 exactly
+	bertini::DefaultPrecision(100);
+	auto a = bertini::MakeFloat(std::string("0.1"));
+	bertini::DefaultPrecision(16);
+	auto b = bertini::MakeRational(std::string("1/3"), std::string("0"));
+
+	auto x = bertini::MakeVariable("x");
+	auto y = bertini::MakeVariable("y");
+	bertini::System sys;
+	sys.AddVariableGroup(bertini::VariableGroup{x, y});
+	sys.AddFunction(a*x*x + x*y - b);
+	sys.AddFunction(b*y*y - a*x);
+
+	// so that the numbers of the system hold their values at 16 digits
+	Vec<mpfr> x16(2);
+	x16 << mpfr("0.5","0.1"), mpfr("-0.2","1.0");
+	sys.Eval(x16);
+
+	// raise the precision of the polynomial system alone
+	PolynomialSystem poly(sys);
+	poly.precision(50);
+	bertini::DefaultPrecision(50);
+
+	Vec<mpfr> x50(2);
+	x50 << mpfr("0.5","0.1"), mpfr("-0.2","1.0");
+	poly.Eval(x50);
+	Vec<mpfr> f(2);
+	poly.GetFuncValsInPlace(f);
+
+	mpfr tenth("0.1","0"), third = mpfr(1)/3;
+	Vec<mpfr> expected(2);
+	expected << tenth*x50(0)*x50(0) + x50(0)*x50(1) - third, third*x50(1)*x50(1) - tenth*x50(0);
+
+	for (int ii=0; ii<2; ++ii)
+		BOOST_CHECK(abs(f(ii) - expected(ii)) < bertini::mpfr_float("1e-45"));
+
+	BOOST_CHECK_EQUAL(sys.precision(), 16);
+
+	bertini::DefaultPrecision(16);
+}
+
+
+BOOST_AUTO_TEST_CASE(matches_function_tree_with_patch)
+{
+	auto sys = Parse("function f, g; variable_group x, y; f = x^3 + x*y - 2; g = y^2 - 3*x + 1;");
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto sys_poly = sys;
+	sys_poly.SetEvalMethod(bertini::EvalMethod::Polynomial);
+
+	Vec<dbl> x(3);
+	x << dbl(1.0, 0.2), dbl(0.5, 0.1), dbl(-0.2, 1.0);
+
+	auto f = sys.Eval(x);
+	auto J = sys.Jacobian(x);
+	auto f_poly = sys_poly.Eval(x);
+	auto J_poly = sys_poly.Jacobian(x);
+
+	BOOST_CHECK_EQUAL(f_poly.size(), 3);
+	BOOST_CHECK_EQUAL(J_poly.rows(), 3);
+	for (int ii=0; ii<3; ++ii)
+	{
+		BOOST_CHECK_SMALL(abs(f(ii) - f_poly(ii)), 1e-12);
+		for (int jj=0; jj<3; ++jj)
+			BOOST_CHECK_SMALL(abs(J(ii,jj) - J_poly(ii,jj)), 1e-12);
+	}
+
+	// the functions and the derivatives are evaluated separately, so asking for the functions doesn't stop the derivatives being evaluated
+	x << dbl(0.3, -0.2), dbl(-1.1, 0.4), dbl(0.7, 0.7);
+	f = sys.Eval(x);
+	f_poly = sys_poly.Eval(x);
+	J = sys.Jacobian(x);
+	J_poly = sys_poly.Jacobian(x);
+	for (int ii=0; ii<3; ++ii)
+	{
+		BOOST_CHECK_SMALL(abs(f(ii) - f_poly(ii)), 1e-12);
+		for (int jj=0; jj<3; ++jj)
+			BOOST_CHECK_SMALL(abs(J(ii,jj) - J_poly(ii,jj)), 1e-12);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(non_polynomial_systems_are_not_expanded)
+{
+	auto sys = Parse("function f; variable_group x; f = sin(x) + 1;");
+	BOOST_CHECK_THROW(PolynomialSystem{sys}, std::runtime_error);
+
+	sys.SetEvalMethod(bertini::EvalMethod::Polynomial);
+	Vec<dbl> x(1);
+	x << dbl(0.5, 0.1);
+	BOOST_CHECK_THROW(sys.Eval(x), std::runtime_error);
+
+	// but functions of constants are coefficients
+	auto constants = Parse("function f; variable_group x; f = sin(2)*x^2 + exp(1)*x - sqrt(3);");
+	PolynomialSystem poly(constants);
+	BOOST_CHECK_EQUAL(poly.NumMonomials(), 3);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,6 +1,7 @@
 #include <boost/test/unit_test.hpp>
 #include "bertini2/system/straight_line_program.hpp"
 #include "bertini2/system/system.hpp"
+#include "bertini2/system/slp_batch.hpp"
 #include "bertini2/io/parsing/system_parsers.hpp"
 
 using bertini::MakeVariable;
@@ -9,6 +10,7 @@ using SLP = bertini::StraightLineProgram;
 template<typename NumType> using Vec = bertini::Vec<NumType>;
 template<typename NumType> using Mat = bertini::Mat<NumType>;
 using dbl = bertini::dbl;
+using mpfr = bertini::mpfr_complex;
 
 BOOST_AUTO_TEST_SUITE(SLP_tests)
 
@@ -234,4 +236,695 @@ BOOST_AUTO_TEST_CASE(evaluate_three_variable_system)
 
 
 
+
+BOOST_AUTO_TEST_CASE(evaluate_with_path_variable_and_subfunction)
+{
+	std::string str = "function f, g; variable_group x1, x2; pathvariable t; parameter s; s = t; y = x1*x2; f = y*y - s*x1; g = x1^3 + x2 - (1-s)*2;";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+
+	auto slp = SLP(sys);
+
+	BOOST_CHECK(slp.HavePathVariable());
+	BOOST_CHECK_EQUAL(slp.NumPatches(), 0);
+
+	Vec<dbl> x(2);
+	x << dbl(2.0, 1.0), dbl(3.0, -0.5);
+	dbl t(0.3, 0.1);
+
+	slp.Eval(x, t);
+
+	auto f = slp.GetFuncVals<dbl>();
+	auto J = slp.GetJacobian<dbl>();
+	auto dt = slp.GetTimeDeriv<dbl>();
+
+	auto f_sys = sys.Eval(x, t);
+	auto J_sys = sys.Jacobian(x, t);
+	auto dt_sys = sys.TimeDerivative(x, t);
+
+	for (int ii=0; ii<2; ++ii)
+	{
+		BOOST_CHECK_SMALL(abs(f(ii) - f_sys(ii)), 1e-13);
+		BOOST_CHECK_SMALL(abs(dt(ii) - dt_sys(ii)), 1e-13);
+		for (int jj=0; jj<2; ++jj)
+			BOOST_CHECK_SMALL(abs(J(ii,jj) - J_sys(ii,jj)), 1e-13);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(evaluate_patched_homogenized_system)
+{
+	auto sys = TwoVariableTestSystem();
+	auto t = MakeVariable("t");
+	sys.AddPathVariable(t);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto slp = SLP(sys);
+
+	BOOST_CHECK_EQUAL(slp.NumPatches(), sys.NumPatches());
+	BOOST_CHECK_EQUAL(slp.NumTotalFunctions(), sys.NumTotalFunctions());
+	BOOST_CHECK_EQUAL(slp.NumVariables(), sys.NumVariables());
+
+	Vec<dbl> x(3);
+	x << dbl(0.5, 0.1), dbl(-0.2, 1.0), dbl(1.5, -0.7);
+	dbl time(0.5, 0.5);
+
+	slp.Eval(x, time);
+
+	auto f = slp.GetFuncVals<dbl>();
+	auto J = slp.GetJacobian<dbl>();
+	auto dt = slp.GetTimeDeriv<dbl>();
+
+	auto f_sys = sys.Eval(x, time);
+	auto J_sys = sys.Jacobian(x, time);
+	auto dt_sys = sys.TimeDerivative(x, time);
+
+	BOOST_REQUIRE_EQUAL(f.size(), f_sys.size());
+	BOOST_REQUIRE_EQUAL(J.rows(), J_sys.rows());
+	BOOST_REQUIRE_EQUAL(J.cols(), J_sys.cols());
+
+	for (int ii=0; ii<f.size(); ++ii)
+	{
+		BOOST_CHECK_SMALL(abs(f(ii) - f_sys(ii)), 1e-13);
+		BOOST_CHECK_SMALL(abs(dt(ii) - dt_sys(ii)), 1e-13);
+		for (int jj=0; jj<J.cols(); ++jj)
+			BOOST_CHECK_SMALL(abs(J(ii,jj) - J_sys(ii,jj)), 1e-13);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(system_eval_method_slp_matches_function_tree)
+{
+	bertini::DefaultPrecision(30);
+
+	std::string str = "function f, g; variable_group x1, x2; pathvariable t; parameter s; s = t; y = x1*x2; f = y*y - s*x1 + sqrt(x2); g = exp(x1) + x2 - (1-s)*2;";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto sys_slp = sys;
+	sys_slp.SetEvalMethod(bertini::EvalMethod::StraightLineProgram);
+
+	BOOST_CHECK(sys.GetEvalMethod()==bertini::EvalMethod::FunctionTree);
+	BOOST_CHECK(sys_slp.GetEvalMethod()==bertini::EvalMethod::StraightLineProgram);
+
+	Vec<dbl> x(3);
+	x << dbl(0.5, 0.1), dbl(-0.2, 1.0), dbl(1.5, -0.7);
+	dbl t(0.3, 0.1);
+
+	auto f = sys.Eval(x, t);
+	auto J = sys.Jacobian(x, t);
+	auto dt = sys.TimeDerivative(x, t);
+
+	// twice, the second time reusing the evaluation of the first
+	for (int rep=0; rep<2; ++rep)
+	{
+		auto f_slp = sys_slp.Eval(x, t);
+		auto J_slp = sys_slp.Jacobian(x, t);
+		auto dt_slp = sys_slp.TimeDerivative(x, t);
+
+		for (int ii=0; ii<f.size(); ++ii)
+		{
+			BOOST_CHECK_SMALL(abs(f(ii) - f_slp(ii)), 1e-13);
+			BOOST_CHECK_SMALL(abs(dt(ii) - dt_slp(ii)), 1e-13);
+			for (int jj=0; jj<J.cols(); ++jj)
+				BOOST_CHECK_SMALL(abs(J(ii,jj) - J_slp(ii,jj)), 1e-13);
+		}
+	}
+
+	// and in multiple precision, after changing it
+	sys.precision(50);
+	sys_slp.precision(50);
+	bertini::DefaultPrecision(50);
+
+	Vec<mpfr> x_mp(3);
+	x_mp << mpfr("0.5","0.1"), mpfr("-0.2","1.0"), mpfr("1.5","-0.7");
+	mpfr t_mp("0.3","0.1");
+
+	auto f_mp = sys.Eval(x_mp, t_mp);
+	auto J_mp = sys.Jacobian(x_mp, t_mp);
+	auto dt_mp = sys.TimeDerivative(x_mp, t_mp);
+
+	auto f_slp_mp = sys_slp.Eval(x_mp, t_mp);
+	auto J_slp_mp = sys_slp.Jacobian(x_mp, t_mp);
+	auto dt_slp_mp = sys_slp.TimeDerivative(x_mp, t_mp);
+
+	for (int ii=0; ii<f_mp.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(bertini::Precision(f_slp_mp(ii)), 50);
+		BOOST_CHECK(abs(f_mp(ii) - f_slp_mp(ii)) < bertini::mpfr_float("1e-45"));
+		BOOST_CHECK(abs(dt_mp(ii) - dt_slp_mp(ii)) < bertini::mpfr_float("1e-45"));
+		for (int jj=0; jj<J_mp.cols(); ++jj)
+			BOOST_CHECK(abs(J_mp(ii,jj) - J_slp_mp(ii,jj)) < bertini::mpfr_float("1e-45"));
+	}
+
+	bertini::DefaultPrecision(16);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(system_eval_method_slp_with_eval_context)
+{
+	auto sys = TwoVariableTestSystem();
+	sys.SetEvalMethod(bertini::EvalMethod::StraightLineProgram);
+
+	auto ctx = sys.NewEvalContext();
+
+	Vec<dbl> v1(2), v2(2);
+	v1 << dbl(0.5, 0.1), dbl(-0.2, 1.0);
+	v2 << dbl(1.5, -0.7), dbl(0.25, 0.5);
+
+	auto f1 = sys.Eval(v1);
+	auto J1 = sys.Jacobian(v1);
+
+	auto f2_ctx = sys.Eval(ctx, v2);
+	auto J2_ctx = sys.Jacobian(ctx, v2);
+
+	// the evaluation through the context didn't disturb the system's own
+	BOOST_CHECK_EQUAL(sys.Eval<dbl>(), f1);
+	BOOST_CHECK_EQUAL(sys.Jacobian<dbl>(), J1);
+
+	BOOST_CHECK_EQUAL(f2_ctx, sys.Eval(v2));
+	BOOST_CHECK_EQUAL(J2_ctx, sys.Jacobian(v2));
+}
+
+
+
+
+BOOST_AUTO_TEST_CASE(optimization_shrinks_program)
+{
+	std::string str = "function f, g; variable_group x, y, z; f = (x*y)^2 + y*x + 2*3; g = x*y*z + sin(2)*z;";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+
+	auto slp = SLP(sys);
+	auto slp_plain = SLP(sys, false);
+
+	auto const& report = slp.GetOptimizationReport();
+
+	BOOST_CHECK_EQUAL(report.InstructionsBefore, slp_plain.NumInstructions());
+	BOOST_CHECK_EQUAL(report.MemoryBefore, slp_plain.MemorySize());
+	BOOST_CHECK_EQUAL(report.InstructionsAfter, slp.NumInstructions());
+	BOOST_CHECK_EQUAL(report.MemoryAfter, slp.MemorySize());
+
+	BOOST_CHECK(report.InstructionsAfter < report.InstructionsBefore);
+	BOOST_CHECK(report.MemoryAfter < report.MemoryBefore);
+	BOOST_CHECK(report.CommonSubexpressions > 0);
+	BOOST_CHECK(report.FoldedConstants > 0);
+
+	Vec<dbl> x(3);
+	x << dbl(0.5, 0.1), dbl(-0.2, 1.0), dbl(1.5, -0.7);
+
+	slp.Eval(x);
+	slp_plain.Eval(x);
+
+	auto f = slp.GetFuncVals<dbl>();
+	auto J = slp.GetJacobian<dbl>();
+	auto f_plain = slp_plain.GetFuncVals<dbl>();
+	auto J_plain = slp_plain.GetJacobian<dbl>();
+
+	for (int ii=0; ii<2; ++ii)
+	{
+		BOOST_CHECK_SMALL(abs(f(ii) - f_plain(ii)), 1e-14);
+		for (int jj=0; jj<3; ++jj)
+			BOOST_CHECK_SMALL(abs(J(ii,jj) - J_plain(ii,jj)), 1e-14);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(optimization_shares_equal_floats_and_rationals)
+{
+	// two systems alike but for whether their numbers are equal.  equal numbers are made separately, so are different nodes
+	auto MakeSystem = [](std::string const& float1, std::string const& float2, std::string const& rational1, std::string const& rational2)
+	{
+		auto x = MakeVariable("x"), y = MakeVariable("y");
+		bertini::System sys;
+		sys.AddVariableGroup(bertini::VariableGroup{x, y});
+		sys.AddFunction(bertini::MakeFloat(float1)*x + bertini::MakeRational(rational1, std::string("0"))*y);
+		sys.AddFunction(bertini::MakeFloat(float2)*x - bertini::MakeRational(rational2, std::string("0"))*y);
+		return sys;
+	};
+
+	auto sys_equal = MakeSystem("0.1", "0.1", "1/3", "1/3");
+	auto sys_distinct = MakeSystem("0.1", "0.2", "1/3", "1/5");
+
+	auto slp_equal = SLP(sys_equal);
+	auto slp_distinct = SLP(sys_distinct);
+
+	auto const& report_equal = slp_equal.GetOptimizationReport();
+	auto const& report_distinct = slp_distinct.GetOptimizationReport();
+
+	// the equal numbers are one each, so their products with the variables are computed once
+	BOOST_CHECK_EQUAL(report_equal.NumbersBefore, report_distinct.NumbersBefore);
+	BOOST_CHECK(report_equal.NumbersAfter < report_distinct.NumbersAfter);
+	BOOST_CHECK(report_equal.CommonSubexpressions >= report_distinct.CommonSubexpressions + 2);
+
+	Vec<dbl> x(2);
+	x << dbl(0.5, 0.1), dbl(-0.2, 1.0);
+	slp_equal.Eval(x);
+	auto f = slp_equal.GetFuncVals<dbl>();
+	auto f_sys = sys_equal.Eval(x);
+	for (int ii=0; ii<2; ++ii)
+		BOOST_CHECK_SMALL(abs(f(ii) - f_sys(ii)), 1e-14);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(optimized_program_matches_system_in_multiple_precision)
+{
+	bertini::DefaultPrecision(30);
+
+	std::string str = "function f, g; variable_group x1, x2; pathvariable t; parameter s; s = t; y = x1*x2; f = y*y - s*x1 + 1/3; g = x1^3 + x2 - (1-s)*2 + y;";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto slp = SLP(sys);
+	BOOST_CHECK(slp.GetOptimizationReport().InstructionsAfter < slp.GetOptimizationReport().InstructionsBefore);
+
+	// changing precision must resample the folded numbers too
+	sys.precision(60);
+	slp.precision(60);
+	bertini::DefaultPrecision(60);
+
+	Vec<mpfr> x(3);
+	x << mpfr("0.5","0.1"), mpfr("-0.2","1.0"), mpfr("1.5","-0.7");
+	mpfr t("0.3","0.1");
+
+	slp.Eval(x, t);
+
+	auto f = slp.GetFuncVals<mpfr>();
+	auto J = slp.GetJacobian<mpfr>();
+	auto dt = slp.GetTimeDeriv<mpfr>();
+
+	auto f_sys = sys.Eval(x, t);
+	auto J_sys = sys.Jacobian(x, t);
+	auto dt_sys = sys.TimeDerivative(x, t);
+
+	for (int ii=0; ii<f.size(); ++ii)
+	{
+		BOOST_CHECK(abs(f(ii) - f_sys(ii)) < bertini::mpfr_float("1e-55"));
+		BOOST_CHECK(abs(dt(ii) - dt_sys(ii)) < bertini::mpfr_float("1e-55"));
+		for (int jj=0; jj<J.cols(); ++jj)
+			BOOST_CHECK(abs(J(ii,jj) - J_sys(ii,jj)) < bertini::mpfr_float("1e-55"));
+	}
+
+	bertini::DefaultPrecision(16);
+}
+
+
+
+
+BOOST_AUTO_TEST_CASE(changing_precision_back_and_forth)
+{
+	bertini::DefaultPrecision(30);
+
+	std::string str = "function f, g; variable_group x1, x2; pathvariable t; parameter s; s = t; y = x1*x2; f = y*y - s*x1 + 1/3; g = x1^3 + x2 - (1-s)*2 + y;";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto sys_slp = sys;
+	sys_slp.SetEvalMethod(bertini::EvalMethod::StraightLineProgram);
+
+	// returning to a precision reuses the memory kept for it, which must have the numbers exact to that precision
+	for (unsigned digits : {60, 30, 100, 60, 30, 100})
+	{
+		bertini::DefaultPrecision(digits);
+		sys.precision(digits);
+		sys_slp.precision(digits);
+
+		Vec<mpfr> x(3);
+		x << mpfr("0.5","0.1"), mpfr("-0.2","1.0"), mpfr("1.5","-0.7");
+		mpfr t("0.3","0.1");
+
+		auto f = sys.Eval(x, t);
+		auto J = sys.Jacobian(x, t);
+		auto f_slp = sys_slp.Eval(x, t);
+		auto J_slp = sys_slp.Jacobian(x, t);
+
+		const bertini::mpfr_float tol("1e-" + std::to_string(digits-5));
+		for (int ii=0; ii<f.size(); ++ii)
+		{
+			BOOST_CHECK_EQUAL(bertini::Precision(f_slp(ii)), digits);
+			BOOST_CHECK(abs(f(ii) - f_slp(ii)) < tol);
+			for (int jj=0; jj<J.cols(); ++jj)
+				BOOST_CHECK(abs(J(ii,jj) - J_slp(ii,jj)) < tol);
+		}
+	}
+
+	// the function tree was left behind while evaluating with the program, and catches up when it is evaluated again
+	sys_slp.SetEvalMethod(bertini::EvalMethod::FunctionTree);
+
+	Vec<mpfr> x(3);
+	x << mpfr("0.5","0.1"), mpfr("-0.2","1.0"), mpfr("1.5","-0.7");
+	mpfr t("0.3","0.1");
+
+	auto f = sys.Eval(x, t);
+	auto f_tree = sys_slp.Eval(x, t);
+	for (int ii=0; ii<f.size(); ++ii)
+		BOOST_CHECK(abs(f(ii) - f_tree(ii)) < bertini::mpfr_float("1e-95"));
+
+	bertini::DefaultPrecision(16);
+}
+
+
+
+
+BOOST_AUTO_TEST_CASE(rounding_numbers_leaves_the_tree_alone)
+{
+	bertini::DefaultPrecision(20);
+
+	std::string str = "function f, g; variable_group x1, x2; f = x1*x2 - 0.1*x1 + 1/3; g = x1^3 + 2.7*x2 - 1;";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+
+	auto sys_slp = sys;
+	sys_slp.SetEvalMethod(bertini::EvalMethod::StraightLineProgram);
+
+	// the program rounds its numbers to 30 digits on the way, and must leave those of the tree at 20, where the system returns to
+	for (unsigned digits : {20, 30, 20})
+	{
+		bertini::DefaultPrecision(digits);
+		sys_slp.precision(digits);
+
+		Vec<mpfr> x(2);
+		x << mpfr("0.5","0.1"), mpfr("-0.2","1.0");
+		sys_slp.Eval(x);
+	}
+
+	sys_slp.SetEvalMethod(bertini::EvalMethod::FunctionTree);
+
+	Vec<mpfr> x(2);
+	x << mpfr("0.5","0.1"), mpfr("-0.2","1.0");
+
+	auto f = sys.Eval(x);
+	auto f_tree = sys_slp.Eval(x);
+	for (int ii=0; ii<f.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(bertini::Precision(f_tree(ii)), 20);
+		BOOST_CHECK(abs(f(ii) - f_tree(ii)) < bertini::mpfr_float("1e-18"));
+	}
+
+	bertini::DefaultPrecision(16);
+}
+
+
+BOOST_AUTO_TEST_CASE(integer_power_by_squaring)
+{
+	dbl x(0.7, -1.3);
+
+	BOOST_CHECK_EQUAL(bertini::IntegerPower(x, 0), dbl(1));
+	BOOST_CHECK_EQUAL(bertini::IntegerPower(x, 1), x);
+	BOOST_CHECK_SMALL(abs(bertini::IntegerPower(x, 5) - x*x*x*x*x), 1e-14);
+	BOOST_CHECK_SMALL(abs(bertini::IntegerPower(x, 8) - x*x*x*x*x*x*x*x), 1e-13);
+	BOOST_CHECK_SMALL(abs(bertini::IntegerPower(x, -3) - dbl(1)/(x*x*x)), 1e-14);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(packed_evaluation_matches_unpacked)
+{
+	std::string str = "function f, g, h; variable_group x, y, z; pathvariable t; f = x^2*y + 3*x*z - t*y^5; g = x*y + z*t + x^(-2); h = sin(x)*cos(y) + exp(z)^3 - sqrt(x*y);";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+
+	// without optimization, so that the packing has plenty to fuse
+	auto slp = SLP(sys, false);
+
+	BOOST_CHECK(slp.NumPackedInstructions() < slp.NumInstructions());
+
+	Vec<dbl> x(3);
+	x << dbl(0.5, 0.1), dbl(-0.2, 1.0), dbl(1.5, -0.7);
+	dbl t(0.3, 0.1);
+
+	slp.Eval(x, t);
+	auto f = slp.GetFuncVals<dbl>();
+	auto J = slp.GetJacobian<dbl>();
+	auto dt = slp.GetTimeDeriv<dbl>();
+
+	slp.EvalUnpacked<dbl>();
+	auto f_unpacked = slp.GetFuncVals<dbl>();
+	auto J_unpacked = slp.GetJacobian<dbl>();
+	auto dt_unpacked = slp.GetTimeDeriv<dbl>();
+
+	for (int ii=0; ii<3; ++ii)
+	{
+		BOOST_CHECK_SMALL(abs(f(ii) - f_unpacked(ii)), 1e-12);
+		BOOST_CHECK_SMALL(abs(dt(ii) - dt_unpacked(ii)), 1e-12);
+		for (int jj=0; jj<3; ++jj)
+			BOOST_CHECK_SMALL(abs(J(ii,jj) - J_unpacked(ii,jj)), 1e-12);
+	}
+
+	// and the optimized program, packed
+	auto slp_opt = SLP(sys);
+	slp_opt.Eval(x, t);
+	auto f_opt = slp_opt.GetFuncVals<dbl>();
+	auto J_opt = slp_opt.GetJacobian<dbl>();
+	for (int ii=0; ii<3; ++ii)
+	{
+		BOOST_CHECK_SMALL(abs(f_opt(ii) - f_unpacked(ii)), 1e-12);
+		for (int jj=0; jj<3; ++jj)
+			BOOST_CHECK_SMALL(abs(J_opt(ii,jj) - J_unpacked(ii,jj)), 1e-12);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(fingerprint_depends_on_structure_not_numbers)
+{
+	auto make = [](std::string str){
+		bertini::System sys;
+		bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+		return SLP(sys);
+	};
+
+	auto a = make("function f, g; variable_group x, y; f = 2.5*x^2 + 3.1*x*y; g = x - 0.3*y;");
+	auto b = make("function f, g; variable_group x, y; f = 1.7*x^2 + 9.2*x*y; g = x - 4.4*y;");
+	auto c = make("function f, g; variable_group x, y; f = 2.5*x^3 + 3.1*x*y; g = x - 0.3*y;");
+
+	BOOST_CHECK_EQUAL(a.Fingerprint(), b.Fingerprint());
+	BOOST_CHECK(a.Fingerprint() != c.Fingerprint());
+}
+
+
+
+namespace {
+	// stands in for generated code, writing a recognizable value into the first function
+	template<typename T>
+	void WriteFortyTwo(T* m)
+	{
+		m[2] = T(42);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(system_eval_method_compiled_slp)
+{
+	auto sys = TwoVariableTestSystem();
+	sys.SetEvalMethod(bertini::EvalMethod::CompiledStraightLineProgram);
+
+	Vec<dbl> x(2);
+	x << dbl(0.5, 0.1), dbl(-0.2, 1.0);
+
+	// nothing generated for it yet
+	BOOST_CHECK_THROW(sys.Eval(x), std::runtime_error);
+
+	auto fingerprint = SLP(sys).Fingerprint();
+	auto num_registered = bertini::CompiledSLPRegistry::NumRegistered();
+	{
+		// registered only for this scope, so it doesn't leak into later tests
+		bertini::CompiledSLPRegistry::ScopedRegistration registration(bertini::CompiledSLP{fingerprint, "forty_two", &WriteFortyTwo<dbl>, &WriteFortyTwo<mpfr>});
+		BOOST_CHECK(bertini::CompiledSLPRegistry::Find(fingerprint));
+
+		auto f = sys.Eval(x);
+		BOOST_CHECK(sys.GetStraightLineProgram().IsCompiled());
+		BOOST_CHECK_EQUAL(f(0), dbl(42));
+
+		// and back to interpreting
+		sys.SetEvalMethod(bertini::EvalMethod::StraightLineProgram);
+		f = sys.Eval(x);
+		BOOST_CHECK(!sys.GetStraightLineProgram().IsCompiled());
+		BOOST_CHECK_SMALL(abs(f(0) - (x(0)*x(0) + x(1)*x(1) - dbl(1))), 1e-14);
+	}
+
+	BOOST_CHECK(!bertini::CompiledSLPRegistry::Find(fingerprint));
+	BOOST_CHECK_EQUAL(bertini::CompiledSLPRegistry::NumRegistered(), num_registered);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(generated_code_registers_its_evaluators)
+{
+	auto slp = SLP(TwoVariableTestSystem());
+
+	std::stringstream code;
+	bertini::SLPCodeGenerator().Generate(slp, "two_variables", code);
+
+	auto str = code.str();
+	BOOST_CHECK(str.find("void two_variables_EvalDouble(dbl_complex* m)") != std::string::npos);
+	BOOST_CHECK(str.find("void two_variables_EvalMultiprecision(mpfr_complex* m)") != std::string::npos);
+	BOOST_CHECK(str.find(std::to_string(slp.Fingerprint()) + "ull") != std::string::npos);
+	BOOST_CHECK(str.find("Registrar") != std::string::npos);
+}
+
+
+BOOST_AUTO_TEST_CASE(batch_evaluation_matches_pointwise)
+{
+	std::string str = "function f, g, h; variable_group x, y, z; pathvariable t; f = x^2*y + 3*x*z - t*y^5; g = x*y/(z+2) + z*t + x^(-2); h = sin(x)*cos(y) + exp(z)^3 - sqrt(x*y);";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+
+	auto slp = SLP(sys);
+
+	// not a multiple of the lane width, so some lanes are padding
+	const unsigned num_points = 11;
+	const dbl t(0.3, 0.1);
+
+	Mat<dbl> points = bertini::RandomOfUnits<dbl>(3, num_points);
+
+	bertini::SLPBatch batch(slp, num_points);
+	batch.SetPoints(points, t);
+	batch.Eval();
+
+	auto all_f = batch.GetFuncVals();
+	auto all_J = batch.GetJacobians();
+	BOOST_CHECK_EQUAL(all_f.size(), num_points);
+	BOOST_CHECK_EQUAL(all_J.size(), num_points);
+
+	for (unsigned k=0; k<num_points; ++k)
+	{
+		slp.Eval(Vec<dbl>(points.col(k)), t);
+		auto f = slp.GetFuncVals<dbl>();
+		auto J = slp.GetJacobian<dbl>();
+		auto dt = slp.GetTimeDeriv<dbl>();
+		auto batch_dt = batch.GetTimeDeriv(k);
+
+		for (int ii=0; ii<3; ++ii)
+		{
+			BOOST_CHECK_SMALL(abs(all_f[k](ii) - f(ii)), 1e-12);
+			BOOST_CHECK_SMALL(abs(batch_dt(ii) - dt(ii)), 1e-12);
+			for (int jj=0; jj<3; ++jj)
+				BOOST_CHECK_SMALL(abs(all_J[k](ii,jj) - J(ii,jj)), 1e-12);
+		}
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(forward_mode_matches_derivatives)
+{
+	std::string str = "function f, g, h; variable_group x, y, z; pathvariable t; f = x^2*y + 3*x*z - t*y^5; g = x*y/(z+2) + z*t + x^(-2); h = sin(x)*cos(y) + exp(z)^3 - sqrt(x*y) + log(x+t)*tan(z);";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+
+	bertini::System sys_fwd(sys);
+	sys_fwd.SetJacobianEvalMethod(bertini::JacobianEvalMethod::ForwardMode);
+
+	Vec<dbl> x(3);
+	x << dbl(0.5, 0.1), dbl(-0.2, 1.0), dbl(1.5, -0.7);
+	dbl t(0.3, 0.1);
+
+	auto f = sys.Eval(x, t);
+	auto J = sys.Jacobian(x, t);
+	auto dt = sys.TimeDerivative(x, t);
+
+	auto f_fwd = sys_fwd.Eval(x, t);
+	auto J_fwd = sys_fwd.Jacobian(x, t);
+	auto dt_fwd = sys_fwd.TimeDerivative(x, t);
+
+	BOOST_CHECK(sys_fwd.GetStraightLineProgram().DifferentiatesInForwardMode());
+
+	for (int ii=0; ii<3; ++ii)
+	{
+		BOOST_CHECK_SMALL(abs(f(ii) - f_fwd(ii)), 1e-12);
+		BOOST_CHECK_SMALL(abs(dt(ii) - dt_fwd(ii)), 1e-12);
+		for (int jj=0; jj<3; ++jj)
+			BOOST_CHECK_SMALL(abs(J(ii,jj) - J_fwd(ii,jj)), 1e-12);
+	}
+
+	// and in multiple precision
+	sys.precision(50);
+	sys_fwd.precision(50);
+	bertini::DefaultPrecision(50);
+
+	Vec<mpfr> x_mp(3);
+	x_mp << mpfr("0.5","0.1"), mpfr("-0.2","1.0"), mpfr("1.5","-0.7");
+	mpfr t_mp("0.3","0.1");
+
+	auto J_mp = sys.Jacobian(x_mp, t_mp);
+	auto dt_mp = sys.TimeDerivative(x_mp, t_mp);
+	auto J_fwd_mp = sys_fwd.Jacobian(x_mp, t_mp);
+	auto dt_fwd_mp = sys_fwd.TimeDerivative(x_mp, t_mp);
+
+	for (int ii=0; ii<3; ++ii)
+	{
+		BOOST_CHECK(abs(dt_mp(ii) - dt_fwd_mp(ii)) < bertini::mpfr_float("1e-45"));
+		for (int jj=0; jj<3; ++jj)
+			BOOST_CHECK(abs(J_mp(ii,jj) - J_fwd_mp(ii,jj)) < bertini::mpfr_float("1e-45"));
+	}
+
+	// the tangents are parked with the memory while at another precision, and give the same derivatives when taken back out
+	sys_fwd.precision(30);
+	bertini::DefaultPrecision(30);
+	Vec<mpfr> x_30(3);
+	x_30 << mpfr("0.5","0.1"), mpfr("-0.2","1.0"), mpfr("1.5","-0.7");
+	mpfr t_30("0.3","0.1");
+	sys_fwd.Jacobian(x_30, t_30);
+
+	sys_fwd.precision(50);
+	bertini::DefaultPrecision(50);
+	BOOST_CHECK_EQUAL(sys_fwd.Jacobian(x_mp, t_mp), J_fwd_mp);
+	BOOST_CHECK_EQUAL(sys_fwd.TimeDerivative(x_mp, t_mp), dt_fwd_mp);
+
+	bertini::DefaultPrecision(16);
+
+	// the program in forward mode has none of the derivatives in it
+	BOOST_CHECK(SLP(sys, true, false).NumInstructions() < SLP(sys).NumInstructions());
+}
+
+
+BOOST_AUTO_TEST_CASE(forward_mode_with_patch)
+{
+	std::string str = "function f, g; variable_group x, y; f = x^3 + x*y - 2; g = y^2 - exp(x);";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	bertini::System sys_fwd(sys);
+	sys_fwd.SetJacobianEvalMethod(bertini::JacobianEvalMethod::ForwardMode);
+
+	Vec<dbl> x(3);
+	x << dbl(1.0, 0.2), dbl(0.5, 0.1), dbl(-0.2, 1.0);
+
+	auto J = sys.Jacobian(x);
+	auto J_fwd = sys_fwd.Jacobian(x);
+
+	BOOST_CHECK_EQUAL(J_fwd.rows(), 3);
+	BOOST_CHECK_EQUAL(J_fwd.cols(), 3);
+	for (int ii=0; ii<3; ++ii)
+		for (int jj=0; jj<3; ++jj)
+			BOOST_CHECK_SMALL(abs(J(ii,jj) - J_fwd(ii,jj)), 1e-12);
+
+	// batches evaluate the compiled derivatives, which a program in forward mode doesn't have
+	BOOST_CHECK_THROW(bertini::SLPBatch(sys_fwd.GetStraightLineProgram(), 4), std::runtime_error);
+}
+
+
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -433,6 +433,54 @@ BOOST_AUTO_TEST_CASE(quadratic_cubic_quartic_start_points_homogenized_patched)
 
 
 
+BOOST_AUTO_TEST_CASE(total_degree_start_point_blocks_match_start_points_one_at_a_time)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	
+	bertini::System sys;
+	Var x = MakeVariable("x"), y = MakeVariable("y"), z = MakeVariable("z");
+
+	VariableGroup vars{x,y,z};
+
+	sys.AddVariableGroup(vars);  
+	sys.AddFunction(y+x*y + mpfr_float("0.5"));
+	sys.AddFunction(pow(x,3)+x*y+bertini::node::E());
+	sys.AddFunction(pow(x,2)*pow(y,2)+x*y*z*z - 1);
+
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	bertini::start_system::TotalDegree TD(sys);
+	TD.Homogenize();
+
+	// a block starting and ending partway through the roots of the first two functions
+	auto block = TD.StartPoints<dbl>(5, 13);
+	BOOST_CHECK_EQUAL(block.First(), 5);
+	BOOST_CHECK_EQUAL(block.Size(), 13);
+	BOOST_CHECK_EQUAL(block.Coordinates().rows(), 13);
+	BOOST_CHECK_EQUAL(block.Coordinates().cols(), TD.NumVariables());
+	BOOST_CHECK(!block.Contains(4));
+	BOOST_CHECK(!block.Contains(18));
+	BOOST_CHECK_THROW(block.Point(18), std::out_of_range);
+
+	for (unsigned long long ii = 5; ii < 18; ++ii)
+		BOOST_CHECK((block.Point(ii) - TD.StartPoint<dbl>(ii)).norm() < relaxed_threshold_clearance_d);
+
+	auto all = TD.StartPoints<mpfr>(0, TD.NumStartPoints());
+	BOOST_CHECK_EQUAL(all.Size(), 24);
+	for (unsigned long long ii = 0; ii < TD.NumStartPoints(); ++ii)
+	{
+		auto start = all.Point(ii);
+		BOOST_CHECK_EQUAL(bertini::Precision(start), CLASS_TEST_MPFR_DEFAULT_DIGITS);
+		BOOST_CHECK((start - TD.StartPoint<mpfr>(ii)).norm() < threshold_clearance_mp);
+	}
+
+	BOOST_CHECK_THROW(TD.StartPoints<dbl>(20, 5), std::out_of_range);
+	BOOST_CHECK_EQUAL(TD.StartPoints<dbl>(24, 0).Size(), 0);
+}
+
+
+
 BOOST_AUTO_TEST_CASE(total_degree_start_system_precision_16)
 {
 	int this_test_precision{16};
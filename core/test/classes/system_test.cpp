@@ -33,10 +33,12 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <thread>
 
 
 #include "bertini2/system/system.hpp"
 #include "bertini2/system/precon.hpp"
+#include "bertini2/system/sparse_jacobian.hpp"
 #include "bertini2/io/parsing/system_parsers.hpp"
 
 #include "externs.hpp"
@@ -1064,6 +1066,225 @@ BOOST_AUTO_TEST_CASE(clone_system_new_variables_evaluation)
 	BOOST_CHECK_EQUAL(f_clone2,f2);
 }
 
+
+/**
+\class bertini::System
+\test \b system_eval_context_matches_plain_evaluation Evaluating through an EvalContext, which goes through the straight-line program, gives the same values as evaluating the function tree directly, to roundoff, and leaves the values stored in the system alone.
+*/
+BOOST_AUTO_TEST_CASE(system_eval_context_matches_plain_evaluation)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	std::string str = "function f, g; variable_group x1, x2; pathvariable t; parameter s; s = t; y = x1*x2; f = y*y - s*x1; g = x1^3 + x2 - (1-s)*2;";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+
+	auto ctx = sys.NewEvalContext();
+
+	Vec<dbl> v1(2), v2(2);
+	v1 << dbl(2.0, 1.0), dbl(3.0, -0.5);
+	v2 << dbl(-1.0, 0.25), dbl(0.5, 2.0);
+	dbl t1(0.3, 0.1), t2(0.7, -0.2);
+
+	auto f1 = sys.Eval(v1, t1);
+	auto J1 = sys.Jacobian(v1, t1);
+	auto dt1 = sys.TimeDerivative(v1, t1);
+
+	auto f2_ctx = sys.Eval(ctx, v2, t2);
+	auto J2_ctx = sys.Jacobian(ctx, v2, t2);
+	auto dt2_ctx = sys.TimeDerivative(ctx, v2, t2);
+
+	// the system still holds the values from the plain evaluation
+	BOOST_CHECK_EQUAL(sys.Eval<dbl>(), f1);
+	BOOST_CHECK_EQUAL(sys.Jacobian<dbl>(), J1);
+	BOOST_CHECK_EQUAL(sys.TimeDerivative<dbl>(), dt1);
+
+	BOOST_CHECK_SMALL((f2_ctx - sys.Eval(v2, t2)).norm(), 1e-13);
+	BOOST_CHECK_SMALL((J2_ctx - sys.Jacobian(v2, t2)).norm(), 1e-13);
+	BOOST_CHECK_SMALL((dt2_ctx - sys.TimeDerivative(v2, t2)).norm(), 1e-13);
+
+	Vec<mpfr> x(2);
+	x << mpfr(2,1), mpfr(3,-1);
+	mpfr t(1,2);
+	const bertini::mpfr_float tol("1e-" + std::to_string(CLASS_TEST_MPFR_DEFAULT_DIGITS-3));
+	BOOST_CHECK((sys.Eval(ctx, x, t) - sys.Eval(x, t)).norm() < tol);
+	BOOST_CHECK((sys.Jacobian(ctx, x, t) - sys.Jacobian(x, t)).norm() < tol);
+}
+
+
+/**
+\class bertini::System
+\test \b system_eval_context_concurrent_evaluation Several threads, the main one among them, evaluate one shared system at once, each with its own EvalContext, and get the same values as serial evaluation through a context.
+*/
+BOOST_AUTO_TEST_CASE(system_eval_context_concurrent_evaluation)
+{
+	auto sys = bertini::system::Precon::GriewankOsborn();
+	auto ctx_main = sys.NewEvalContext();
+
+	const unsigned num_threads = 4;
+	const unsigned num_points = 50;
+
+	std::vector<Vec<dbl>> points(num_points, Vec<dbl>(2));
+	std::vector<Vec<dbl>> expected_f(num_points);
+	std::vector<Mat<dbl>> expected_J(num_points);
+	for (unsigned ii=0; ii<num_points; ++ii)
+	{
+		points[ii] << dbl(0.1*ii, -0.3), dbl(1.0, 0.05*ii);
+		expected_f[ii] = sys.Eval(ctx_main, points[ii]);
+		expected_J[ii] = sys.Jacobian(ctx_main, points[ii]);
+	}
+
+	std::vector<int> num_mismatches(num_threads, 0);
+	std::vector<std::thread> threads;
+	for (unsigned tt=0; tt<num_threads; ++tt)
+		threads.emplace_back([&, tt]()
+		{
+			auto ctx = sys.NewEvalContext();
+			for (unsigned rep=0; rep<10; ++rep)
+				for (unsigned ii=0; ii<num_points; ++ii)
+				{
+					if (sys.Eval(ctx, points[ii]) != expected_f[ii])
+						++num_mismatches[tt];
+					if (sys.Jacobian(ctx, points[ii]) != expected_J[ii])
+						++num_mismatches[tt];
+				}
+		});
+
+	// and the main thread evaluates at the same time, with its own context
+	int num_main_mismatches = 0;
+	for (unsigned rep=0; rep<10; ++rep)
+		for (unsigned ii=0; ii<num_points; ++ii)
+		{
+			if (sys.Eval(ctx_main, points[ii]) != expected_f[ii])
+				++num_main_mismatches;
+			if (sys.Jacobian(ctx_main, points[ii]) != expected_J[ii])
+				++num_main_mismatches;
+		}
+
+	for (auto& t : threads)
+		t.join();
+
+	BOOST_CHECK_EQUAL(num_main_mismatches, 0);
+	for (auto n : num_mismatches)
+		BOOST_CHECK_EQUAL(n, 0);
+}
+
+
+/**
+\class bertini::System
+\test \b system_jacobian_sparsity_and_sparse_evaluation The sparsity pattern of the Jacobian has exactly the entries for functions depending on variables, plus the patch, and the sparse Jacobian has the same values as the dense one.  Systems evaluating with a straight-line program refuse to evaluate it sparsely.
+*/
+BOOST_AUTO_TEST_CASE(system_jacobian_sparsity_and_sparse_evaluation)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::System sys;
+	Var x = MakeVariable("x"), y = MakeVariable("y"), z = MakeVariable("z"), w = MakeVariable("w");
+
+	sys.AddVariableGroup(VariableGroup{x,y,z,w});
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(pow(y,2) - z);
+	sys.AddFunction(z*w + 2);
+	sys.AddFunction(x + exp(w));
+
+	auto pattern = sys.JacobianSparsity();
+	BOOST_CHECK_EQUAL(pattern.Rows(), 4);
+	BOOST_CHECK_EQUAL(pattern.Cols(), 4);
+	BOOST_CHECK_EQUAL(pattern.NumNonzeros(), 8);
+	BOOST_CHECK(pattern.Contains(0,0)); BOOST_CHECK(pattern.Contains(3,0));
+	BOOST_CHECK(pattern.Contains(0,1)); BOOST_CHECK(pattern.Contains(1,1));
+	BOOST_CHECK(pattern.Contains(1,2)); BOOST_CHECK(pattern.Contains(2,2));
+	BOOST_CHECK(pattern.Contains(2,3)); BOOST_CHECK(pattern.Contains(3,3));
+	BOOST_CHECK(!pattern.Contains(1,0));
+	BOOST_CHECK(!pattern.Contains(0,3));
+
+	Vec<dbl> v(4);
+	v << dbl(2.0, 1.0), dbl(3.0, -0.5), dbl(-1.0, 0.25), dbl(0.5, 2.0);
+	auto J_dense = sys.Jacobian(v);
+	auto J_sparse = pattern.MakeMatrix<dbl>();
+	sys.SparseJacobianInPlace(J_sparse);
+	BOOST_CHECK_EQUAL(Mat<dbl>(J_sparse), J_dense);
+
+	Vec<mpfr> v_mp(4);
+	v_mp << mpfr(2,1), mpfr(3,-1), mpfr(-1,2), mpfr("0.5","0.25");
+	auto J_dense_mp = sys.Jacobian(v_mp);
+	auto J_sparse_mp = pattern.MakeMatrix<mpfr>();
+	sys.SparseJacobianInPlace(J_sparse_mp);
+	BOOST_CHECK_EQUAL(Mat<mpfr>(J_sparse_mp), J_dense_mp);
+
+	// the straight-line program evaluates the whole Jacobian, so it is evaluated densely instead
+	BOOST_CHECK(sys.EvaluatesJacobianSparsely());
+	sys.SetEvalMethod(EvalMethod::StraightLineProgram);
+	BOOST_CHECK(!sys.EvaluatesJacobianSparsely());
+	BOOST_CHECK_THROW(sys.SparseJacobianInPlace(J_sparse), std::runtime_error);
+	sys.SetEvalMethod(EvalMethod::FunctionTree);
+
+	// a matrix without the pattern is refused
+	Eigen::SparseMatrix<dbl> J_wrong(4,4);
+	J_wrong.makeCompressed();
+	BOOST_CHECK_THROW(sys.SparseJacobianInPlace(J_wrong), std::runtime_error);
+}
+
+
+/**
+\class bertini::System
+\test \b system_sparse_jacobian_with_patch_and_sparse_lu The rows of the patch are in the sparsity pattern of a patched system, and solving with the sparse LU, whose analysis is reused across factorizations, matches the dense solve.
+*/
+BOOST_AUTO_TEST_CASE(system_sparse_jacobian_with_patch_and_sparse_lu)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::System sys;
+	Var x = MakeVariable("x"), y = MakeVariable("y"), z = MakeVariable("z");
+
+	sys.AddVariableGroup(VariableGroup{x,y,z});
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(pow(y,2) - z);
+	sys.AddFunction(z*x + 2);
+
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto pattern = sys.JacobianSparsity();
+	BOOST_CHECK_EQUAL(pattern.Rows(), sys.NumTotalFunctions());
+	BOOST_CHECK_EQUAL(pattern.Cols(), sys.NumVariables());
+	for (int jj = 0; jj < pattern.Cols(); ++jj)
+		BOOST_CHECK(pattern.Contains(sys.NumFunctions(), jj));
+
+	bertini::SparseJacobianLU<dbl> lu;
+	lu.Analyze(pattern);
+
+	Vec<dbl> b = Vec<dbl>::Random(sys.NumTotalFunctions());
+	for (unsigned ii = 0; ii < 3; ++ii)
+	{
+		Vec<dbl> v = Vec<dbl>::Random(sys.NumVariables());
+		auto J_dense = sys.Jacobian(v);
+		sys.SparseJacobianInPlace(lu.Matrix());
+		BOOST_CHECK((Mat<dbl>(lu.Matrix()) - J_dense).norm() < 1e-14);
+
+		BOOST_CHECK(lu.Factorize());
+		Vec<dbl> sparse_solution = lu.Solve(b);
+		Vec<dbl> dense_solution = J_dense.lu().solve(b);
+		BOOST_CHECK((sparse_solution - dense_solution).norm() < 1e-10*dense_solution.norm());
+	}
+
+	bertini::SparseJacobianLU<mpfr> lu_mp;
+	lu_mp.Analyze(pattern);
+	Vec<mpfr> v_mp(sys.NumVariables());
+	for (int ii = 0; ii < v_mp.size(); ++ii)
+		v_mp(ii) = mpfr(ii+1, 1-ii);
+	Vec<mpfr> b_mp(sys.NumTotalFunctions());
+	for (int ii = 0; ii < b_mp.size(); ++ii)
+		b_mp(ii) = mpfr(1, ii);
+
+	auto J_dense_mp = sys.Jacobian(v_mp);
+	sys.SparseJacobianInPlace(lu_mp.Matrix());
+	BOOST_CHECK(lu_mp.Factorize());
+	Vec<mpfr> dense_solution_mp = J_dense_mp.lu().solve(b_mp);
+	BOOST_CHECK((lu_mp.Solve(b_mp) - dense_solution_mp).norm() < mpfr_float("1e-25")*dense_solution_mp.norm());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
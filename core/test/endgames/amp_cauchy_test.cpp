@@ -39,6 +39,7 @@
 
 #include "bertini2/endgames/amp_endgame.hpp"
 #include "bertini2/endgames/cauchy.hpp"
+#include "bertini2/endgames/parallel.hpp"
 
 
 #include "bertini2/endgames/observers.hpp"
@@ -32,6 +32,7 @@
 
 #include "bertini2/endgames/fixed_prec_endgame.hpp"
 #include "bertini2/endgames/cauchy.hpp"
+#include "bertini2/endgames/parallel.hpp"
 
 #include "bertini2/endgames/observers.hpp"
 #include "bertini2/trackers/observers.hpp"
@@ -1958,10 +1958,98 @@ BOOST_AUTO_TEST_CASE(total_degree_start_system)
 }
 
 
+/**
+	Runs the endgame on the paths of a total degree homotopy spread over threads, and checks that the results don't depend on the number of threads.
+*/
+BOOST_AUTO_TEST_CASE(run_endgames_on_threads)
+{
+	DefaultPrecision(ambient_precision);
+
+	Var x = MakeVariable("x");
+	Var y = MakeVariable("y");
+	Var t = MakeVariable("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(pow(x-1,3));
+	sys.AddFunction(pow(y-1,2));
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto final_system = (1-t)*sys + t*TD;
+	final_system.AddPathVariable(t);
+
+	auto precision_config = PrecisionConfig(final_system);
+
+	auto tracker = TrackerType(final_system);
+	bertini::tracking::SteppingConfig stepping_preferences;
+	bertini::tracking::NewtonConfig newton_preferences;
+	tracker.Setup(TestedPredictor,
+	              	1e-5, 1e5,
+					stepping_preferences, newton_preferences);
 
+	tracker.PrecisionSetup(precision_config);
 
+	BCT t_start(1);
+	std::vector<Vec<BCT> > homogenized_solutions;
+	for (unsigned ii = 0; ii < TD.NumStartPoints(); ++ii)
+	{
+		DefaultPrecision(ambient_precision);
+		BCT t_endgame_boundary{0.1};
+		final_system.precision(ambient_precision);
+		auto start_point = TD.StartPoint<BCT>(ii);
 
+		Vec<BCT> result;
+		auto tracking_success = tracker.TrackPath(result,t_start,t_endgame_boundary,start_point);
+		BOOST_CHECK(tracking_success==SuccessCode::Success);
+
+		homogenized_solutions.push_back(result);
+	}
+
+	TestedEGType my_endgame(tracker);
 
+	tracker.Setup(TestedPredictor,
+	              	1e-6, 1e5,
+					stepping_preferences, newton_preferences);
+
+	Vec<BCT> correct(2);
+	correct << BCT(1,0),BCT(1,0);
+
+	DefaultPrecision(ambient_precision);
+	BCT t_endgame_boundary{0.1}, t_target{0};
+
+	auto serial_results = bertini::endgame::RunEndgames(my_endgame, t_endgame_boundary, homogenized_solutions, t_target, 1);
+	auto threaded_results = bertini::endgame::RunEndgames(my_endgame, t_endgame_boundary, homogenized_solutions, t_target, 3);
+
+	BOOST_CHECK_EQUAL(serial_results.size(), homogenized_solutions.size());
+	BOOST_CHECK_EQUAL(threaded_results.size(), homogenized_solutions.size());
+
+	for (unsigned ii = 0; ii < homogenized_solutions.size(); ++ii)
+	{
+		auto const& serial = serial_results[ii].state;
+		auto const& threaded = threaded_results[ii].state;
+
+		BOOST_CHECK(serial_results[ii].success==SuccessCode::Success);
+		BOOST_CHECK(threaded_results[ii].success==SuccessCode::Success);
+		BOOST_CHECK_EQUAL(serial.cycle_number, threaded.cycle_number);
+		BOOST_CHECK_EQUAL(Precision(serial.final_approximation), Precision(threaded.final_approximation));
+		BOOST_CHECK((serial.final_approximation - threaded.final_approximation).template lpNorm<Eigen::Infinity>() == 0);
+
+		BOOST_CHECK((final_system.DehomogenizePoint(serial.final_approximation)-correct).template lpNorm<Eigen::Infinity>() < 1e-11);
+	}
+
+	// the state of a path can be put back into an endgame, to look at it as though it had just been run
+	my_endgame.SetPathState(threaded_results[0].state);
+	BOOST_CHECK_EQUAL(my_endgame.CycleNumber(), threaded_results[0].state.cycle_number);
+	BOOST_CHECK((my_endgame.FinalApproximation<BCT>() - threaded_results[0].state.final_approximation).template lpNorm<Eigen::Infinity>() == 0);
+}
 
 
 
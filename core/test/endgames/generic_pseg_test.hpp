@@ -546,6 +546,90 @@ BOOST_AUTO_TEST_CASE(compute_approximation_of_x_at_t0)
 
 
 
+/**
+Derivatives are kept between calls to ComputeAllDerivatives, keyed on the times of the samples.  Setting the samples must forget them, even when the times are the same, or the approximation would use derivatives at the old samples.
+*/
+BOOST_AUTO_TEST_CASE(compute_all_derivatives_after_setting_samples)
+{
+	DefaultPrecision(ambient_precision);
+
+	bertini::System sys;
+	Var x = MakeVariable("x"), t = MakeVariable("t");
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars);
+	sys.AddPathVariable(t);
+	sys.AddFunction( pow(x-1,3)*(1-t) + (pow(x,3)+1)*t);
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+
+	bertini::tracking::SteppingConfig stepping_settings;
+	bertini::tracking::NewtonConfig newton_settings;
+
+	tracker.Setup(TestedPredictor,
+                1e-5,
+                1e5,
+                stepping_settings,
+                newton_settings);
+
+	tracker.PrecisionSetup(precision_config);
+
+	auto origin = BCT(0,0);
+	bertini::TimeCont<BCT> times;
+	bertini::SampCont<BCT> samples, perturbed_samples;
+
+	Vec<BCT> sample(1);
+
+	times.push_back(ComplexFromString(".1"));
+	sample << ComplexFromString("0.50000000000000007812610562824908678293817200689660e0", "0.90818521453245102009102405377246269374768541575725e-16");
+	samples.push_back(sample);
+
+	times.push_back(ComplexFromString(".05"));
+	sample << ComplexFromString("0.60000000000000000073301140774132693211475245208482e0", "0.85317043225116681251211164764202768939258706233715e-18");
+	samples.push_back(sample);
+
+	times.push_back(ComplexFromString(".025"));
+	sample << ComplexFromString("0.67729059415987117534436422700325955211292174181447e0", "0.38712848412230230944976856052769427012481164605204e-16");
+	samples.push_back(sample);
+
+	for (auto const& s : samples)
+		perturbed_samples.push_back(s * ComplexFromString("1.01"));
+
+	bertini::endgame::EndgameConfig endgame_settings;
+
+	TestedEGType my_endgame(tracker,endgame_settings);
+	my_endgame.SetTimes(times);
+	my_endgame.SetSamples(samples);
+	my_endgame.SetRandVec<BCT>(samples.back().size());
+
+	Vec<BCT> approx, approx_again, perturbed_approx, fresh_perturbed_approx;
+
+	my_endgame.ComputeAllDerivatives<BCT>();
+	my_endgame.ComputeApproximationOfXAtT0(approx, origin);
+
+	// nothing changed, so the derivatives are reused
+	my_endgame.ComputeAllDerivatives<BCT>();
+	my_endgame.ComputeApproximationOfXAtT0(approx_again, origin);
+	BOOST_CHECK_SMALL(abs(approx(0) - approx_again(0)), BRT(1e-14));
+
+	my_endgame.SetSamples(perturbed_samples);
+	my_endgame.ComputeAllDerivatives<BCT>();
+	my_endgame.ComputeApproximationOfXAtT0(perturbed_approx, origin);
+
+	TestedEGType fresh_endgame(tracker,endgame_settings);
+	fresh_endgame.SetTimes(times);
+	fresh_endgame.SetSamples(perturbed_samples);
+	fresh_endgame.SetRandVec<BCT>(samples.back().size());
+	fresh_endgame.ComputeAllDerivatives<BCT>();
+	fresh_endgame.ComputeApproximationOfXAtT0(fresh_perturbed_approx, origin);
+
+	BOOST_CHECK(abs(approx(0) - perturbed_approx(0)) > BRT(1e-4));
+	BOOST_CHECK_SMALL(abs(perturbed_approx(0) - fresh_perturbed_approx(0)), BRT(1e-14));
+} // end compute all derivatives after setting samples
+
+
+
 
 
 
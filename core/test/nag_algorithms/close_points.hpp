@@ -0,0 +1,104 @@
+//This file is part of Bertini 2.
+//
+//test/nag_algorithms/close_points.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//test/nag_algorithms/close_points.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with test/nag_algorithms/close_points.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+/**
+\file test/nag_algorithms/close_points.hpp  Points with close neighbors, and the pairs of them found by comparing every pair, for testing the searches for close points which compare fewer.
+*/
+
+// individual authors of this file include:
+// silviana amethyst
+
+#pragma once
+
+#include "bertini2/nag_algorithms/common/projected_neighbors.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace close_points{
+
+	using bertini::dbl;
+	using bertini::Vec;
+	using bertini::algorithm::ProjectionNorm;
+
+
+	inline
+	double Norm(Vec<dbl> const& x, ProjectionNorm norm)
+	{
+		return norm==ProjectionNorm::Two ? x.norm() : x.lpNorm<Eigen::Infinity>();
+	}
+
+
+	/**
+	\brief Random points, at scales over several orders of magnitude, in chains of points each a distance from the one before just inside or just outside the tolerance, in random order.
+
+	\param norm The norm to measure the distances in.
+	\param relative Whether the distances are relative to the norm of the point before.
+	*/
+	inline
+	std::vector<Vec<dbl>> ClusteredPoints(unsigned num_points, unsigned num_variables, double tol, ProjectionNorm norm, bool relative, unsigned seed)
+	{
+		std::mt19937 generator(seed);
+		std::uniform_real_distribution<double> uniform(-1,1);
+		auto RandomPoint = [&](double scale)
+		{
+			Vec<dbl> x(num_variables);
+			for (unsigned ii = 0; ii < num_variables; ++ii)
+				x(ii) = scale*dbl(uniform(generator), uniform(generator));
+			return x;
+		};
+
+		std::vector<Vec<dbl>> points;
+		while (points.size() < num_points)
+		{
+			Vec<dbl> x = RandomPoint(std::pow(10., 4*uniform(generator)));
+			points.push_back(x);
+			while (uniform(generator) > 0.3)
+			{
+				const double distance = tol*(1 + 0.01*uniform(generator)) * (relative ? Norm(x, norm) : 1);
+				Vec<dbl> step = RandomPoint(1);
+				x += (distance/Norm(step, norm)) * step;
+				points.push_back(x);
+			}
+		}
+		std::shuffle(points.begin(), points.end(), generator);
+		return points;
+	}
+
+
+	/**
+	\brief The pairs ii < jj of [0,num_points) for which close(ii,jj), found by comparing every pair, sorted.
+	*/
+	template<typename CloseF>
+	std::vector<std::pair<std::size_t, std::size_t>> EveryClosePair(std::size_t num_points, CloseF const& close)
+	{
+		std::vector<std::pair<std::size_t, std::size_t>> pairs;
+		for (std::size_t ii = 0; ii < num_points; ++ii)
+			for (std::size_t jj = ii+1; jj < num_points; ++jj)
+				if (close(ii, jj))
+					pairs.emplace_back(ii, jj);
+		return pairs;
+	}
+
+} // namespace close_points
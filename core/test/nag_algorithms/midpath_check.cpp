@@ -0,0 +1,188 @@
+//This file is part of Bertini 2.
+//
+//test/nag_algorithms/midpath_check.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//test/nag_algorithms/midpath_check.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with test/nag_algorithms/midpath_check.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+/**
+\file test/nag_algorithms/midpath_check.cpp  Tests the check for crossed paths at the endgame boundary.
+*/
+
+// individual authors of this file include:
+// silviana amethyst
+
+#include "bertini2/nag_algorithms/midpath_check.hpp"
+#include <boost/test/unit_test.hpp>
+
+#include "test/nag_algorithms/close_points.hpp"
+
+BOOST_AUTO_TEST_SUITE(midpath_check)
+
+	using bertini::dbl;
+	using bertini::Vec;
+	using bertini::SuccessCode;
+	using bertini::algorithm::MidPathConfig;
+
+	struct BoundaryMetaData
+	{
+		Vec<dbl> path_point;
+		SuccessCode success_code = SuccessCode::NeverStarted;
+	};
+
+	using Checker = bertini::algorithm::MidpathChecker<double, dbl, BoundaryMetaData>;
+	using PathIndT = Checker::PathIndT;
+
+
+	// start points which repeat every few paths, so some crossed paths have the same start point
+	struct RepeatingStartPoints
+	{
+		unsigned period;
+		unsigned num_variables;
+
+		template<typename T>
+		Vec<T> StartPoint(PathIndT index) const
+		{
+			Vec<T> x(num_variables);
+			for (unsigned ii = 0; ii < num_variables; ++ii)
+				x(ii) = T(index % period + ii);
+			return x;
+		}
+	};
+
+
+	// the check as it was, comparing every pair
+	struct CrossedPathRecord
+	{
+		PathIndT index;
+		std::vector<std::pair<PathIndT, bool>> crossed_with;
+		bool rerun;
+	};
+
+	template<typename StartT>
+	std::vector<CrossedPathRecord> CheckEveryPair(std::vector<BoundaryMetaData> const& boundary_data, StartT const& start_system, double tol)
+	{
+		std::vector<CrossedPathRecord> crossed;
+		auto Record = [&](PathIndT ii, PathIndT jj, bool same_start)
+		{
+			for (auto& v : crossed)
+				if (v.index==ii)
+				{
+					v.crossed_with.emplace_back(jj, same_start);
+					v.rerun = v.rerun || !same_start;
+					return;
+				}
+			crossed.push_back({ii, {{jj, same_start}}, !same_start});
+		};
+
+		auto Crossed = [&](PathIndT ii, PathIndT jj)
+		{
+			auto const& x = boundary_data[ii].path_point;
+			auto const& y = boundary_data[jj].path_point;
+			return boundary_data[ii].success_code == SuccessCode::Success && boundary_data[jj].success_code == SuccessCode::Success
+			    && (x-y).lpNorm<Eigen::Infinity>()/x.lpNorm<Eigen::Infinity>() < tol;
+		};
+
+		for (auto const& pair : close_points::EveryClosePair(boundary_data.size(), Crossed))
+		{
+			const auto ii = pair.first, jj = pair.second;
+			const Vec<dbl> diff_start = start_system.template StartPoint<dbl>(ii) - start_system.template StartPoint<dbl>(jj);
+			bool same_start = diff_start.lpNorm<Eigen::Infinity>() > tol;
+			Record(ii, jj, same_start);
+			Record(jj, ii, same_start);
+		}
+		return crossed;
+	}
+
+
+	// clustered points, some just inside the tolerance of each other and some just outside, with some failed paths and some repeated points
+	std::vector<BoundaryMetaData> MakeBoundaryData(unsigned num_paths, unsigned num_variables, double tol)
+	{
+		const auto points = close_points::ClusteredPoints(num_paths, num_variables, tol, bertini::algorithm::ProjectionNorm::Infinity, true, 42);
+
+		std::vector<BoundaryMetaData> data;
+		for (unsigned ii = 0; ii < points.size(); ++ii)
+		{
+			data.push_back({points[ii], SuccessCode::Success});
+			if (ii % 10 == 3)
+				data.push_back({points[ii], SuccessCode::GoingToInfinity});
+			if (ii % 20 == 7)
+				data.push_back({points[ii], SuccessCode::Success});
+		}
+		return data;
+	}
+
+
+	void CheckSameAsEveryPair(unsigned num_threads)
+	{
+		const double tol = 1e-5;
+		const unsigned num_variables = 4;
+		const auto boundary_data = MakeBoundaryData(2000, num_variables, tol);
+		const RepeatingStartPoints start_system{7, num_variables};
+
+		MidPathConfig config;
+		config.same_point_tolerance = tol;
+		config.num_threads = num_threads;
+		Checker checker(config);
+
+		const bool passed = checker.Check(boundary_data, start_system);
+		const auto expected = CheckEveryPair(boundary_data, start_system, tol);
+		const auto crossed = checker.GetCrossedPaths();
+
+		BOOST_CHECK(!expected.empty());
+		BOOST_CHECK_EQUAL(passed, expected.empty());
+		BOOST_REQUIRE_EQUAL(crossed.size(), expected.size());
+		for (unsigned ii = 0; ii < crossed.size(); ++ii)
+		{
+			BOOST_CHECK_EQUAL(crossed[ii].index(), expected[ii].index);
+			BOOST_CHECK_EQUAL(crossed[ii].rerun(), expected[ii].rerun);
+			BOOST_CHECK(crossed[ii].crossed_with() == expected[ii].crossed_with);
+		}
+	}
+
+
+	BOOST_AUTO_TEST_CASE(same_crossed_paths_as_every_pair)
+	{
+		CheckSameAsEveryPair(1);
+	}
+
+
+	BOOST_AUTO_TEST_CASE(same_crossed_paths_as_every_pair_threaded)
+	{
+		CheckSameAsEveryPair(4);
+	}
+
+
+	BOOST_AUTO_TEST_CASE(distinct_points_pass)
+	{
+		MidPathConfig config;
+		Checker checker(config);
+
+		std::vector<BoundaryMetaData> boundary_data;
+		for (unsigned ii = 0; ii < 100; ++ii)
+		{
+			Vec<dbl> x(2);
+			x << dbl(ii), dbl(1);
+			boundary_data.push_back({x, SuccessCode::Success});
+		}
+
+		BOOST_CHECK(checker.Check(boundary_data, RepeatingStartPoints{3, 2}));
+		BOOST_CHECK(checker.GetCrossedPaths().empty());
+	}
+
+
+BOOST_AUTO_TEST_SUITE_END()
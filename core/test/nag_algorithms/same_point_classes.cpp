@@ -0,0 +1,110 @@
+//This file is part of Bertini 2.
+//
+//test/nag_algorithms/same_point_classes.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//test/nag_algorithms/same_point_classes.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with test/nag_algorithms/same_point_classes.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+/**
+\file test/nag_algorithms/same_point_classes.cpp  Tests grouping endpoints into classes of the same point, for multiplicities.
+*/
+
+// individual authors of this file include:
+// silviana amethyst
+
+#include "bertini2/nag_algorithms/common/same_point_classes.hpp"
+#include <boost/test/unit_test.hpp>
+
+#include "test/nag_algorithms/close_points.hpp"
+
+BOOST_AUTO_TEST_SUITE(same_point_classes)
+
+	using bertini::dbl;
+	using bertini::Vec;
+	using bertini::algorithm::DisjointSets;
+	using bertini::algorithm::SamePointClasses;
+
+
+	std::vector<std::size_t> CompareEveryPair(std::vector<Vec<dbl>> const& points, std::vector<bool> const& included, double tol)
+	{
+		auto Same = [&](std::size_t ii, std::size_t jj)
+		{
+			return included[ii] && included[jj] && (points[ii]-points[jj]).norm() < tol;
+		};
+
+		DisjointSets classes(points.size());
+		for (auto const& pair : close_points::EveryClosePair(points.size(), Same))
+			classes.Union(pair.first, pair.second);
+
+		std::vector<std::size_t> result(points.size());
+		for (std::size_t ii = 0; ii < points.size(); ++ii)
+			result[ii] = classes.Find(ii);
+		return result;
+	}
+
+
+	BOOST_AUTO_TEST_CASE(disjoint_sets_are_named_by_smallest_index)
+	{
+		DisjointSets sets(6);
+		sets.Union(4, 5);
+		sets.Union(5, 2);
+		sets.Union(1, 3);
+
+		BOOST_CHECK_EQUAL(sets.Find(4), 2);
+		BOOST_CHECK_EQUAL(sets.Find(5), 2);
+		BOOST_CHECK_EQUAL(sets.Find(3), 1);
+		BOOST_CHECK_EQUAL(sets.Find(0), 0);
+	}
+
+
+	BOOST_AUTO_TEST_CASE(same_classes_as_every_pair)
+	{
+		const double tol = 1e-6;
+		const auto points = close_points::ClusteredPoints(3000, 3, tol, bertini::algorithm::ProjectionNorm::Two, false, 17);
+
+		std::vector<bool> included(points.size(), true);
+		for (std::size_t ii = 0; ii < points.size(); ii += 11)
+			included[ii] = false;
+
+		const auto expected = CompareEveryPair(points, included, tol);
+		BOOST_CHECK(SamePointClasses(points, included, tol, 1) == expected);
+		BOOST_CHECK(SamePointClasses(points, included, tol, 4) == expected);
+	}
+
+
+	BOOST_AUTO_TEST_CASE(chains_are_one_class)
+	{
+		std::vector<Vec<dbl>> points;
+		for (unsigned ii = 0; ii < 5; ++ii)
+		{
+			Vec<dbl> x(2);
+			x << dbl(ii*0.9), dbl(0);
+			points.push_back(x);
+		}
+		Vec<dbl> far(2);
+		far << dbl(10), dbl(0);
+		points.push_back(far);
+
+		auto classes = SamePointClasses(points, std::vector<bool>(points.size(), true), 1.);
+
+		for (unsigned ii = 0; ii < 5; ++ii)
+			BOOST_CHECK_EQUAL(classes[ii], 0);
+		BOOST_CHECK_EQUAL(classes[5], 5);
+	}
+
+
+BOOST_AUTO_TEST_SUITE_END()
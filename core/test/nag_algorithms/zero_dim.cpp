@@ -33,6 +33,14 @@
 #include <boost/test/unit_test.hpp>
 #include "bertini2/nag_algorithms/output.hpp"
 
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+
 
 BOOST_AUTO_TEST_SUITE(zero_dim)
 
@@ -188,4 +196,327 @@ BOOST_AUTO_TEST_CASE(reference_managed_systems_GO)
 }
 
 
+/**
+Tracking with several threads should give bitwise the same results as tracking serially, since each path is tracked from scratch and stored by index.
+*/
+BOOST_AUTO_TEST_CASE(multithreaded_matches_serial)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	using ZeroDimConf = algorithm::ZeroDimConfig<dbl>;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+
+	zd.DefaultSetup();
+
+	zd.Solve();
+
+	auto serial_solutions = zd.FinalSolutions();
+	auto serial_metadata = zd.FinalSolutionMetadata();
+
+	auto zd_conf = zd.Get<ZeroDimConf>();
+	zd_conf.num_threads = 3;
+	zd.Set(zd_conf);
+
+	zd.Solve();
+
+	auto const& threaded_solutions = zd.FinalSolutions();
+	auto const& threaded_metadata = zd.FinalSolutionMetadata();
+
+	BOOST_REQUIRE_EQUAL(serial_solutions.size(), threaded_solutions.size());
+	for (decltype(serial_solutions.size()) ii{0}; ii < serial_solutions.size(); ++ii)
+	{
+		BOOST_CHECK(serial_metadata[ii].pre_endgame_success == threaded_metadata[ii].pre_endgame_success);
+		BOOST_CHECK(serial_metadata[ii].endgame_success == threaded_metadata[ii].endgame_success);
+		BOOST_CHECK_EQUAL(serial_metadata[ii].multiplicity, threaded_metadata[ii].multiplicity);
+
+		// bitwise identical, not merely close
+		BOOST_REQUIRE_EQUAL(serial_solutions[ii].size(), threaded_solutions[ii].size());
+		if (serial_solutions[ii].size() == 0)
+			continue;
+
+		BOOST_CHECK_EQUAL(Precision(serial_solutions[ii]), Precision(threaded_solutions[ii]));
+		for (int jj = 0; jj < serial_solutions[ii].size(); ++jj)
+			BOOST_CHECK(serial_solutions[ii](jj) == threaded_solutions[ii](jj));
+	}
+}
+
+
+
+/**
+Solving records how long each phase took, and the work the trackers did in it, and the same work is done regardless of the number of threads.
+*/
+BOOST_AUTO_TEST_CASE(solve_profiles_its_phases)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	using ZeroDimConf = algorithm::ZeroDimConfig<dbl>;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+
+	zd.DefaultSetup();
+
+	zd.Solve();
+
+	auto md = zd.AlgorithmMetadata();
+	const auto num_paths = zd.FinalSolutions().size();
+
+	BOOST_CHECK_EQUAL(md.number_paths_tracked, num_paths);
+	BOOST_CHECK_EQUAL(md.number_path_successes + md.number_path_failures, num_paths);
+	BOOST_CHECK_EQUAL(md.before_endgame.number_paths_tracked, num_paths);
+	BOOST_CHECK(md.during_endgame.number_paths_tracked <= num_paths);
+
+	BOOST_CHECK(md.elapsed_time.count() > 0);
+	BOOST_CHECK(md.before_endgame.elapsed_time + md.endgame_boundary.elapsed_time + md.during_endgame.elapsed_time + md.post_processing.elapsed_time <= md.elapsed_time);
+
+	// a double precision tracker works only in double precision
+	auto const& before = md.before_endgame.tracker_counts.ByPrecision();
+	BOOST_REQUIRE_EQUAL(before.size(), 1);
+	BOOST_CHECK_EQUAL(before.begin()->first, DoublePrecision());
+
+	auto total = md.before_endgame.tracker_counts.Total();
+	BOOST_CHECK(total.successful_steps >= num_paths);
+	BOOST_CHECK(total.function_evaluations > 0);
+	BOOST_CHECK(total.jacobian_evaluations >= total.function_evaluations);
+	BOOST_CHECK(total.lu_factorizations >= total.successful_steps);
+	BOOST_CHECK_EQUAL(total.precision_increases + total.precision_decreases, 0);
+	BOOST_CHECK(md.during_endgame.tracker_counts.Total().successful_steps > 0);
+	BOOST_CHECK(md.post_processing.tracker_counts.ByPrecision().empty());
+
+	auto zd_conf = zd.Get<ZeroDimConf>();
+	zd_conf.num_threads = 3;
+	zd.Set(zd_conf);
+
+	zd.Solve();
+
+	auto threaded_total = zd.AlgorithmMetadata().before_endgame.tracker_counts.Total();
+	BOOST_CHECK_EQUAL(threaded_total.successful_steps, total.successful_steps);
+	BOOST_CHECK_EQUAL(threaded_total.failed_steps, total.failed_steps);
+	BOOST_CHECK_EQUAL(threaded_total.function_evaluations, total.function_evaluations);
+	BOOST_CHECK_EQUAL(threaded_total.lu_factorizations, total.lu_factorizations);
+
+	std::stringstream profile;
+	bertini::algorithm::output::Classic<decltype(zd)>::Profile(profile, zd);
+	BOOST_CHECK(profile.str().find("before endgame") != std::string::npos);
+	BOOST_CHECK(profile.str().find("during endgame") != std::string::npos);
+}
+
+
+
+/**
+A sink which keeps copies of the endpoints it is passed, for comparing to a solve which keeps them itself.  Paths which failed before the endgame are passed with no endpoint.
+*/
+template<typename ZDT>
+struct CollectingSink : public bertini::algorithm::SolutionSink<ZDT>
+{
+	void PathFinished(ZDT const& zd, std::size_t index) override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		endpoints[index] = zd.FinalSolutions()[index];
+	}
+
+	void Finished(ZDT const& zd) override
+	{
+		finished = true;
+	}
+
+	std::mutex mutex;
+	std::map<std::size_t, bertini::Vec<bertini::dbl>> endpoints;
+	bool finished = false;
+};
+
+
+BOOST_AUTO_TEST_CASE(streamed_solutions_match_those_kept_in_memory)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	using ZeroDimConf = algorithm::ZeroDimConfig<dbl>;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+	using ZDT = decltype(zd);
+
+	zd.DefaultSetup();
+
+	zd.Solve();
+
+	auto kept_solutions = zd.FinalSolutions();
+	auto kept_metadata = zd.FinalSolutionMetadata();
+
+	auto zd_conf = zd.Get<ZeroDimConf>();
+	zd_conf.num_threads = 2;
+	zd.Set(zd_conf);
+
+	auto sink = std::make_shared<CollectingSink<ZDT>>();
+	zd.StreamSolutions(sink);
+	zd.Solve();
+
+	BOOST_CHECK(sink->finished);
+
+	auto const& streamed_metadata = zd.FinalSolutionMetadata();
+	for (decltype(kept_solutions.size()) ii{0}; ii < kept_solutions.size(); ++ii)
+	{
+		BOOST_CHECK(kept_metadata[ii].endgame_success == streamed_metadata[ii].endgame_success);
+		BOOST_CHECK_EQUAL(kept_metadata[ii].multiplicity, streamed_metadata[ii].multiplicity);
+
+		// released once streamed
+		BOOST_CHECK_EQUAL(zd.FinalSolutions()[ii].size(), 0);
+		BOOST_CHECK_EQUAL(zd.EndgameBoundaryData()[ii].path_point.size(), 0);
+
+		// every path is streamed, those failing before the endgame with no endpoint
+		BOOST_REQUIRE(sink->endpoints.count(ii));
+		auto const& streamed = sink->endpoints.at(ii);
+		if (kept_metadata[ii].endgame_success == SuccessCode::NeverStarted)
+		{
+			BOOST_CHECK(streamed_metadata[ii].pre_endgame_success != SuccessCode::Success);
+			BOOST_CHECK_EQUAL(streamed.size(), 0);
+			continue;
+		}
+
+		BOOST_REQUIRE_EQUAL(streamed.size(), kept_solutions[ii].size());
+		for (int jj = 0; jj < streamed.size(); ++jj)
+			BOOST_CHECK_SMALL(abs(streamed(jj) - kept_solutions[ii](jj)), 1e-12);
+	}
+
+	const auto filename = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_solutions_%%%%-%%%%");
+	auto file_sink = std::make_shared<algorithm::output::StreamingClassic<ZDT>>(filename.string());
+	zd.StreamSolutions(file_sink);
+	zd.Solve();
+
+	BOOST_CHECK_EQUAL(sink->endpoints.size(), kept_solutions.size());
+	BOOST_CHECK_EQUAL(file_sink->NumWritten(), kept_solutions.size());
+
+	std::ifstream written(filename.string());
+	std::stringstream contents;
+	contents << written.rdbuf();
+	boost::filesystem::remove(filename);
+
+	BOOST_CHECK(contents.str().find("multiplicities") != std::string::npos);
+
+	const bool any_failed_before_endgame = std::any_of(kept_metadata.begin(), kept_metadata.end(),
+		[](auto const& smd){ return smd.pre_endgame_success != SuccessCode::Success; });
+	BOOST_CHECK_EQUAL(contents.str().find("\nfailed\n") != std::string::npos, any_failed_before_endgame);
+}
+
+
+
+/**
+Write the first few records of a checkpoint to another file, as a solve interrupted partway would have.
+*/
+void WriteInterruptedCheckpoint(std::string const& from, std::string const& to, std::size_t num_records)
+{
+	auto records = bertini::algorithm::ReadCheckpoint(from);
+	BOOST_REQUIRE(records.size() >= num_records);
+
+	bertini::algorithm::CheckpointWriter writer(to);
+	for (std::size_t ii = 0; ii < num_records; ++ii)
+		writer.Append(records[ii].kind, records[ii].payload);
+}
+
+
+BOOST_AUTO_TEST_CASE(resuming_from_a_checkpoint_tracks_only_unfinished_paths)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	using ZDT = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>;
+
+	const auto checkpoint = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_checkpoint_%%%%-%%%%");
+	const auto interrupted = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_checkpoint_%%%%-%%%%");
+
+	ZDT zd(sys);
+	zd.CheckpointTo(checkpoint.string());
+	zd.Solve();
+
+	const auto solutions = zd.FinalSolutions();
+	const auto metadata = zd.FinalSolutionMetadata();
+	const auto num_paths = solutions.size();
+	BOOST_REQUIRE(num_paths >= 2);
+
+	auto records = algorithm::ReadCheckpoint(checkpoint.string());
+	const auto boundary_checked = std::find_if(records.begin(), records.end(), [](algorithm::CheckpointRecord const& r){ return r.kind == 'C'; });
+	BOOST_REQUIRE(boundary_checked != records.end());
+
+	auto CheckSameSolutions = [&](ZDT const& resumed)
+	{
+		for (decltype(solutions.size()) ii{0}; ii < num_paths; ++ii)
+		{
+			BOOST_CHECK(metadata[ii].endgame_success == resumed.FinalSolutionMetadata()[ii].endgame_success);
+			BOOST_CHECK_EQUAL(metadata[ii].multiplicity, resumed.FinalSolutionMetadata()[ii].multiplicity);
+			if (metadata[ii].endgame_success != SuccessCode::Success)
+				continue;
+			for (int jj = 0; jj < solutions[ii].size(); ++jj)
+				BOOST_CHECK_SMALL(abs(solutions[ii](jj) - resumed.FinalSolutions()[ii](jj)), 1e-12);
+		}
+	};
+
+	// interrupted before the endgame boundary, with two paths there.  a new ZeroDim has a different homotopy, until it is restored
+	{
+		WriteInterruptedCheckpoint(checkpoint.string(), interrupted.string(), 3);
+
+		ZDT resumed(sys);
+		resumed.Resume(interrupted.string());
+
+		BOOST_CHECK_EQUAL(resumed.AlgorithmMetadata().before_endgame.number_paths_tracked, num_paths-2);
+		CheckSameSolutions(resumed);
+	}
+
+	// interrupted during the endgame, with one path finished
+	{
+		const auto num_records = static_cast<std::size_t>(boundary_checked - records.begin()) + 2;
+		WriteInterruptedCheckpoint(checkpoint.string(), interrupted.string(), num_records);
+
+		// a run which dies while appending leaves part of a record
+		{
+			std::ofstream f(interrupted.string(), std::ios::binary | std::ios::app);
+			f << 'E' << "garbage";
+		}
+
+		ZDT resumed(sys);
+		resumed.CheckpointTo(interrupted.string());
+		resumed.Resume(interrupted.string());
+
+		BOOST_CHECK_EQUAL(resumed.AlgorithmMetadata().before_endgame.number_paths_tracked, 0);
+		BOOST_CHECK(resumed.AlgorithmMetadata().during_endgame.number_paths_tracked < num_paths);
+		CheckSameSolutions(resumed);
+
+		// the new checkpoint holds everything, so resuming from it tracks nothing
+		ZDT resumed_again(sys);
+		resumed_again.Resume(interrupted.string());
+		BOOST_CHECK_EQUAL(resumed_again.AlgorithmMetadata().during_endgame.number_paths_tracked, 0);
+		CheckSameSolutions(resumed_again);
+	}
+
+	boost::filesystem::remove(checkpoint);
+	boost::filesystem::remove(interrupted);
+}
+
+
+BOOST_AUTO_TEST_CASE(resuming_from_something_else_throws)
+{
+	using namespace bertini;
+
+	auto sys = system::Precon::GriewankOsborn();
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+
+	const auto filename = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_checkpoint_%%%%-%%%%");
+	{
+		std::ofstream f(filename.string());
+		f << "this is not a checkpoint file";
+	}
+	BOOST_CHECK_THROW(zd.Resume(filename.string()), std::runtime_error);
+	boost::filesystem::remove(filename);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -2013,6 +2013,138 @@ BOOST_AUTO_TEST_CASE(monodromy_RKV67_mp)
 }
 
 
+
+BOOST_AUTO_TEST_CASE(sparse_jacobian_RKF45_double)
+{
+	// a homotopy whose Jacobian has zeros, predicted with the Jacobian dense and then sparse, by the same predictor so the random vector for the norm of the inverse is shared
+	Vec<dbl> current_space(3);
+	current_space << dbl(1.1,0.02), dbl(0.48,-0.003), dbl(1.9,0.01);
+
+	dbl current_time(0.9);
+	dbl delta_t(-0.1);
+
+	bertini::System sys;
+	Var x = MakeVariable("x"), y = MakeVariable("y"), z = MakeVariable("z"), t = MakeVariable("t");
+
+	VariableGroup vars{x,y,z};
+
+	sys.AddVariableGroup(vars);
+	sys.AddPathVariable(t);
+
+	sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) - 4) );
+	sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+	sys.AddFunction( t*(z-2) + (1-t)*(pow(z,2) - y) );
+
+	auto AMP = bertini::tracking::AMPConfigFrom(sys);
+
+	double tracking_tolerance(1e-5);
+	unsigned frequency_of_CN_estimation = 1;
+
+	ExplicitRKPredictor predictor(bertini::tracking::Predictor::RKF45, sys);
+
+	auto Predict = [&](Vec<dbl> & result, double & error_est, double & norm_J, double & norm_J_inverse)
+	{
+		double size_proportion, condition_number_estimate;
+		unsigned num_steps_since_last_condition_number_computation = 1;
+		return predictor.Predict(result,
+								 error_est,
+								 size_proportion,
+								 norm_J, norm_J_inverse,
+								 sys,
+								 current_space, current_time,
+								 delta_t,
+								 condition_number_estimate,
+								 num_steps_since_last_condition_number_computation,
+								 frequency_of_CN_estimation,
+								 tracking_tolerance,
+								 AMP);
+	};
+
+	Vec<dbl> dense_result, sparse_result;
+	double dense_error_est, dense_norm_J, dense_norm_J_inverse;
+	double sparse_error_est, sparse_norm_J, sparse_norm_J_inverse;
+
+	BOOST_CHECK(Predict(dense_result, dense_error_est, dense_norm_J, dense_norm_J_inverse)==bertini::SuccessCode::Success);
+
+	predictor.SparseJacobian(true);
+	BOOST_CHECK(Predict(sparse_result, sparse_error_est, sparse_norm_J, sparse_norm_J_inverse)==bertini::SuccessCode::Success);
+
+	BOOST_CHECK_EQUAL(sparse_result.size(),3);
+	for (unsigned ii = 0; ii < sparse_result.size(); ++ii)
+		BOOST_CHECK(abs(sparse_result(ii)-dense_result(ii)) < threshold_clearance_d);
+
+	BOOST_CHECK(fabs(sparse_error_est - dense_error_est) < threshold_clearance_d);
+	BOOST_CHECK(fabs(sparse_norm_J - dense_norm_J) < threshold_clearance_d*dense_norm_J);
+	BOOST_CHECK(fabs(sparse_norm_J_inverse - dense_norm_J_inverse) < threshold_clearance_d*dense_norm_J_inverse);
+}
+
+
+BOOST_AUTO_TEST_CASE(sparse_jacobian_RKF45_mp)
+{
+	bertini::DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+
+	// a homotopy whose Jacobian has zeros, predicted with the Jacobian dense and then sparse, by the same predictor so the random vector for the norm of the inverse is shared
+	Vec<mpfr> current_space(3);
+	current_space << mpfr("1.1","0.02"), mpfr("0.48","-0.003"), mpfr("1.9","0.01");
+
+	mpfr current_time("0.9");
+	mpfr delta_t("-0.1");
+
+	bertini::System sys;
+	Var x = MakeVariable("x"), y = MakeVariable("y"), z = MakeVariable("z"), t = MakeVariable("t");
+
+	VariableGroup vars{x,y,z};
+
+	sys.AddVariableGroup(vars);
+	sys.AddPathVariable(t);
+
+	sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) - 4) );
+	sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+	sys.AddFunction( t*(z-2) + (1-t)*(pow(z,2) - y) );
+
+	auto AMP = bertini::tracking::AMPConfigFrom(sys);
+
+	double tracking_tolerance(1e-5);
+	unsigned frequency_of_CN_estimation = 1;
+
+	ExplicitRKPredictor predictor(bertini::tracking::Predictor::RKF45, sys);
+
+	auto Predict = [&](Vec<mpfr> & result, double & error_est, double & norm_J, double & norm_J_inverse)
+	{
+		double size_proportion, condition_number_estimate;
+		unsigned num_steps_since_last_condition_number_computation = 1;
+		return predictor.Predict(result,
+								 error_est,
+								 size_proportion,
+								 norm_J, norm_J_inverse,
+								 sys,
+								 current_space, current_time,
+								 delta_t,
+								 condition_number_estimate,
+								 num_steps_since_last_condition_number_computation,
+								 frequency_of_CN_estimation,
+								 tracking_tolerance,
+								 AMP);
+	};
+
+	Vec<mpfr> dense_result, sparse_result;
+	double dense_error_est, dense_norm_J, dense_norm_J_inverse;
+	double sparse_error_est, sparse_norm_J, sparse_norm_J_inverse;
+
+	BOOST_CHECK(Predict(dense_result, dense_error_est, dense_norm_J, dense_norm_J_inverse)==bertini::SuccessCode::Success);
+
+	predictor.SparseJacobian(true);
+	BOOST_CHECK(Predict(sparse_result, sparse_error_est, sparse_norm_J, sparse_norm_J_inverse)==bertini::SuccessCode::Success);
+
+	BOOST_CHECK_EQUAL(sparse_result.size(),3);
+	for (unsigned ii = 0; ii < sparse_result.size(); ++ii)
+		BOOST_CHECK(abs(sparse_result(ii)-dense_result(ii)) < threshold_clearance_mp);
+
+	BOOST_CHECK(fabs(sparse_error_est - dense_error_est) < threshold_clearance_d);
+	BOOST_CHECK(fabs(sparse_norm_J - dense_norm_J) < threshold_clearance_d*dense_norm_J);
+	BOOST_CHECK(fabs(sparse_norm_J_inverse - dense_norm_J_inverse) < threshold_clearance_d*dense_norm_J_inverse);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -787,6 +787,170 @@ BOOST_AUTO_TEST_CASE(circle_line_one_corrector_step_double)
 		BOOST_CHECK(success_code==bertini::SuccessCode::FailedToConverge);
 	}
 
+	BOOST_AUTO_TEST_CASE(mixed_precision_newton_matches_full_precision)
+	{
+		DefaultPrecision(50);
+
+		Vec<mpfr> current_space(2);
+		current_space << mpfr("1.1","0.02"), mpfr("0.48", "-0.003");
+		mpfr current_time("0.9");
+
+		bertini::System sys;
+		Var x = MakeVariable("x"), y = MakeVariable("y"), t = MakeVariable("t");
+
+		VariableGroup vars{x,y};
+
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+
+		auto AMP = bertini::tracking::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+
+		const double tracking_tolerance = 1e-40;
+		const unsigned min_num_newton_iterations = 1, max_num_newton_iterations = 30;
+
+		bertini::tracking::NewtonConfig newton;
+		NewtonCorrector full_precision(sys);
+		full_precision.Settings(newton);
+
+		newton.mixed_precision = true;
+		NewtonCorrector mixed_precision(sys);
+		mixed_precision.Settings(newton);
+
+		Vec<mpfr> full_result, mixed_result;
+		double norm_delta_z, norm_J, norm_J_inverse, condition_number_estimate;
+
+		auto full_code = full_precision.Correct(full_result, norm_delta_z, norm_J, norm_J_inverse, condition_number_estimate,
+		                                        sys, current_space, current_time, tracking_tolerance,
+		                                        min_num_newton_iterations, max_num_newton_iterations, AMP);
+
+		auto mixed_code = mixed_precision.Correct(mixed_result, norm_delta_z, norm_J, norm_J_inverse, condition_number_estimate,
+		                                          sys, current_space, current_time, tracking_tolerance,
+		                                          min_num_newton_iterations, max_num_newton_iterations, AMP);
+
+		BOOST_CHECK(full_code==bertini::SuccessCode::Success);
+		BOOST_CHECK(mixed_code==bertini::SuccessCode::Success);
+		BOOST_CHECK(norm_delta_z < tracking_tolerance);
+		for (unsigned ii = 0; ii < mixed_result.size(); ++ii)
+		{
+			BOOST_CHECK_EQUAL(bertini::Precision(mixed_result(ii)), 50);
+			BOOST_CHECK(abs(mixed_result(ii)-full_result(ii)) < mpfr_float("1e-38"));
+		}
+
+		// the residual at the refined point is as small as the working precision allows, which it couldn't be were the solving done only in double precision
+		sys.SetAndReset<mpfr>(mixed_result, current_time);
+		BOOST_CHECK(sys.Eval<mpfr>().norm() < mpfr_float("1e-38"));
+
+		// the mixed precision corrector factored the Jacobian once, in double precision, and reused that factorization for every later iteration, never factoring in multiple precision
+		auto CountsAt = [](NewtonCorrector const& corrector, unsigned precision)
+		{
+			auto const& by_precision = corrector.Counts().ByPrecision();
+			auto found = by_precision.find(precision);
+			return found==by_precision.end() ? bertini::tracking::PrecisionCounts() : found->second;
+		};
+
+		auto mixed_double = CountsAt(mixed_precision, bertini::DoublePrecision());
+		auto mixed_multiple = CountsAt(mixed_precision, 50);
+		BOOST_CHECK_EQUAL(mixed_double.lu_factorizations, 1);
+		BOOST_CHECK_EQUAL(mixed_multiple.lu_factorizations, 0);
+		BOOST_CHECK_EQUAL(mixed_multiple.jacobian_evaluations, 1);
+		BOOST_CHECK(mixed_multiple.function_evaluations > 1);
+
+		// while the full precision corrector factored at every iteration, in multiple precision
+		auto full_double = CountsAt(full_precision, bertini::DoublePrecision());
+		auto full_multiple = CountsAt(full_precision, 50);
+		BOOST_CHECK_EQUAL(full_double.lu_factorizations, 0);
+		BOOST_CHECK_EQUAL(full_multiple.lu_factorizations, full_multiple.function_evaluations);
+		BOOST_CHECK(full_multiple.lu_factorizations > 1);
+
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+	}
+
+	BOOST_AUTO_TEST_CASE(sparse_jacobian_newton_matches_dense)
+	{
+		DefaultPrecision(50);
+
+		bertini::System sys;
+		Var x = MakeVariable("x"), y = MakeVariable("y"), z = MakeVariable("z"), t = MakeVariable("t");
+
+		VariableGroup vars{x,y,z};
+
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+		sys.AddFunction( t*(z-2) + (1-t)*(pow(z,2) - y) );
+
+		auto AMP = bertini::tracking::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+
+		const unsigned min_num_newton_iterations = 1, max_num_newton_iterations = 30;
+
+		bertini::tracking::NewtonConfig newton;
+		NewtonCorrector dense(sys);
+		dense.Settings(newton);
+
+		newton.sparse_jacobian = true;
+		NewtonCorrector sparse(sys);
+		sparse.Settings(newton);
+
+		newton.mixed_precision = true;
+		NewtonCorrector sparse_mixed(sys);
+		sparse_mixed.Settings(newton);
+
+		// double precision
+		Vec<dbl> current_space_d(3);
+		current_space_d << dbl(1.1,0.02), dbl(0.48,-0.003), dbl(1.9,0.01);
+		dbl current_time_d(0.9);
+
+		Vec<dbl> dense_result_d, sparse_result_d;
+		auto dense_code_d = dense.Correct(dense_result_d, sys, current_space_d, current_time_d, 1e-12, min_num_newton_iterations, max_num_newton_iterations);
+		auto sparse_code_d = sparse.Correct(sparse_result_d, sys, current_space_d, current_time_d, 1e-12, min_num_newton_iterations, max_num_newton_iterations);
+
+		BOOST_CHECK(dense_code_d==bertini::SuccessCode::Success);
+		BOOST_CHECK(sparse_code_d==bertini::SuccessCode::Success);
+		BOOST_CHECK((dense_result_d - sparse_result_d).norm() < 1e-12);
+
+		// multiple precision, with the AMP criteria, and with mixed precision
+		Vec<mpfr> current_space(3);
+		current_space << mpfr("1.1","0.02"), mpfr("0.48", "-0.003"), mpfr("1.9","0.01");
+		mpfr current_time("0.9");
+
+		const double tracking_tolerance = 1e-40;
+		Vec<mpfr> dense_result, sparse_result, sparse_mixed_result;
+		double norm_delta_z, norm_J, norm_J_inverse, condition_number_estimate;
+		double sparse_norm_J, sparse_norm_J_inverse;
+
+		auto dense_code = dense.Correct(dense_result, norm_delta_z, norm_J, norm_J_inverse, condition_number_estimate,
+		                                sys, current_space, current_time, tracking_tolerance,
+		                                min_num_newton_iterations, max_num_newton_iterations, AMP);
+
+		auto sparse_code = sparse.Correct(sparse_result, norm_delta_z, sparse_norm_J, sparse_norm_J_inverse, condition_number_estimate,
+		                                  sys, current_space, current_time, tracking_tolerance,
+		                                  min_num_newton_iterations, max_num_newton_iterations, AMP);
+
+		auto sparse_mixed_code = sparse_mixed.Correct(sparse_mixed_result, norm_delta_z, norm_J, norm_J_inverse, condition_number_estimate,
+		                                              sys, current_space, current_time, tracking_tolerance,
+		                                              min_num_newton_iterations, max_num_newton_iterations, AMP);
+
+		BOOST_CHECK(dense_code==bertini::SuccessCode::Success);
+		BOOST_CHECK(sparse_code==bertini::SuccessCode::Success);
+		BOOST_CHECK(sparse_mixed_code==bertini::SuccessCode::Success);
+		BOOST_CHECK(sparse_norm_J > 0);
+		BOOST_CHECK(sparse_norm_J_inverse > 0);
+		for (unsigned ii = 0; ii < dense_result.size(); ++ii)
+		{
+			BOOST_CHECK(abs(sparse_result(ii)-dense_result(ii)) < mpfr_float("1e-38"));
+			BOOST_CHECK(abs(sparse_mixed_result(ii)-dense_result(ii)) < mpfr_float("1e-38"));
+		}
+
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+	}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
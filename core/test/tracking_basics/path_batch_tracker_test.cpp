@@ -0,0 +1,279 @@
+//This file is part of Bertini 2.
+//
+//path_batch_tracker_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//path_batch_tracker_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with path_batch_tracker_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// silviana amethyst, university of wisconsin eau claire
+
+
+
+
+#include <boost/test/unit_test.hpp>
+#include "bertini2/system/start_systems.hpp"
+#include "bertini2/trackers/tracker.hpp"
+
+
+
+BOOST_AUTO_TEST_SUITE(path_batch_tracker)
+
+using System = bertini::System;
+using Var = std::shared_ptr<bertini::node::Variable>;
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = std::complex<double>;
+using mpfr = bertini::mpfr_complex;
+using mpfr_float = bertini::mpfr_float;
+using bertini::MakeVariable;
+using bertini::DefaultPrecision;
+using bertini::SuccessCode;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+
+// a total degree homotopy for a system with 8 finite, nonsingular solutions
+System EightPathHomotopy(System & target, bertini::start_system::TotalDegree & TD)
+{
+	Var x = MakeVariable("x");
+	Var y = MakeVariable("y");
+	Var z = MakeVariable("z");
+	Var t = MakeVariable("t");
+
+	target.AddVariableGroup(VariableGroup{x,y,z});
+	target.AddFunction(x*x - 2);
+	target.AddFunction(y*y + x*y - 3);
+	target.AddFunction(z*z - x*z + y - 1);
+	target.Homogenize();
+	target.AutoPatch();
+
+	TD = bertini::start_system::TotalDegree(target);
+	TD.Homogenize();
+
+	auto homotopy = (1-t)*target + t*TD;
+	homotopy.AddPathVariable(t);
+	return homotopy;
+}
+
+
+
+// a total degree homotopy, with a fixed complex gamma, for a system with 12 finite solutions, 8 of which are in pairs 1e-12 apart, so the Jacobian is nearly singular at the end of their paths, and the other 4 well conditioned
+System ClusteredHomotopy(System & target, bertini::start_system::TotalDegree & TD)
+{
+	using bertini::MakeRational;
+
+	Var x = MakeVariable("x");
+	Var y = MakeVariable("y");
+	Var z = MakeVariable("z");
+	Var t = MakeVariable("t");
+
+	target.AddVariableGroup(VariableGroup{x,y,z});
+	target.AddFunction((x-1)*(x-1-MakeRational("1/1000000000000"))*(x-5));
+	target.AddFunction(y*y + x*y - 3);
+	target.AddFunction(z*z - x*z + y - 1);
+	target.Homogenize();
+	target.AutoPatch();
+
+	TD = bertini::start_system::TotalDegree(target);
+	TD.Homogenize();
+
+	auto homotopy = (1-t)*target + MakeRational("3/5","4/5")*t*TD;
+	homotopy.AddPathVariable(t);
+	return homotopy;
+}
+
+
+
+BOOST_AUTO_TEST_CASE(batched_lu_solves_each_lane)
+{
+	using bertini::tracking::BatchedLU;
+
+	const unsigned n = 5, L = 8;
+	BatchedLU lu(n, L);
+
+	std::vector<bertini::Mat<dbl>> A;
+	std::vector<Vec<dbl>> b;
+	std::vector<double> b_re(n*L), b_im(n*L);
+	for (unsigned lane = 0; lane < L; ++lane)
+	{
+		A.push_back(bertini::Mat<dbl>::Random(n,n));
+		b.push_back(Vec<dbl>::Random(n));
+		for (unsigned ii = 0; ii < n; ++ii)
+		{
+			for (unsigned jj = 0; jj < n; ++jj)
+			{
+				lu.Real(ii,jj)[lane] = A[lane](ii,jj).real();
+				lu.Imag(ii,jj)[lane] = A[lane](ii,jj).imag();
+			}
+			b_re[ii*L + lane] = b[lane](ii).real();
+			b_im[ii*L + lane] = b[lane](ii).imag();
+		}
+	}
+
+	// make one lane singular
+	for (unsigned ii = 0; ii < n; ++ii)
+	{
+		lu.Real(ii,2)[5] = 0;
+		lu.Imag(ii,2)[5] = 0;
+	}
+
+	lu.Factor();
+	lu.Solve(b_re.data(), b_im.data());
+
+	for (unsigned lane = 0; lane < L; ++lane)
+	{
+		BOOST_CHECK_EQUAL(lu.IsSingular(lane), lane==5);
+		if (lane==5)
+			continue;
+
+		Vec<dbl> x(n);
+		for (unsigned ii = 0; ii < n; ++ii)
+			x(ii) = dbl(b_re[ii*L + lane], b_im[ii*L + lane]);
+		BOOST_CHECK_SMALL((A[lane]*x - b[lane]).norm(), 1e-12);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(batch_matches_amp_tracker)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	System target;
+	bertini::start_system::TotalDegree TD;
+	auto homotopy = EightPathHomotopy(target, TD);
+
+	AMPTracker tracker(homotopy);
+	tracker.Setup(Predictor::HeunEuler, 1e-6, 1e5, SteppingConfig(), NewtonConfig());
+	tracker.PrecisionSetup(AMPConfigFrom(homotopy));
+
+	std::vector<Vec<dbl>> start_points;
+	for (unsigned ii = 0; ii < TD.NumStartPoints(); ++ii)
+		start_points.push_back(TD.StartPoint<dbl>(ii));
+
+	PathBatchTracker batch_tracker(tracker, 3); // fewer lanes than paths, so lanes are refilled
+
+	std::vector<Vec<mpfr>> batch_solutions;
+	auto codes = batch_tracker.TrackPaths(batch_solutions, dbl(1), dbl(0), start_points);
+
+	BOOST_CHECK_EQUAL(codes.size(), 8);
+	BOOST_CHECK_EQUAL(batch_tracker.NumTrackedInDouble() + batch_tracker.NumEjected(), 8);
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+
+	mpfr t_start(1), t_end(0);
+	for (unsigned ii = 0; ii < TD.NumStartPoints(); ++ii)
+	{
+		Vec<mpfr> amp_solution;
+		auto amp_code = tracker.TrackPath(amp_solution, t_start, t_end, TD.StartPoint<mpfr>(ii));
+		DefaultPrecision(30);
+
+		BOOST_CHECK(amp_code==SuccessCode::Success);
+		BOOST_CHECK(codes[ii]==SuccessCode::Success);
+
+		auto a = homotopy.DehomogenizePoint(amp_solution);
+		auto b = homotopy.DehomogenizePoint(batch_solutions[ii]);
+		BOOST_CHECK((a-b).norm() < mpfr_float("1e-5"));
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(paths_needing_more_precision_are_ejected)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	System target;
+	bertini::start_system::TotalDegree TD;
+	auto homotopy = EightPathHomotopy(target, TD);
+
+	// demanding more safety digits than double precision has, so no step in double precision is allowed
+	auto AMP = AMPConfigFrom(homotopy);
+	AMP.safety_digits_1 = 20;
+
+	AMPTracker tracker(homotopy);
+	tracker.Setup(Predictor::HeunEuler, 1e-6, 1e5, SteppingConfig(), NewtonConfig());
+	tracker.PrecisionSetup(AMP);
+
+	std::vector<Vec<dbl>> start_points;
+	for (unsigned ii = 0; ii < TD.NumStartPoints(); ++ii)
+		start_points.push_back(TD.StartPoint<dbl>(ii));
+
+	PathBatchTracker batch_tracker(tracker, 4);
+
+	std::vector<Vec<mpfr>> batch_solutions;
+	auto codes = batch_tracker.TrackPaths(batch_solutions, dbl(1), dbl(0), start_points);
+
+	BOOST_CHECK_EQUAL(batch_tracker.NumEjected(), 8);
+	BOOST_CHECK_EQUAL(batch_tracker.NumTrackedInDouble(), 0);
+
+	for (unsigned ii = 0; ii < TD.NumStartPoints(); ++ii)
+	{
+		BOOST_CHECK(codes[ii]==SuccessCode::Success);
+		auto x = homotopy.DehomogenizePoint(batch_solutions[ii]);
+		BOOST_CHECK(abs(x(0)*x(0) - 2) < mpfr_float("1e-5"));
+	}
+}
+
+
+// the paths to the clustered solutions need more than double precision at their ends, and are ejected, while the others are finished in double precision.  the batch tracker takes different steps than the AMPTracker, so the endpoints agree only to within the tracking tolerance
+BOOST_AUTO_TEST_CASE(batch_with_ejections_matches_amp_tracker)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	System target;
+	bertini::start_system::TotalDegree TD;
+	auto homotopy = ClusteredHomotopy(target, TD);
+
+	AMPTracker tracker(homotopy);
+	tracker.Setup(Predictor::HeunEuler, 1e-6, 1e5, SteppingConfig(), NewtonConfig());
+	tracker.PrecisionSetup(AMPConfigFrom(homotopy));
+
+	std::vector<Vec<dbl>> start_points;
+	for (unsigned ii = 0; ii < TD.NumStartPoints(); ++ii)
+		start_points.push_back(TD.StartPoint<dbl>(ii));
+
+	PathBatchTracker batch_tracker(tracker, 4);
+
+	std::vector<Vec<mpfr>> batch_solutions;
+	auto codes = batch_tracker.TrackPaths(batch_solutions, dbl(1), dbl(0), start_points);
+
+	BOOST_CHECK_EQUAL(codes.size(), 12);
+	BOOST_CHECK(batch_tracker.NumEjected() > 0);
+	BOOST_CHECK(batch_tracker.NumTrackedInDouble() > 0);
+	BOOST_CHECK_EQUAL(batch_tracker.NumTrackedInDouble() + batch_tracker.NumEjected(), 12);
+
+	mpfr t_start(1), t_end(0);
+	for (unsigned ii = 0; ii < TD.NumStartPoints(); ++ii)
+	{
+		Vec<mpfr> amp_solution;
+		auto amp_code = tracker.TrackPath(amp_solution, t_start, t_end, TD.StartPoint<mpfr>(ii));
+		DefaultPrecision(30);
+
+		BOOST_CHECK(amp_code==SuccessCode::Success);
+		BOOST_CHECK(codes[ii]==SuccessCode::Success);
+
+		auto a = homotopy.DehomogenizePoint(amp_solution);
+		auto b = homotopy.DehomogenizePoint(batch_solutions[ii]);
+		BOOST_CHECK((a-b).norm() < mpfr_float("1e-5"));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
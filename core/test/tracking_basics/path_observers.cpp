@@ -226,6 +226,121 @@ BOOST_AUTO_TEST_CASE(union_of_observers)
 }
 
 
+// counts the events of one type, subscribing only to that type
+template<template<class> class EventT>
+struct EventCounter : public bertini::Observer<bertini::tracking::AMPTracker>
+{
+	void Observe(bertini::AnyEvent const& e) override
+	{
+		++num_observed;
+		if (bertini::EventCast<EventT<bertini::tracking::AMPTracker>>(e))
+			++num_counted;
+	}
+
+	bertini::detail::EventMask Subscriptions() const override
+	{
+		return bertini::detail::EventTypeBits<EventT<bertini::tracking::AMPTracker>>();
+	}
+
+	unsigned num_observed = 0;
+	unsigned num_counted = 0;
+};
+
+
+BOOST_AUTO_TEST_CASE(observers_only_get_events_they_subscribe_to)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var x = MakeVariable("x");
+	Var y = MakeVariable("y");
+	Var t = MakeVariable("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	tracker.Setup(Predictor::Euler,
+	              	1e-5,
+					1e5,
+					SteppingConfig(),
+					NewtonConfig());
+
+	tracker.PrecisionSetup(AMP);
+
+	mpfr t_start(1);
+	mpfr t_end(0);
+	
+	Vec<mpfr> start_point(2);
+	start_point << mpfr(1), mpfr(1);
+
+	Vec<mpfr> end_point;
+
+	EventCounter<SuccessfulStep> successes;
+	EventCounter<NewStep> new_steps;
+	EventCounter<TrackingEvent> everything;
+	tracker.AddObserver(successes);
+	tracker.AddObserver(new_steps);
+	tracker.AddObserver(everything);
+
+	auto tracking_success = tracker.TrackPath(end_point, t_start, t_end, start_point);
+	BOOST_CHECK(tracking_success==bertini::SuccessCode::Success);
+
+	BOOST_CHECK(successes.num_counted > 0);
+	BOOST_CHECK_EQUAL(successes.num_observed, successes.num_counted);
+	BOOST_CHECK(successes.num_counted <= tracker.NumTotalStepsTaken());
+
+	BOOST_CHECK_EQUAL(new_steps.num_observed, new_steps.num_counted);
+	BOOST_CHECK(new_steps.num_counted >= successes.num_counted);
+
+	// every tracking event derives from TrackingEvent, so this one gets them all
+	BOOST_CHECK_EQUAL(everything.num_observed, everything.num_counted);
+	BOOST_CHECK(everything.num_counted > successes.num_counted + new_steps.num_counted);
+
+	// once removed, an observer gets nothing
+	tracker.RemoveObserver(everything);
+	const auto num_seen = everything.num_observed;
+	tracker.TrackPath(end_point, t_start, t_end, start_point);
+	BOOST_CHECK_EQUAL(everything.num_observed, num_seen);
+}
+
+
+BOOST_AUTO_TEST_CASE(event_cast_follows_the_hierarchy)
+{
+	using namespace bertini::tracking;
+	using bertini::EventCast;
+
+	Var x = MakeVariable("x");
+	Var t = MakeVariable("t");
+	System sys;
+	sys.AddFunction(x-t);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(VariableGroup{x});
+
+	AMPTracker tracker(sys);
+
+	const PredictorMatrixSolveFailure<AMPTracker> e(tracker);
+	bertini::AnyEvent const& any = e;
+
+	BOOST_CHECK(EventCast<PredictorMatrixSolveFailure<AMPTracker>>(any) == &e);
+	BOOST_CHECK(EventCast<MatrixSolveFailure<AMPTracker>>(any) != nullptr);
+	BOOST_CHECK(EventCast<PrecisionEvent<AMPTracker>>(any) != nullptr);
+	BOOST_CHECK(EventCast<TrackingEvent<AMPTracker>>(any) != nullptr);
+
+	BOOST_CHECK(EventCast<CorrectorMatrixSolveFailure<AMPTracker>>(any) == nullptr);
+	BOOST_CHECK(EventCast<HigherPrecisionNecessary<AMPTracker>>(any) == nullptr);
+	BOOST_CHECK(EventCast<SuccessfulStep<AMPTracker>>(any) == nullptr);
+}
+
 
 
 
@@ -0,0 +1,202 @@
+//This file is part of Bertini 2.
+//
+//test/tracking_basics/telemetry_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//test/tracking_basics/telemetry_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with test/tracking_basics/telemetry_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2021 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+/**
+\file test/tracking_basics/telemetry_test.cpp  Tests recording tracker steps into binary trace files.
+*/
+
+// individual authors of this file include:
+// silviana amethyst
+
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+
+#include "bertini2/trackers/amp_tracker.hpp"
+#include "bertini2/trackers/telemetry.hpp"
+
+#include <thread>
+
+
+BOOST_AUTO_TEST_SUITE(telemetry)
+
+using bertini::tracking::StepRecord;
+using bertini::tracking::StepRing;
+using bertini::tracking::TraceWriter;
+
+using mpfr = bertini::mpfr_complex;
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+
+StepRecord RecordNumber(std::uint64_t n)
+{
+	StepRecord r{};
+	r.path = n % 7;
+	r.nanoseconds = n;
+	r.precision = 16;
+	r.success_code = static_cast<std::int32_t>(bertini::SuccessCode::Success);
+	return r;
+}
+
+
+boost::filesystem::path TemporaryTraceFile()
+{
+	return boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_trace_%%%%-%%%%.bin");
+}
+
+
+BOOST_AUTO_TEST_CASE(ring_wraps_around_and_drops_when_full)
+{
+	StepRing ring(3);
+	BOOST_CHECK_EQUAL(ring.Capacity(), 4);
+
+	std::vector<std::uint64_t> drained;
+	auto Take = [&](StepRecord const* r, std::size_t n)
+	{
+		for (std::size_t ii = 0; ii < n; ++ii)
+			drained.push_back(r[ii].nanoseconds);
+	};
+
+	for (std::uint64_t ii = 0; ii < 4; ++ii)
+		BOOST_CHECK(ring.TryPush(RecordNumber(ii)));
+	BOOST_CHECK(!ring.TryPush(RecordNumber(4)));
+	BOOST_CHECK_EQUAL(ring.NumDropped(), 1);
+
+	BOOST_CHECK_EQUAL(ring.Drain(Take), 4);
+	BOOST_CHECK_EQUAL(ring.Drain(Take), 0);
+
+	// these straddle the end of the ring
+	for (std::uint64_t ii = 5; ii < 8; ++ii)
+		BOOST_CHECK(ring.TryPush(RecordNumber(ii)));
+	ring.Drain([&](StepRecord const*, std::size_t){});
+
+	for (std::uint64_t ii = 8; ii < 12; ++ii)
+		BOOST_CHECK(ring.TryPush(RecordNumber(ii)));
+	BOOST_CHECK_EQUAL(ring.Drain(Take), 4);
+
+	BOOST_CHECK((drained == std::vector<std::uint64_t>{0,1,2,3,8,9,10,11}));
+}
+
+
+BOOST_AUTO_TEST_CASE(writer_keeps_every_record_of_a_producing_thread_in_order)
+{
+	const auto filename = TemporaryTraceFile();
+	const std::uint64_t num_records = 100000;
+
+	{
+		TraceWriter writer(filename.string(), 64, std::chrono::milliseconds(1));
+		auto& ring = writer.NewRing();
+
+		std::thread producer([&]
+		{
+			for (std::uint64_t ii = 0; ii < num_records; ++ii)
+				while (!ring.TryPush(RecordNumber(ii)))
+					std::this_thread::yield();
+		});
+		producer.join();
+	}
+
+	auto records = bertini::tracking::ReadTrace(filename.string());
+	boost::filesystem::remove(filename);
+
+	BOOST_REQUIRE_EQUAL(records.size(), num_records);
+	for (std::uint64_t ii = 0; ii < num_records; ++ii)
+		BOOST_CHECK_EQUAL(records[ii].nanoseconds, ii);
+}
+
+
+BOOST_AUTO_TEST_CASE(record_and_summarize_a_tracked_path)
+{
+	using namespace bertini::tracking;
+	using bertini::MakeVariable;
+	bertini::DefaultPrecision(16);
+
+	auto x = MakeVariable("x");
+	auto y = MakeVariable("y");
+	auto t = MakeVariable("t");
+
+	bertini::System sys;
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(bertini::VariableGroup{x,y});
+
+	AMPTracker tracker(sys);
+	tracker.Setup(Predictor::Euler, 1e-5, 1e5, SteppingConfig(), NewtonConfig());
+	tracker.PrecisionSetup(AMPConfigFrom(sys));
+
+	Vec<mpfr> start_point(2), end_point;
+	start_point << mpfr(1), mpfr(1);
+
+	const auto filename = TemporaryTraceFile();
+	unsigned num_steps;
+	{
+		TraceWriter writer(filename.string());
+		StepRecorder<AMPTracker> recorder(writer);
+		recorder.SetPath(42);
+
+		tracker.AddObserver(recorder);
+		auto code = tracker.TrackPath(end_point, mpfr(1), mpfr(0), start_point);
+		tracker.RemoveObserver(recorder);
+
+		BOOST_CHECK(code==bertini::SuccessCode::Success);
+		num_steps = tracker.NumTotalStepsTaken();
+	}
+
+	auto records = ReadTrace(filename.string());
+	boost::filesystem::remove(filename);
+
+	// one for the start of the path, and one for each step
+	BOOST_REQUIRE_EQUAL(records.size(), num_steps+1);
+	BOOST_CHECK_EQUAL(records.front().success_code, static_cast<std::int32_t>(bertini::SuccessCode::NeverStarted));
+	BOOST_CHECK_CLOSE(records.front().time_real, 1., 1e-12);
+	BOOST_CHECK_SMALL(records.back().time_real, 1e-12);
+	for (auto const& r : records)
+		BOOST_CHECK_EQUAL(r.path, 42);
+
+	auto summary = SummarizeTrace(records);
+	BOOST_CHECK_EQUAL(summary.num_steps, num_steps);
+	BOOST_REQUIRE_EQUAL(summary.paths.size(), 1);
+	BOOST_CHECK_EQUAL(summary.paths.at(42).num_steps, num_steps);
+	BOOST_CHECK_EQUAL(summary.paths.at(42).num_failed_steps, summary.num_failed_steps);
+
+	std::size_t steps_at_precisions = 0, failures_at_times = 0;
+	for (auto const& p : summary.steps_at_precision)
+		steps_at_precisions += p.second;
+	for (auto f : summary.failures_by_time)
+		failures_at_times += f;
+	BOOST_CHECK_EQUAL(steps_at_precisions, num_steps);
+	BOOST_CHECK_EQUAL(failures_at_times, summary.num_failed_steps);
+}
+
+
+BOOST_AUTO_TEST_CASE(reading_something_else_throws)
+{
+	const auto filename = TemporaryTraceFile();
+	{
+		std::ofstream f(filename.string());
+		f << "this is not a trace file";
+	}
+	BOOST_CHECK_THROW(bertini::tracking::ReadTrace(filename.string()), std::runtime_error);
+	boost::filesystem::remove(filename);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()